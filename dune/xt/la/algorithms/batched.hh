@@ -0,0 +1,217 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_BATCHED_HH
+#define DUNE_XT_LA_ALGORITHMS_BATCHED_HH
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/common/precision.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/type_traits.hh>
+
+#include <dune/xt/la/exceptions.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+/**
+ * \brief Gaussian elimination with partial pivoting for a chunk of num_lanes independent N x N systems with num_rhs
+ *        right hand sides each.
+ *
+ * The data is stored in structure-of-arrays layout, i.e. entry (ii, jj) of the matrix in lane bb is
+ * A[(ii * N + jj) * num_lanes + bb] and entry (ii, cc) of the right hand side in lane bb is
+ * B[(ii * num_rhs + cc) * num_lanes + bb]. All arithmetic loops run over the lanes in the innermost loop and have a
+ * compile-time trip count, so they are vectorized across the batch. Only the pivot search and the row swaps, which
+ * differ between the lanes, are done lane by lane. On exit, B contains the solutions. Only real K are supported (the
+ * pivot search compares absolute values of type K).
+ *
+ * \return the first lane containing a singular matrix, or num_lanes if all matrices are regular
+ */
+template <class K, size_t N, size_t num_rhs, size_t num_lanes>
+size_t batched_gauss_elimination(K* A, K* B)
+{
+  static_assert(!Common::is_complex<K>::value, "Only implemented for real scalars!");
+  const auto limit = FMatrixPrecision<K>::absolute_limit();
+  K factor[num_lanes];
+  for (size_t kk = 0; kk < N; ++kk) {
+    // pivoting
+    for (size_t bb = 0; bb < num_lanes; ++bb) {
+      size_t pivot = kk;
+      K max_value = std::abs(A[(kk * N + kk) * num_lanes + bb]);
+      for (size_t ii = kk + 1; ii < N; ++ii) {
+        const K value = std::abs(A[(ii * N + kk) * num_lanes + bb]);
+        if (value > max_value) {
+          max_value = value;
+          pivot = ii;
+        }
+      }
+      if (!(max_value > limit))
+        return bb;
+      if (pivot != kk) {
+        for (size_t jj = kk; jj < N; ++jj)
+          std::swap(A[(kk * N + jj) * num_lanes + bb], A[(pivot * N + jj) * num_lanes + bb]);
+        for (size_t cc = 0; cc < num_rhs; ++cc)
+          std::swap(B[(kk * num_rhs + cc) * num_lanes + bb], B[(pivot * num_rhs + cc) * num_lanes + bb]);
+      }
+    }
+    // elimination
+    const K* pivot_row = A + kk * N * num_lanes;
+    const K* pivot_rhs = B + kk * num_rhs * num_lanes;
+    for (size_t ii = kk + 1; ii < N; ++ii) {
+      K* row = A + ii * N * num_lanes;
+      K* rhs = B + ii * num_rhs * num_lanes;
+      for (size_t bb = 0; bb < num_lanes; ++bb)
+        factor[bb] = row[kk * num_lanes + bb] / pivot_row[kk * num_lanes + bb];
+      for (size_t jj = kk + 1; jj < N; ++jj)
+        for (size_t bb = 0; bb < num_lanes; ++bb)
+          row[jj * num_lanes + bb] -= factor[bb] * pivot_row[jj * num_lanes + bb];
+      for (size_t cc = 0; cc < num_rhs; ++cc)
+        for (size_t bb = 0; bb < num_lanes; ++bb)
+          rhs[cc * num_lanes + bb] -= factor[bb] * pivot_rhs[cc * num_lanes + bb];
+    }
+  }
+  // backward substitution
+  for (size_t ii = N; ii-- > 0;) {
+    const K* row = A + ii * N * num_lanes;
+    K* rhs = B + ii * num_rhs * num_lanes;
+    for (size_t jj = ii + 1; jj < N; ++jj) {
+      const K* solved = B + jj * num_rhs * num_lanes;
+      for (size_t cc = 0; cc < num_rhs; ++cc)
+        for (size_t bb = 0; bb < num_lanes; ++bb)
+          rhs[cc * num_lanes + bb] -= row[jj * num_lanes + bb] * solved[cc * num_lanes + bb];
+    }
+    for (size_t cc = 0; cc < num_rhs; ++cc)
+      for (size_t bb = 0; bb < num_lanes; ++bb)
+        rhs[cc * num_lanes + bb] /= row[ii * num_lanes + bb];
+  }
+  return num_lanes;
+} // ... batched_gauss_elimination(...)
+
+// Copies the matrices first, ..., first + num_lanes - 1 to A, padding with identity matrices if there are fewer.
+template <class K, int N, size_t num_lanes>
+void load_batch(const std::vector<FieldMatrix<K, N, N>>& matrices, const size_t first, K* A)
+{
+  const size_t count = std::min(num_lanes, matrices.size() - first);
+  for (size_t ii = 0; ii < N; ++ii)
+    for (size_t jj = 0; jj < N; ++jj) {
+      K* entries = A + (ii * N + jj) * num_lanes;
+      for (size_t bb = 0; bb < count; ++bb)
+        entries[bb] = matrices[first + bb][ii][jj];
+      for (size_t bb = count; bb < num_lanes; ++bb)
+        entries[bb] = ii == jj ? 1. : 0.;
+    }
+} // ... load_batch(...)
+
+
+} // namespace internal
+
+
+//! Number of matrices that are processed simultaneously by batched_solve and batched_invert.
+static constexpr size_t batched_num_lanes = 32;
+
+
+/**
+ * \brief Solves matrices[ii] * solutions[ii] = rhs[ii] for all ii, using Gaussian elimination with partial pivoting.
+ *
+ * Intended for many independent small systems (e.g., local problems on each grid element). The matrices are
+ * processed in chunks of batched_num_lanes, which are transposed to structure-of-arrays layout, such that the
+ * elimination is vectorized across the matrices instead of within a single (too small) matrix. Only real scalars K
+ * are supported.
+ *
+ * \throws Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements if one of the matrices is singular
+ */
+template <class K, int N>
+void batched_solve(const std::vector<FieldMatrix<K, N, N>>& matrices,
+                   const std::vector<FieldVector<K, N>>& rhs,
+                   std::vector<FieldVector<K, N>>& solutions)
+{
+  static constexpr size_t num_lanes = batched_num_lanes;
+  const size_t num_matrices = matrices.size();
+  if (rhs.size() != num_matrices)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "Number of matrices: " << num_matrices << "\n   Number of right hand sides: " << rhs.size());
+  solutions.resize(num_matrices);
+  std::vector<K> A(N * N * num_lanes);
+  std::vector<K> B(N * num_lanes);
+  for (size_t first = 0; first < num_matrices; first += num_lanes) {
+    const size_t count = std::min(num_lanes, num_matrices - first);
+    internal::load_batch<K, N, num_lanes>(matrices, first, A.data());
+    for (size_t ii = 0; ii < N; ++ii) {
+      for (size_t bb = 0; bb < count; ++bb)
+        B[ii * num_lanes + bb] = rhs[first + bb][ii];
+      std::fill(B.begin() + ii * num_lanes + count, B.begin() + (ii + 1) * num_lanes, K(0));
+    }
+    const size_t singular_lane = internal::batched_gauss_elimination<K, N, 1, num_lanes>(A.data(), B.data());
+    if (singular_lane < num_lanes)
+      DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
+                 "Matrix " << first + singular_lane << " is singular!");
+    for (size_t ii = 0; ii < N; ++ii)
+      for (size_t bb = 0; bb < count; ++bb)
+        solutions[first + bb][ii] = B[ii * num_lanes + bb];
+  }
+} // ... batched_solve(...)
+
+/**
+ * \brief Computes the inverses of all given real matrices.
+ *
+ * Each matrix is reduced to upper triangular form by Gaussian elimination with partial pivoting, applied to the
+ * identity as N right hand sides, and the inverse is then obtained by backward substitution.
+ * \see batched_solve
+ * \throws Exceptions::matrix_invert_failed_bc_data_did_not_fulfill_requirements if one of the matrices is singular
+ */
+template <class K, int N>
+void batched_invert(const std::vector<FieldMatrix<K, N, N>>& matrices, std::vector<FieldMatrix<K, N, N>>& inverses)
+{
+  static constexpr size_t num_lanes = batched_num_lanes;
+  const size_t num_matrices = matrices.size();
+  inverses.resize(num_matrices);
+  std::vector<K> A(N * N * num_lanes);
+  std::vector<K> B(N * N * num_lanes);
+  for (size_t first = 0; first < num_matrices; first += num_lanes) {
+    const size_t count = std::min(num_lanes, num_matrices - first);
+    internal::load_batch<K, N, num_lanes>(matrices, first, A.data());
+    for (size_t ii = 0; ii < N; ++ii)
+      for (size_t jj = 0; jj < N; ++jj)
+        std::fill_n(B.begin() + (ii * N + jj) * num_lanes, num_lanes, ii == jj ? K(1) : K(0));
+    const size_t singular_lane = internal::batched_gauss_elimination<K, N, N, num_lanes>(A.data(), B.data());
+    if (singular_lane < num_lanes)
+      DUNE_THROW(Exceptions::matrix_invert_failed_bc_data_did_not_fulfill_requirements,
+                 "Matrix " << first + singular_lane << " is singular!");
+    for (size_t ii = 0; ii < N; ++ii)
+      for (size_t jj = 0; jj < N; ++jj)
+        for (size_t bb = 0; bb < count; ++bb)
+          inverses[first + bb][ii][jj] = B[(ii * N + jj) * num_lanes + bb];
+  }
+} // ... batched_invert(...)
+
+/**
+ * \brief Convenience variant of batched_invert returning the inverses.
+ */
+template <class K, int N>
+std::vector<FieldMatrix<K, N, N>> batched_invert(const std::vector<FieldMatrix<K, N, N>>& matrices)
+{
+  std::vector<FieldMatrix<K, N, N>> inverses;
+  batched_invert(matrices, inverses);
+  return inverses;
+}
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_BATCHED_HH
@@ -11,6 +11,9 @@
 #ifndef DUNE_XT_LA_ALGORITHMS_CHOLESKY_HH
 #define DUNE_XT_LA_ALGORITHMS_CHOLESKY_HH
 
+#include <cmath>
+#include <vector>
+
 #include <dune/common/fvector.hh>
 #include <dune/common/fmatrix.hh>
 #include <dune/common/math.hh>
@@ -21,6 +24,7 @@
 
 #include <dune/xt/la/container.hh>
 #include <dune/xt/la/container/eye-matrix.hh>
+#include <dune/xt/la/algorithms/static_size_kernels.hh>
 #include <dune/xt/la/algorithms/triangular_solves.hh>
 
 namespace Dune {
@@ -135,6 +139,8 @@ void cholesky_colwise(MatrixType& A)
   } // jj
 }
 
+// Only computes the entries of L within the pattern of A, i.e. fill-in is dropped. Use SparseCholeskyFactorization
+// (see sparse_cholesky.hh) for a complete sparse factorization.
 template <class MatrixType>
 typename std::enable_if_t<Common::MatrixAbstraction<MatrixType>::storage_layout == Common::StorageLayout::csr, void>
 cholesky_csr(MatrixType& A)
@@ -294,17 +300,91 @@ struct LDLTSolver
 }; // struct CholeskySolver<...>
 
 
+// Overwrites the Cholesky factor L of A with the one of A + x x^T (or A - x x^T if downdate is true), x is used as
+// workspace. This is the classical algorithm applying a sequence of (hyperbolic, for downdates) rotations.
+template <class MatrixType, class ScalarType>
+void cholesky_rank_one_modification(MatrixType& L, std::vector<ScalarType>& x, const bool downdate)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  static_assert(!Common::is_complex<ScalarType>::value, "Only implemented for real matrices!");
+  const size_t size = M::rows(L);
+  for (size_t kk = 0; kk < size; ++kk) {
+    const ScalarType L_kk = M::get_entry(L, kk, kk);
+    const ScalarType r_squared = downdate ? L_kk * L_kk - x[kk] * x[kk] : L_kk * L_kk + x[kk] * x[kk];
+    if (!(r_squared > 0)) // use !(.. > 0) instead of (.. <= 0) to also throw on NaNs
+      DUNE_THROW(MathError, "Cholesky up-/downdate failed, the resulting matrix is not positive definite!");
+    const ScalarType r = std::sqrt(r_squared);
+    const ScalarType c = r / L_kk;
+    const ScalarType s = x[kk] / L_kk;
+    M::set_entry(L, kk, kk, r);
+    for (size_t ii = kk + 1; ii < size; ++ii) {
+      const ScalarType L_ik = (M::get_entry(L, ii, kk) + (downdate ? -s : s) * x[ii]) / c;
+      M::set_entry(L, ii, kk, L_ik);
+      x[ii] = c * x[ii] - s * L_ik;
+    }
+  } // kk
+} // ... cholesky_rank_one_modification(...)
+
+// Applies cholesky_rank_one_modification for x = U(:, jj), jj = 0, ..., cols(U) - 1, i.e. A +- U U^T.
+template <class MatrixType, class SecondMatrixType>
+void cholesky_rank_k_modification(MatrixType& L, const SecondMatrixType& U, const bool downdate)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using MU = Common::MatrixAbstraction<SecondMatrixType>;
+  const size_t size = M::rows(L);
+  if (M::cols(L) != size || MU::rows(U) != size)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "L has to be square and U needs as many rows as L!\n   L: " << M::rows(L) << "x" << M::cols(L)
+                                                                          << "\n   U: " << MU::rows(U) << "x"
+                                                                          << MU::cols(U));
+  std::vector<typename M::ScalarType> x(size);
+  for (size_t jj = 0; jj < MU::cols(U); ++jj) {
+    for (size_t ii = 0; ii < size; ++ii)
+      x[ii] = MU::get_entry(U, ii, jj);
+    cholesky_rank_one_modification(L, x, downdate);
+  }
+} // ... cholesky_rank_k_modification(...)
+
+// Copies x to a std::vector and applies cholesky_rank_one_modification.
+template <class MatrixType, class VectorType>
+void cholesky_rank_one_modification(MatrixType& L, const VectorType& x, const bool downdate)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using V = Common::VectorAbstraction<VectorType>;
+  const size_t size = M::rows(L);
+  if (M::cols(L) != size || V::size(x) != size)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "L has to be square and x needs as many entries as L has rows!\n   L: "
+                   << M::rows(L) << "x" << M::cols(L) << "\n   x.size() = " << V::size(x));
+  std::vector<typename M::ScalarType> work(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    work[ii] = V::get_entry(x, ii);
+  cholesky_rank_one_modification(L, work, downdate);
+} // ... cholesky_rank_one_modification(...)
+
+
 } // namespace internal
 
 
 template <class MatrixType>
-typename std::enable_if_t<Common::is_matrix<MatrixType>::value, void> cholesky(MatrixType& A)
+typename std::enable_if_t<Common::is_matrix<MatrixType>::value && !internal::is_small_field_matrix<MatrixType>::value,
+                          void>
+cholesky(MatrixType& A)
 {
   internal::CholeskySolver<MatrixType>::cholesky(A);
 } // void solve_lower_triangular(...)
 
+// fully unrolled variant for small FieldMatrix types
+template <class MatrixType>
+typename std::enable_if_t<internal::is_small_field_matrix<MatrixType>::value, void> cholesky(MatrixType& A)
+{
+  internal::static_cholesky(static_cast<typename internal::is_small_field_matrix<MatrixType>::FieldMatrixType&>(A));
+}
+
 template <class MatrixType, class VectorType>
-typename std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_vector<VectorType>::value, void>
+typename std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_vector<VectorType>::value
+                              && !internal::is_small_field_matrix<MatrixType>::value,
+                          void>
 solve_cholesky_factorized(const MatrixType& L, VectorType& rhs)
 {
   auto x = rhs;
@@ -312,6 +392,68 @@ solve_cholesky_factorized(const MatrixType& L, VectorType& rhs)
   solve_lower_triangular_transposed(L, rhs, x);
 } // void solve_lower_triangular(...)
 
+// fully unrolled variant for small FieldMatrix types
+template <class MatrixType, class VectorType>
+typename std::enable_if_t<internal::is_small_field_matrix<MatrixType>::value && Common::is_vector<VectorType>::value,
+                          void>
+solve_cholesky_factorized(const MatrixType& L, VectorType& rhs)
+{
+  using V = Common::VectorAbstraction<VectorType>;
+  using FieldMatrixType = typename internal::is_small_field_matrix<MatrixType>::FieldMatrixType;
+  static constexpr int size = FieldMatrixType::rows;
+  FieldVector<typename FieldMatrixType::value_type, size> x;
+  for (size_t ii = 0; ii < size; ++ii)
+    x[ii] = V::get_entry(rhs, ii);
+  internal::static_solve_cholesky_factorized(static_cast<const FieldMatrixType&>(L), x);
+  for (size_t ii = 0; ii < size; ++ii)
+    V::set_entry(rhs, ii, x[ii]);
+}
+
+/**
+ * \brief Given the Cholesky factor L of A (see cholesky), computes the Cholesky factor of A + x x^T in place.
+ *
+ * Requires O(n^2) operations instead of the O(n^3) of a new factorization. Only the lower triangular part of L is
+ * accessed, which has to be stored densely (the update fills in).
+ */
+template <class MatrixType, class VectorType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_vector<VectorType>::value, void>
+cholesky_update(MatrixType& L, const VectorType& x)
+{
+  internal::cholesky_rank_one_modification(L, x, false);
+}
+
+/**
+ * \brief Rank-k variant of cholesky_update, computes the Cholesky factor of A + U U^T in place.
+ */
+template <class MatrixType, class SecondMatrixType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_matrix<SecondMatrixType>::value, void>
+cholesky_update(MatrixType& L, const SecondMatrixType& U)
+{
+  internal::cholesky_rank_k_modification(L, U, false);
+}
+
+/**
+ * \brief Given the Cholesky factor L of A (see cholesky), computes the Cholesky factor of A - x x^T in place.
+ * \throws MathError if A - x x^T is not (numerically) positive definite, L is unusable afterwards in that case.
+ * \see cholesky_update
+ */
+template <class MatrixType, class VectorType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_vector<VectorType>::value, void>
+cholesky_downdate(MatrixType& L, const VectorType& x)
+{
+  internal::cholesky_rank_one_modification(L, x, true);
+}
+
+/**
+ * \brief Rank-k variant of cholesky_downdate, computes the Cholesky factor of A - U U^T in place.
+ */
+template <class MatrixType, class SecondMatrixType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_matrix<SecondMatrixType>::value, void>
+cholesky_downdate(MatrixType& L, const SecondMatrixType& U)
+{
+  internal::cholesky_rank_k_modification(L, U, true);
+}
+
 
 template <class FirstVectorType, class SecondVectorType>
 typename std::enable_if_t<Common::is_vector<FirstVectorType>::value && Common::is_vector<SecondVectorType>::value, void>
@@ -0,0 +1,80 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_CONDITION_ESTIMATE_HH
+#define DUNE_XT_LA_ALGORITHMS_CONDITION_ESTIMATE_HH
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+/**
+ * \brief Estimate of the 1-norm condition number norm_1 * ||A^{-1}||_1 of an n x n matrix A with 1-norm norm_1.
+ *
+ * Uses Hager's method with Higham's refinements (as in LAPACK's xGECON and xTRCON): solve(x) and solve_adjoint(x)
+ * have to compute A^{-1} x and A^{-H} x in place for a std::vector<ScalarType> x of size n. The result is a lower
+ * bound, which is usually accurate within a factor of 3, at the cost of at most 11 solves.
+ * \sa Higham, FORTRAN codes for estimating the one-norm of a real or complex matrix, with applications to condition
+ *     estimation, ACM Trans. Math. Softw. 14 (1988)
+ */
+template <class ScalarType, class RealType, class SolveType, class AdjointSolveType>
+RealType hager_condition_estimate(const size_t n,
+                                  const RealType norm_1,
+                                  const SolveType& solve,
+                                  const AdjointSolveType& solve_adjoint)
+{
+  if (n == 0)
+    return 0;
+  std::vector<ScalarType> x(n, ScalarType(1. / n)), z(n);
+  RealType inverse_norm = 0;
+  size_t last_index = n;
+  for (size_t iteration = 0; iteration < 5; ++iteration) {
+    solve(x);
+    RealType y_norm = 0;
+    for (size_t ii = 0; ii < n; ++ii) {
+      const RealType abs_val = std::abs(x[ii]);
+      y_norm += abs_val;
+      z[ii] = abs_val > 0 ? x[ii] / abs_val : ScalarType(1);
+    }
+    if (iteration > 0 && y_norm <= inverse_norm)
+      break;
+    inverse_norm = y_norm;
+    solve_adjoint(z);
+    size_t index = 0;
+    for (size_t ii = 1; ii < n; ++ii)
+      if (std::abs(z[ii]) > std::abs(z[index]))
+        index = ii;
+    if (index == last_index)
+      break;
+    last_index = index;
+    std::fill(x.begin(), x.end(), ScalarType(0));
+    x[index] = ScalarType(1);
+  }
+  // alternative estimate, guards against the worst cases of the above iteration
+  for (size_t ii = 0; ii < n; ++ii)
+    x[ii] = ScalarType((ii % 2 ? -1. : 1.) * (1. + (n > 1 ? double(ii) / double(n - 1) : 0.)));
+  solve(x);
+  RealType alternative = 0;
+  for (size_t ii = 0; ii < n; ++ii)
+    alternative += std::abs(x[ii]);
+  inverse_norm = std::max(inverse_norm, RealType(2. * alternative / (3. * n)));
+  return norm_1 * inverse_norm;
+} // ... hager_condition_estimate(...)
+
+
+} // namespace internal
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_CONDITION_ESTIMATE_HH
@@ -0,0 +1,399 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_GEMM_HH
+#define DUNE_XT_LA_ALGORITHMS_GEMM_HH
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if HAVE_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+#if HAVE_MKL
+#  include <mkl_cblas.h>
+#elif HAVE_CBLAS
+#  include <cblas.h>
+#endif
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/matrix.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+/**
+ * \brief Block sizes of the packed gemm.
+ *
+ * A block of mc x kc entries of A and a block of kc x nc entries of B are copied to contiguous buffers consisting of
+ * micro-panels of mr rows (of A) and nr columns (of B), respectively. The micro-kernel then computes an mr x nr block
+ * of C in registers. kc is chosen such that a micro-panel of B stays in the L1 cache and mc such that the packed block
+ * of A stays in the L2 cache.
+ */
+template <class ScalarType>
+struct GemmBlocking
+{
+  static constexpr size_t mr = 4;
+  static constexpr size_t nr = (sizeof(ScalarType) <= 4) ? 16 : 8;
+  static constexpr size_t mc = 96;
+  static constexpr size_t kc = 256;
+  static constexpr size_t nc = 2048;
+};
+
+
+// Strided view of a dense matrix, entry (ii, jj) is data[ii * row_stride + jj * col_stride].
+template <class ScalarType>
+struct StridedMatrix
+{
+  ScalarType* data;
+  size_t row_stride;
+  size_t col_stride;
+
+  ScalarType& operator()(const size_t ii, const size_t jj) const
+  {
+    return data[ii * row_stride + jj * col_stride];
+  }
+};
+
+
+// packs rows [row_begin, row_begin + num_rows) and columns [col_begin, col_begin + depth) of A into micro-panels of mr
+// rows each (stored column after column), the last micro-panel is padded with zeros
+template <class ScalarType>
+void pack_gemm_a(const StridedMatrix<const ScalarType>& A,
+                 const size_t row_begin,
+                 const size_t num_rows,
+                 const size_t col_begin,
+                 const size_t depth,
+                 ScalarType* buffer)
+{
+  constexpr size_t mr = GemmBlocking<ScalarType>::mr;
+  for (size_t ii = 0; ii < num_rows; ii += mr) {
+    const size_t panel_rows = std::min(mr, num_rows - ii);
+    for (size_t pp = 0; pp < depth; ++pp) {
+      for (size_t rr = 0; rr < panel_rows; ++rr)
+        buffer[rr] = A(row_begin + ii + rr, col_begin + pp);
+      for (size_t rr = panel_rows; rr < mr; ++rr)
+        buffer[rr] = ScalarType(0);
+      buffer += mr;
+    }
+  }
+} // ... pack_gemm_a(...)
+
+
+// packs rows [row_begin, row_begin + depth) and columns [col_begin, col_begin + num_cols) of B into micro-panels of nr
+// columns each (stored row after row), the last micro-panel is padded with zeros
+template <class ScalarType>
+void pack_gemm_b(const StridedMatrix<const ScalarType>& B,
+                 const size_t row_begin,
+                 const size_t depth,
+                 const size_t col_begin,
+                 const size_t num_cols,
+                 ScalarType* buffer)
+{
+  constexpr size_t nr = GemmBlocking<ScalarType>::nr;
+  for (size_t jj = 0; jj < num_cols; jj += nr) {
+    const size_t panel_cols = std::min(nr, num_cols - jj);
+    for (size_t pp = 0; pp < depth; ++pp) {
+      for (size_t cc = 0; cc < panel_cols; ++cc)
+        buffer[cc] = B(row_begin + pp, col_begin + jj + cc);
+      for (size_t cc = panel_cols; cc < nr; ++cc)
+        buffer[cc] = ScalarType(0);
+      buffer += nr;
+    }
+  }
+} // ... pack_gemm_b(...)
+
+
+// C(0:num_rows, 0:num_cols) += alpha * (packed mr x depth micro-panel of A) * (packed depth x nr micro-panel of B)
+template <class ScalarType>
+void gemm_micro_kernel(const size_t depth,
+                       const ScalarType alpha,
+                       const ScalarType* a_panel,
+                       const ScalarType* b_panel,
+                       const StridedMatrix<ScalarType>& C,
+                       const size_t num_rows,
+                       const size_t num_cols)
+{
+  constexpr size_t mr = GemmBlocking<ScalarType>::mr;
+  constexpr size_t nr = GemmBlocking<ScalarType>::nr;
+  ScalarType accumulator[mr][nr] = {};
+  for (size_t pp = 0; pp < depth; ++pp) {
+    for (size_t rr = 0; rr < mr; ++rr) {
+      const ScalarType a_entry = a_panel[pp * mr + rr];
+      for (size_t cc = 0; cc < nr; ++cc)
+        accumulator[rr][cc] += a_entry * b_panel[pp * nr + cc];
+    }
+  }
+  for (size_t rr = 0; rr < num_rows; ++rr)
+    for (size_t cc = 0; cc < num_cols; ++cc)
+      C(rr, cc) += alpha * accumulator[rr][cc];
+} // ... gemm_micro_kernel(...)
+
+
+template <class ScalarType>
+void packed_gemm(const size_t m,
+                 const size_t n,
+                 const size_t k,
+                 const ScalarType alpha,
+                 const StridedMatrix<const ScalarType>& A,
+                 const StridedMatrix<const ScalarType>& B,
+                 const StridedMatrix<ScalarType>& C)
+{
+  using Blocking = GemmBlocking<ScalarType>;
+  constexpr size_t mr = Blocking::mr;
+  constexpr size_t nr = Blocking::nr;
+  const size_t num_row_blocks = (m + Blocking::mc - 1) / Blocking::mc;
+  std::vector<ScalarType> packed_b(Blocking::kc * (std::min(n, Blocking::nc) + nr));
+  for (size_t jc = 0; jc < n; jc += Blocking::nc) {
+    const size_t nc = std::min(Blocking::nc, n - jc);
+    for (size_t pc = 0; pc < k; pc += Blocking::kc) {
+      const size_t kc = std::min(Blocking::kc, k - pc);
+      pack_gemm_b(B, pc, kc, jc, nc, packed_b.data());
+      // the macro-tiles of C belonging to different row blocks are independent
+      const auto compute_row_blocks = [&](const size_t first_block, const size_t last_block) {
+        std::vector<ScalarType> packed_a(Blocking::kc * (Blocking::mc + mr));
+        for (size_t block = first_block; block < last_block; ++block) {
+          const size_t ic = block * Blocking::mc;
+          const size_t mc = std::min(Blocking::mc, m - ic);
+          pack_gemm_a(A, ic, mc, pc, kc, packed_a.data());
+          for (size_t jr = 0; jr < nc; jr += nr) {
+            for (size_t ir = 0; ir < mc; ir += mr) {
+              const StridedMatrix<ScalarType> C_block{&C(ic + ir, jc + jr), C.row_stride, C.col_stride};
+              gemm_micro_kernel(kc,
+                                alpha,
+                                packed_a.data() + ir * kc,
+                                packed_b.data() + jr * kc,
+                                C_block,
+                                std::min(mr, mc - ir),
+                                std::min(nr, nc - jr));
+            }
+          }
+        }
+      };
+#if HAVE_TBB
+      if (num_row_blocks > 1 && m * nc * kc > 1000000) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_row_blocks),
+                          [&](const tbb::blocked_range<size_t>& range) {
+                            compute_row_blocks(range.begin(), range.end());
+                          });
+        continue;
+      }
+#endif
+      compute_row_blocks(0, num_row_blocks);
+    } // pc
+  } // jc
+} // ... packed_gemm(...)
+
+
+// Fallback for all scalar types without a cblas gemm (and for double if neither MKL nor a CBLAS is available).
+template <class ScalarType>
+bool cblas_gemm(const size_t /*m*/,
+                const size_t /*n*/,
+                const size_t /*k*/,
+                const ScalarType /*alpha*/,
+                const ScalarType* /*a*/,
+                const size_t /*a_row_stride*/,
+                const size_t /*a_col_stride*/,
+                const ScalarType* /*b*/,
+                const size_t /*b_row_stride*/,
+                const size_t /*b_col_stride*/,
+                const ScalarType /*beta*/,
+                ScalarType* /*c*/,
+                const size_t /*c_row_stride*/,
+                const size_t /*c_col_stride*/)
+{
+  return false;
+}
+
+
+#if HAVE_MKL || HAVE_CBLAS
+
+// Expresses a strided rows x cols matrix as a (possibly transposed) row-major matrix with leading dimension ld, which
+// is only possible if one of the strides is 1.
+inline bool cblas_row_major_layout(
+    const size_t row_stride, const size_t col_stride, const size_t rows, const size_t cols, bool& trans, int& ld)
+{
+  size_t leading_dimension = 0;
+  if (col_stride == 1 && row_stride >= std::max(cols, size_t(1))) {
+    trans = false;
+    leading_dimension = row_stride;
+  } else if (row_stride == 1 && col_stride >= std::max(rows, size_t(1))) {
+    trans = true;
+    leading_dimension = col_stride;
+  } else
+    return false;
+  if (leading_dimension > size_t(std::numeric_limits<int>::max()))
+    return false;
+  ld = static_cast<int>(leading_dimension);
+  return true;
+} // ... cblas_row_major_layout(...)
+
+inline bool cblas_gemm(const size_t m,
+                       const size_t n,
+                       const size_t k,
+                       const double alpha,
+                       const double* a,
+                       const size_t a_row_stride,
+                       const size_t a_col_stride,
+                       const double* b,
+                       const size_t b_row_stride,
+                       const size_t b_col_stride,
+                       const double beta,
+                       double* c,
+                       const size_t c_row_stride,
+                       const size_t c_col_stride)
+{
+  if (std::max({m, n, k}) > size_t(std::numeric_limits<int>::max()))
+    return false;
+  bool trans_a, trans_b, trans_c;
+  int lda, ldb, ldc;
+  if (!cblas_row_major_layout(a_row_stride, a_col_stride, m, k, trans_a, lda)
+      || !cblas_row_major_layout(b_row_stride, b_col_stride, k, n, trans_b, ldb)
+      || !cblas_row_major_layout(c_row_stride, c_col_stride, m, n, trans_c, ldc))
+    return false;
+  const auto op = [](const bool trans) { return trans ? CblasTrans : CblasNoTrans; };
+  if (!trans_c)
+    cblas_dgemm(CblasRowMajor, op(trans_a), op(trans_b), int(m), int(n), int(k), alpha, a, lda, b, ldb, beta, c, ldc);
+  else // C^T = B^T A^T
+    cblas_dgemm(CblasRowMajor, op(!trans_b), op(!trans_a), int(n), int(m), int(k), alpha, b, ldb, a, lda, beta, c, ldc);
+  return true;
+} // ... cblas_gemm(...)
+
+#endif // HAVE_MKL || HAVE_CBLAS
+
+
+constexpr bool is_dense_layout(const Common::StorageLayout layout)
+{
+  return layout == Common::StorageLayout::dense_row_major || layout == Common::StorageLayout::dense_column_major;
+}
+
+
+// true if gemm can be used with a MatrixType and a ScalarType, i.e. if the entries are stored densely as ScalarType
+template <class MatrixType, class ScalarType>
+struct is_gemm_compatible
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  static const constexpr bool value =
+      M::is_matrix && is_dense_layout(M::storage_layout) && std::is_same<typename M::ScalarType, ScalarType>::value;
+};
+
+
+} // namespace internal
+
+
+/**
+ * \brief Computes C = alpha A B + beta C for dense matrices given by pointers and strides.
+ *
+ * The entry (ii, jj) of A is a[ii * a_row_stride + jj * a_col_stride] (similarly for B and C), so row-major,
+ * column-major and transposed matrices are all covered. For double, this is forwarded to cblas_dgemm if MKL or a
+ * CBLAS is available (and if the strides allow for it), otherwise a cache-blocked gemm on packed copies of A and B is
+ * used (which is multithreaded over blocks of rows of C if TBB is available). C must not overlap with A or B.
+ */
+template <class ScalarType>
+void gemm(const size_t m,
+          const size_t n,
+          const size_t k,
+          const ScalarType alpha,
+          const ScalarType* a,
+          const size_t a_row_stride,
+          const size_t a_col_stride,
+          const ScalarType* b,
+          const size_t b_row_stride,
+          const size_t b_col_stride,
+          const ScalarType beta,
+          ScalarType* c,
+          const size_t c_row_stride,
+          const size_t c_col_stride)
+{
+  if (m == 0 || n == 0)
+    return;
+  if (internal::cblas_gemm(m,
+                           n,
+                           k,
+                           alpha,
+                           a,
+                           a_row_stride,
+                           a_col_stride,
+                           b,
+                           b_row_stride,
+                           b_col_stride,
+                           beta,
+                           c,
+                           c_row_stride,
+                           c_col_stride))
+    return;
+  const internal::StridedMatrix<ScalarType> C{c, c_row_stride, c_col_stride};
+  for (size_t ii = 0; ii < m; ++ii)
+    for (size_t jj = 0; jj < n; ++jj)
+      C(ii, jj) = (beta == ScalarType(0)) ? ScalarType(0) : beta * C(ii, jj);
+  if (k == 0 || alpha == ScalarType(0))
+    return;
+  internal::packed_gemm(m,
+                        n,
+                        k,
+                        alpha,
+                        internal::StridedMatrix<const ScalarType>{a, a_row_stride, a_col_stride},
+                        internal::StridedMatrix<const ScalarType>{b, b_row_stride, b_col_stride},
+                        C);
+} // ... gemm(...)
+
+
+/**
+ * \brief Computes C = alpha A B + beta C for matrices with dense row-major or column-major storage.
+ */
+template <class FirstMatrixType, class SecondMatrixType, class ThirdMatrixType>
+void gemm(const FirstMatrixType& A,
+          const SecondMatrixType& B,
+          ThirdMatrixType& C,
+          const typename Common::MatrixAbstraction<ThirdMatrixType>::ScalarType alpha = 1,
+          const typename Common::MatrixAbstraction<ThirdMatrixType>::ScalarType beta = 0)
+{
+  using M1 = Common::MatrixAbstraction<FirstMatrixType>;
+  using M2 = Common::MatrixAbstraction<SecondMatrixType>;
+  using M3 = Common::MatrixAbstraction<ThirdMatrixType>;
+  static_assert(internal::is_dense_layout(M1::storage_layout) && internal::is_dense_layout(M2::storage_layout)
+                    && internal::is_dense_layout(M3::storage_layout),
+                "Only implemented for dense matrices!");
+  const size_t m = M1::rows(A);
+  const size_t k = M1::cols(A);
+  const size_t n = M2::cols(B);
+  if (M2::rows(B) != k || M3::rows(C) != m || M3::cols(C) != n)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "A is " << m << "x" << k << ", B is " << M2::rows(B) << "x" << n << " and C is " << M3::rows(C)
+                       << "x" << M3::cols(C) << "!");
+  const bool a_row_major = (M1::storage_layout == Common::StorageLayout::dense_row_major);
+  const bool b_row_major = (M2::storage_layout == Common::StorageLayout::dense_row_major);
+  const bool c_row_major = (M3::storage_layout == Common::StorageLayout::dense_row_major);
+  gemm(m,
+       n,
+       k,
+       alpha,
+       M1::data(A),
+       a_row_major ? k : 1,
+       a_row_major ? 1 : m,
+       M2::data(B),
+       b_row_major ? n : 1,
+       b_row_major ? 1 : k,
+       beta,
+       M3::data(C),
+       c_row_major ? n : 1,
+       c_row_major ? 1 : m);
+} // ... gemm(...)
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_GEMM_HH
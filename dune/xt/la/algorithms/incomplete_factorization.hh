@@ -0,0 +1,564 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_INCOMPLETE_FACTORIZATION_HH
+#define DUNE_XT_LA_ALGORITHMS_INCOMPLETE_FACTORIZATION_HH
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/ftraits.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/matrix.hh>
+#include <dune/xt/common/vector.hh>
+
+#include <dune/xt/la/algorithms/triangular_solves.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+static constexpr size_t incomplete_factorization_unset = std::numeric_limits<size_t>::max();
+
+
+template <class MatrixType>
+void check_incomplete_factorization_matrix(const MatrixType& A)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  static_assert(M::storage_layout == Common::StorageLayout::csr,
+                "Incomplete factorizations are only implemented for matrices in CSR format!");
+  if (M::rows(A) != M::cols(A))
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "Incomplete factorizations are only implemented for square matrices!\n   rows = "
+                   << M::rows(A) << "\n   cols = " << M::cols(A));
+} // ... check_incomplete_factorization_matrix(...)
+
+
+} // namespace internal
+
+
+/**
+ * \brief Incomplete LU factorization A \approx LU of a square matrix in CSR format (e.g. CommonSparseMatrixCsr).
+ *
+ * Supports ILU(k) (fill allowed up to level k, ILU(0) for k = 0) and ILUT (fill determined by a drop tolerance and a
+ * maximal number of entries per row in L and U). For ILU(k), the pattern of the factors is computed once by symbolic()
+ * and numeric() may be called repeatedly for matrices with the same pattern but different values. ILUT determines its
+ * pattern from the values, so threshold() does both at once. The level schedules of both factors (see
+ * TriangularLevelSchedule) are computed together with the pattern.
+ *
+ * The factors are stored row-wise in one CSR structure with sorted column indices: the entries of row ii left of
+ * diagonal_indices()[ii] belong to L (the unit diagonal is not stored), the remaining ones to U. Use apply() to
+ * compute (LU)^{-1} r, e.g. as a preconditioner.
+ */
+template <class ScalarImp = double>
+class IncompleteLUFactorization
+{
+public:
+  using ScalarType = ScalarImp;
+  using RealType = typename Dune::FieldTraits<ScalarType>::real_type;
+
+  IncompleteLUFactorization()
+    : size_(0)
+    , row_pointers_(1, 0)
+  {}
+
+  /**
+   * \brief Computes the pattern of the ILU(fill_level) factors of A from the levels of fill.
+   *
+   * Entries of A have level 0, an entry created by eliminating with row kk gets the level
+   * level(ii, kk) + level(kk, jj) + 1 and is only kept if this does not exceed fill_level. The diagonal is always part
+   * of the pattern.
+   */
+  template <class MatrixType>
+  void symbolic(const MatrixType& A, const size_t fill_level = 0)
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    internal::check_incomplete_factorization_matrix(A);
+    static constexpr size_t unset = internal::incomplete_factorization_unset;
+    size_ = M::rows(A);
+    const auto* a_row_pointers = A.outer_index_ptr();
+    const auto* a_column_indices = A.inner_index_ptr();
+    row_pointers_.assign(1, 0);
+    column_indices_.clear();
+    diagonal_indices_.resize(size_);
+    // levels of fill of the entries of the factors, only needed during the symbolic phase
+    std::vector<size_t> levels;
+    std::vector<size_t> row_levels(size_, unset);
+    std::set<size_t> row;
+    for (size_t ii = 0; ii < size_; ++ii) {
+      row.clear();
+      for (size_t kk = a_row_pointers[ii]; kk < a_row_pointers[ii + 1]; ++kk) {
+        row.insert(a_column_indices[kk]);
+        row_levels[a_column_indices[kk]] = 0;
+      }
+      row.insert(ii);
+      row_levels[ii] = 0;
+      // eliminate with the previous rows, fill-in is only created right of the current column
+      for (auto it = row.begin(); it != row.end() && *it < ii; ++it) {
+        const size_t kk = *it;
+        for (size_t pp = diagonal_indices_[kk] + 1; pp < row_pointers_[kk + 1]; ++pp) {
+          const size_t jj = column_indices_[pp];
+          const size_t level = row_levels[kk] + levels[pp] + 1;
+          if (level > fill_level)
+            continue;
+          if (row_levels[jj] == unset) {
+            row.insert(jj);
+            row_levels[jj] = level;
+          } else
+            row_levels[jj] = std::min(row_levels[jj], level);
+        } // pp
+      } // kk
+      for (const auto& jj : row) {
+        if (jj == ii)
+          diagonal_indices_[ii] = column_indices_.size();
+        column_indices_.push_back(jj);
+        levels.push_back(row_levels[jj]);
+        row_levels[jj] = unset;
+      }
+      row_pointers_.push_back(column_indices_.size());
+    } // ii
+    entries_.assign(column_indices_.size(), ScalarType(0));
+    inverse_diagonal_.assign(size_, ScalarType(0));
+    update_schedules();
+  } // ... symbolic(...)
+
+  /**
+   * \brief Computes the values of the factors on the pattern computed by symbolic().
+   * \throws Common::Exceptions::shapes_do_not_match if A does not fit the pattern
+   * \throws MathError if a zero pivot is encountered
+   */
+  template <class MatrixType>
+  void numeric(const MatrixType& A)
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    internal::check_incomplete_factorization_matrix(A);
+    static constexpr size_t unset = internal::incomplete_factorization_unset;
+    if (M::rows(A) != size_)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "Call symbolic() first!\n   size of the pattern: " << size_ << "\n   rows of A: " << M::rows(A));
+    const auto* a_entries = A.entries();
+    const auto* a_row_pointers = A.outer_index_ptr();
+    const auto* a_column_indices = A.inner_index_ptr();
+    std::vector<size_t> positions(size_, unset);
+    for (size_t ii = 0; ii < size_; ++ii) {
+      const size_t row_begin = row_pointers_[ii];
+      const size_t row_end = row_pointers_[ii + 1];
+      for (size_t pp = row_begin; pp < row_end; ++pp) {
+        positions[column_indices_[pp]] = pp;
+        entries_[pp] = ScalarType(0);
+      }
+      for (size_t kk = a_row_pointers[ii]; kk < a_row_pointers[ii + 1]; ++kk) {
+        const size_t pos = positions[a_column_indices[kk]];
+        if (pos == unset)
+          DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                     "Entry (" << ii << ", " << a_column_indices[kk] << ") of A is not contained in the pattern!");
+        entries_[pos] += a_entries[kk];
+      }
+      // ikj-variant of the Gaussian elimination, restricted to the pattern
+      for (size_t pp = row_begin; pp < diagonal_indices_[ii]; ++pp) {
+        const size_t kk = column_indices_[pp];
+        entries_[pp] *= inverse_diagonal_[kk];
+        const ScalarType l_ik = entries_[pp];
+        for (size_t qq = diagonal_indices_[kk] + 1; qq < row_pointers_[kk + 1]; ++qq) {
+          const size_t pos = positions[column_indices_[qq]];
+          if (pos != unset)
+            entries_[pos] -= l_ik * entries_[qq];
+        }
+      } // pp
+      const ScalarType diagonal_entry = entries_[diagonal_indices_[ii]];
+      if (diagonal_entry == ScalarType(0))
+        DUNE_THROW(Dune::MathError, "Incomplete LU factorization failed, zero pivot in row " << ii << "!");
+      inverse_diagonal_[ii] = ScalarType(1) / diagonal_entry;
+      for (size_t pp = row_begin; pp < row_end; ++pp)
+        positions[column_indices_[pp]] = unset;
+    } // ii
+  } // ... numeric(...)
+
+  /**
+   * \brief Computes the ILUT factors of A.
+   *
+   * During the elimination of row ii, entries with an absolute value below drop_tolerance times the 2-norm of the ii-th
+   * row of A are dropped. Afterwards only the max_fill_per_row largest entries of the L and of the U part of the row
+   * are kept (the diagonal is always kept).
+   * \throws MathError if a zero pivot is encountered
+   */
+  template <class MatrixType>
+  void threshold(const MatrixType& A,
+                 const RealType drop_tolerance,
+                 const size_t max_fill_per_row = std::numeric_limits<size_t>::max())
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    internal::check_incomplete_factorization_matrix(A);
+    size_ = M::rows(A);
+    const auto* a_entries = A.entries();
+    const auto* a_row_pointers = A.outer_index_ptr();
+    const auto* a_column_indices = A.inner_index_ptr();
+    row_pointers_.assign(1, 0);
+    column_indices_.clear();
+    entries_.clear();
+    diagonal_indices_.resize(size_);
+    inverse_diagonal_.resize(size_);
+    std::vector<ScalarType> work(size_, ScalarType(0));
+    std::set<size_t> row;
+    std::vector<size_t> lower, upper;
+    const auto by_decreasing_magnitude = [&](const size_t& left, const size_t& right) {
+      return std::abs(work[left]) > std::abs(work[right]);
+    };
+    const auto keep_largest = [&](std::vector<size_t>& columns) {
+      if (columns.size() > max_fill_per_row) {
+        std::nth_element(columns.begin(),
+                         columns.begin() + static_cast<std::ptrdiff_t>(max_fill_per_row),
+                         columns.end(),
+                         by_decreasing_magnitude);
+        columns.resize(max_fill_per_row);
+      }
+      std::sort(columns.begin(), columns.end());
+    };
+    for (size_t ii = 0; ii < size_; ++ii) {
+      row.clear();
+      RealType row_norm(0);
+      for (size_t kk = a_row_pointers[ii]; kk < a_row_pointers[ii + 1]; ++kk) {
+        row.insert(a_column_indices[kk]);
+        work[a_column_indices[kk]] += a_entries[kk];
+        row_norm += std::pow(std::abs(a_entries[kk]), 2);
+      }
+      row.insert(ii);
+      const RealType tolerance = drop_tolerance * std::sqrt(row_norm);
+      for (auto it = row.begin(); it != row.end() && *it < ii; ++it) {
+        const size_t kk = *it;
+        work[kk] *= inverse_diagonal_[kk];
+        if (std::abs(work[kk]) < tolerance) {
+          work[kk] = ScalarType(0);
+          continue;
+        }
+        for (size_t qq = diagonal_indices_[kk] + 1; qq < row_pointers_[kk + 1]; ++qq) {
+          row.insert(column_indices_[qq]);
+          work[column_indices_[qq]] -= work[kk] * entries_[qq];
+        }
+      } // kk
+      lower.clear();
+      upper.clear();
+      for (const auto& jj : row) {
+        if (jj != ii && std::abs(work[jj]) >= tolerance && work[jj] != ScalarType(0))
+          (jj < ii ? lower : upper).push_back(jj);
+      }
+      keep_largest(lower);
+      keep_largest(upper);
+      if (work[ii] == ScalarType(0))
+        DUNE_THROW(Dune::MathError, "Incomplete LU factorization failed, zero pivot in row " << ii << "!");
+      for (const auto& jj : lower) {
+        column_indices_.push_back(jj);
+        entries_.push_back(work[jj]);
+      }
+      diagonal_indices_[ii] = column_indices_.size();
+      column_indices_.push_back(ii);
+      entries_.push_back(work[ii]);
+      inverse_diagonal_[ii] = ScalarType(1) / work[ii];
+      for (const auto& jj : upper) {
+        column_indices_.push_back(jj);
+        entries_.push_back(work[jj]);
+      }
+      row_pointers_.push_back(column_indices_.size());
+      for (const auto& jj : row)
+        work[jj] = ScalarType(0);
+    } // ii
+    update_schedules();
+  } // ... threshold(...)
+
+  /**
+   * \brief Computes x = (LU)^{-1} x in place by a forward and a backward substitution.
+   *
+   * Both substitutions are level-scheduled, see TriangularLevelSchedule.
+   */
+  template <class VectorType>
+  void apply(VectorType& x) const
+  {
+    using V = Common::VectorAbstraction<VectorType>;
+    assert(V::size(x) == size_);
+    lower_schedule_.for_each_row([&](const size_t ii) {
+      ScalarType sum = V::get_entry(x, ii);
+      for (size_t pp = row_pointers_[ii]; pp < diagonal_indices_[ii]; ++pp)
+        sum -= entries_[pp] * V::get_entry(x, column_indices_[pp]);
+      V::set_entry(x, ii, sum);
+    });
+    upper_schedule_.for_each_row([&](const size_t ii) {
+      ScalarType sum = V::get_entry(x, ii);
+      for (size_t pp = diagonal_indices_[ii] + 1; pp < row_pointers_[ii + 1]; ++pp)
+        sum -= entries_[pp] * V::get_entry(x, column_indices_[pp]);
+      V::set_entry(x, ii, sum * inverse_diagonal_[ii]);
+    });
+  } // ... apply(...)
+
+  /**
+   * \brief Computes x = (LU)^{-1} rhs.
+   */
+  template <class VectorType>
+  void apply(const VectorType& rhs, VectorType& x) const
+  {
+    x = rhs;
+    apply(x);
+  }
+
+  size_t rows() const
+  {
+    return size_;
+  }
+
+  size_t non_zeros() const
+  {
+    return column_indices_.size();
+  }
+
+  const std::vector<size_t>& row_pointers() const
+  {
+    return row_pointers_;
+  }
+
+  const std::vector<size_t>& column_indices() const
+  {
+    return column_indices_;
+  }
+
+  const std::vector<size_t>& diagonal_indices() const
+  {
+    return diagonal_indices_;
+  }
+
+  const std::vector<ScalarType>& entries() const
+  {
+    return entries_;
+  }
+
+private:
+  void update_schedules()
+  {
+    lower_schedule_ = TriangularLevelSchedule(size_, row_pointers_.data(), column_indices_.data(), true);
+    upper_schedule_ = TriangularLevelSchedule(size_, row_pointers_.data(), column_indices_.data(), false);
+  }
+
+  size_t size_;
+  std::vector<size_t> row_pointers_;
+  std::vector<size_t> column_indices_;
+  std::vector<size_t> diagonal_indices_;
+  std::vector<ScalarType> entries_;
+  std::vector<ScalarType> inverse_diagonal_;
+  TriangularLevelSchedule lower_schedule_;
+  TriangularLevelSchedule upper_schedule_;
+}; // class IncompleteLUFactorization
+
+
+/**
+ * \brief Incomplete Cholesky factorization IC(0) A \approx LL^T of a symmetric positive definite matrix in CSR format.
+ *
+ * L has the pattern of the lower triangular part of A (only this part of A is read). As for IncompleteLUFactorization,
+ * symbolic() computes the pattern and numeric() may be called repeatedly for matrices with the same pattern. L is
+ * stored row-wise with sorted column indices, the diagonal entry is the last one of each row.
+ */
+template <class ScalarImp = double>
+class IncompleteCholeskyFactorization
+{
+public:
+  using ScalarType = ScalarImp;
+
+  IncompleteCholeskyFactorization()
+    : size_(0)
+    , row_pointers_(1, 0)
+  {}
+
+  template <class MatrixType>
+  void symbolic(const MatrixType& A)
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    internal::check_incomplete_factorization_matrix(A);
+    size_ = M::rows(A);
+    const auto* a_row_pointers = A.outer_index_ptr();
+    const auto* a_column_indices = A.inner_index_ptr();
+    row_pointers_.assign(1, 0);
+    column_indices_.clear();
+    std::set<size_t> row;
+    for (size_t ii = 0; ii < size_; ++ii) {
+      row.clear();
+      for (size_t kk = a_row_pointers[ii]; kk < a_row_pointers[ii + 1]; ++kk)
+        if (a_column_indices[kk] < ii)
+          row.insert(a_column_indices[kk]);
+      column_indices_.insert(column_indices_.end(), row.begin(), row.end());
+      column_indices_.push_back(ii);
+      row_pointers_.push_back(column_indices_.size());
+    } // ii
+    entries_.assign(column_indices_.size(), ScalarType(0));
+    inverse_diagonal_.assign(size_, ScalarType(0));
+    // row-wise index structure of the strictly upper triangular part of L^T, for the backward substitution
+    transposed_row_pointers_.assign(size_ + 1, 0);
+    for (size_t ii = 0; ii < size_; ++ii)
+      for (size_t pp = row_pointers_[ii]; pp < row_pointers_[ii + 1] - 1; ++pp)
+        ++transposed_row_pointers_[column_indices_[pp] + 1];
+    for (size_t ii = 0; ii < size_; ++ii)
+      transposed_row_pointers_[ii + 1] += transposed_row_pointers_[ii];
+    transposed_column_indices_.resize(transposed_row_pointers_[size_]);
+    transposed_entry_indices_.resize(transposed_row_pointers_[size_]);
+    std::vector<size_t> next_position(transposed_row_pointers_.begin(), transposed_row_pointers_.end() - 1);
+    for (size_t ii = 0; ii < size_; ++ii) {
+      for (size_t pp = row_pointers_[ii]; pp < row_pointers_[ii + 1] - 1; ++pp) {
+        const size_t pos = next_position[column_indices_[pp]]++;
+        transposed_column_indices_[pos] = ii;
+        transposed_entry_indices_[pos] = pp;
+      }
+    }
+    lower_schedule_ = TriangularLevelSchedule(size_, row_pointers_.data(), column_indices_.data(), true);
+    upper_schedule_ =
+        TriangularLevelSchedule(size_, transposed_row_pointers_.data(), transposed_column_indices_.data(), false);
+  } // ... symbolic(...)
+
+  /**
+   * \brief Computes the values of L on the pattern computed by symbolic().
+   * \throws MathError if a non-positive pivot is encountered
+   */
+  template <class MatrixType>
+  void numeric(const MatrixType& A)
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    internal::check_incomplete_factorization_matrix(A);
+    static constexpr size_t unset = internal::incomplete_factorization_unset;
+    if (M::rows(A) != size_)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "Call symbolic() first!\n   size of the pattern: " << size_ << "\n   rows of A: " << M::rows(A));
+    const auto* a_entries = A.entries();
+    const auto* a_row_pointers = A.outer_index_ptr();
+    const auto* a_column_indices = A.inner_index_ptr();
+    std::vector<size_t> positions(size_, unset);
+    for (size_t ii = 0; ii < size_; ++ii) {
+      const size_t row_begin = row_pointers_[ii];
+      const size_t diag = row_pointers_[ii + 1] - 1;
+      for (size_t pp = row_begin; pp <= diag; ++pp) {
+        positions[column_indices_[pp]] = pp;
+        entries_[pp] = ScalarType(0);
+      }
+      for (size_t kk = a_row_pointers[ii]; kk < a_row_pointers[ii + 1]; ++kk) {
+        if (a_column_indices[kk] > ii)
+          continue;
+        const size_t pos = positions[a_column_indices[kk]];
+        if (pos == unset)
+          DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                     "Entry (" << ii << ", " << a_column_indices[kk] << ") of A is not contained in the pattern!");
+        entries_[pos] += a_entries[kk];
+      }
+      // L_ij = (A_ij - sum_{k < j} L_ik L_jk) / L_jj, both rows are sorted
+      for (size_t pp = row_begin; pp < diag; ++pp) {
+        const size_t jj = column_indices_[pp];
+        ScalarType sum = entries_[pp];
+        size_t qq = row_begin;
+        size_t rr = row_pointers_[jj];
+        const size_t jj_diag = row_pointers_[jj + 1] - 1;
+        while (qq < pp && rr < jj_diag) {
+          if (column_indices_[qq] < column_indices_[rr])
+            ++qq;
+          else if (column_indices_[qq] > column_indices_[rr])
+            ++rr;
+          else
+            sum -= entries_[qq++] * entries_[rr++];
+        }
+        entries_[pp] = sum * inverse_diagonal_[jj];
+      } // pp
+      ScalarType diagonal_entry = entries_[diag];
+      for (size_t pp = row_begin; pp < diag; ++pp)
+        diagonal_entry -= entries_[pp] * entries_[pp];
+      if (!(diagonal_entry > ScalarType(0)))
+        DUNE_THROW(Dune::MathError,
+                   "Incomplete Cholesky factorization failed, non-positive pivot in row " << ii << "!");
+      entries_[diag] = std::sqrt(diagonal_entry);
+      inverse_diagonal_[ii] = ScalarType(1) / entries_[diag];
+      for (size_t pp = row_begin; pp <= diag; ++pp)
+        positions[column_indices_[pp]] = unset;
+    } // ii
+  } // ... numeric(...)
+
+  /**
+   * \brief Computes x = (LL^T)^{-1} x in place by a forward and a backward substitution.
+   *
+   * Both substitutions are level-scheduled, see TriangularLevelSchedule.
+   */
+  template <class VectorType>
+  void apply(VectorType& x) const
+  {
+    using V = Common::VectorAbstraction<VectorType>;
+    assert(V::size(x) == size_);
+    lower_schedule_.for_each_row([&](const size_t ii) {
+      ScalarType sum = V::get_entry(x, ii);
+      for (size_t pp = row_pointers_[ii]; pp < row_pointers_[ii + 1] - 1; ++pp)
+        sum -= entries_[pp] * V::get_entry(x, column_indices_[pp]);
+      V::set_entry(x, ii, sum * inverse_diagonal_[ii]);
+    });
+    upper_schedule_.for_each_row([&](const size_t ii) {
+      ScalarType sum = V::get_entry(x, ii);
+      for (size_t pp = transposed_row_pointers_[ii]; pp < transposed_row_pointers_[ii + 1]; ++pp)
+        sum -= entries_[transposed_entry_indices_[pp]] * V::get_entry(x, transposed_column_indices_[pp]);
+      V::set_entry(x, ii, sum * inverse_diagonal_[ii]);
+    });
+  } // ... apply(...)
+
+  /**
+   * \brief Computes x = (LL^T)^{-1} rhs.
+   */
+  template <class VectorType>
+  void apply(const VectorType& rhs, VectorType& x) const
+  {
+    x = rhs;
+    apply(x);
+  }
+
+  size_t rows() const
+  {
+    return size_;
+  }
+
+  size_t non_zeros() const
+  {
+    return column_indices_.size();
+  }
+
+  const std::vector<size_t>& row_pointers() const
+  {
+    return row_pointers_;
+  }
+
+  const std::vector<size_t>& column_indices() const
+  {
+    return column_indices_;
+  }
+
+  const std::vector<ScalarType>& entries() const
+  {
+    return entries_;
+  }
+
+private:
+  size_t size_;
+  std::vector<size_t> row_pointers_;
+  std::vector<size_t> column_indices_;
+  std::vector<ScalarType> entries_;
+  std::vector<ScalarType> inverse_diagonal_;
+  std::vector<size_t> transposed_row_pointers_;
+  std::vector<size_t> transposed_column_indices_;
+  std::vector<size_t> transposed_entry_indices_;
+  TriangularLevelSchedule lower_schedule_;
+  TriangularLevelSchedule upper_schedule_;
+}; // class IncompleteCholeskyFactorization
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_INCOMPLETE_FACTORIZATION_HH
@@ -0,0 +1,528 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_LU_HH
+#define DUNE_XT_LA_ALGORITHMS_LU_HH
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/ftraits.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/math.hh>
+#include <dune/xt/common/matrix.hh>
+#include <dune/xt/common/vector.hh>
+
+#include <dune/xt/la/algorithms/condition_estimate.hh>
+#include <dune/xt/la/algorithms/gemm.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+/**
+ * \brief The threshold below which lu_decomposition, invert_in_place and DenseLuFactorization treat a pivot as zero,
+ *        n * epsilon * norm_1 for an n x n matrix with 1-norm norm_1.
+ *
+ * Factors computed from smaller pivots would be dominated by rounding errors. Being relative to the norm, the verdict
+ * does not change if the matrix is scaled.
+ */
+template <class RealType>
+RealType singularity_threshold(const size_t n, const RealType norm_1)
+{
+  return RealType(n) * std::numeric_limits<RealType>::epsilon() * norm_1;
+}
+
+
+// The 1-norm (maximum column sum) of a matrix given by the generic matrix abstraction.
+template <class MatrixType>
+typename Common::MatrixAbstraction<MatrixType>::RealType matrix_norm_1(const MatrixType& A)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  typename M::RealType ret = 0;
+  for (size_t cc = 0; cc < M::cols(A); ++cc) {
+    typename M::RealType column_sum = 0;
+    for (size_t rr = 0; rr < M::rows(A); ++rr)
+      column_sum += std::abs(M::get_entry(A, rr, cc));
+    ret = std::max(ret, column_sum);
+  }
+  return ret;
+} // ... matrix_norm_1(...)
+
+
+/**
+ * \brief Step kk of the partial (row) pivoting shared by lu_decomposition, invert_in_place and DenseLuFactorization.
+ *
+ * Searches the row of largest abs_entry(rr) = |A(rr, kk)| among the rows kk, ..., num_rows - 1 and calls
+ * swap_rows(kk, pivot) if it is not row kk.
+ * \return the pivot row
+ * \throws FMatrixError if the largest modulus is not larger than threshold (or NaN)
+ */
+template <class RealType, class AbsEntryType, class SwapRowsType>
+size_t partial_pivoting_step(const size_t kk,
+                             const size_t num_rows,
+                             const RealType threshold,
+                             AbsEntryType&& abs_entry,
+                             SwapRowsType&& swap_rows)
+{
+  size_t pivot = kk;
+  RealType max_abs = abs_entry(kk);
+  for (size_t rr = kk + 1; rr < num_rows; ++rr) {
+    const RealType abs_val = abs_entry(rr);
+    if (abs_val > max_abs) {
+      max_abs = abs_val;
+      pivot = rr;
+    }
+  }
+  if (!(max_abs > threshold))
+    DUNE_THROW(FMatrixError,
+               "Matrix is singular!\n   largest pivot candidate: " << max_abs << "\n   threshold: " << threshold);
+  if (pivot != kk)
+    swap_rows(kk, pivot);
+  return pivot;
+} // ... partial_pivoting_step(...)
+
+
+// Swaps the rows ii and jj (num_cols entries each) of a matrix given by the generic matrix abstraction.
+template <class MatrixType>
+void swap_rows(MatrixType& A, const size_t ii, const size_t jj, const size_t num_cols)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  for (size_t cc = 0; cc < num_cols; ++cc) {
+    const typename M::ScalarType tmp = M::get_entry(A, ii, cc);
+    M::set_entry(A, ii, cc, M::get_entry(A, jj, cc));
+    M::set_entry(A, jj, cc, tmp);
+  }
+} // ... swap_rows(...)
+
+
+} // namespace internal
+
+
+/**
+ * \brief Computes the LU decomposition with partial (row) pivoting PA = LU in place.
+ *
+ * After completion, the strictly lower triangular part of A contains L (the unit diagonal is not stored) and the upper
+ * triangular part of A contains U. In step kk, row kk was swapped with row pivots[kk].
+ * Only uses the generic matrix abstraction (no BLAS/LAPACK calls), so this also works for single precision or
+ * complex matrices.
+ * \throws FMatrixError if A is not square or numerically singular, i.e. if a pivot is not larger than
+ *         n * epsilon * ||A||_1 (see internal::singularity_threshold).
+ */
+template <class MatrixType>
+void lu_decomposition(MatrixType& A, std::vector<size_t>& pivots)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using ScalarType = typename M::ScalarType;
+  using RealType = typename M::RealType;
+  const size_t num_rows = M::rows(A);
+  if (M::cols(A) != num_rows)
+    DUNE_THROW(FMatrixError, "LU decomposition is only implemented for square matrices!");
+  pivots.resize(num_rows);
+  const RealType threshold = internal::singularity_threshold(num_rows, internal::matrix_norm_1(A));
+  for (size_t kk = 0; kk < num_rows; ++kk) {
+    pivots[kk] = internal::partial_pivoting_step(
+        kk,
+        num_rows,
+        threshold,
+        [&](const size_t rr) { return RealType(std::abs(M::get_entry(A, rr, kk))); },
+        [&](const size_t ii, const size_t jj) { internal::swap_rows(A, ii, jj, num_rows); });
+    // eliminate below the diagonal
+    const ScalarType inv_diag = ScalarType(1) / M::get_entry(A, kk, kk);
+    for (size_t rr = kk + 1; rr < num_rows; ++rr) {
+      const ScalarType l_rk = M::get_entry(A, rr, kk) * inv_diag;
+      M::set_entry(A, rr, kk, l_rk);
+      if (l_rk != ScalarType(0))
+        for (size_t cc = kk + 1; cc < num_rows; ++cc)
+          M::add_to_entry(A, rr, cc, -l_rk * M::get_entry(A, kk, cc));
+    }
+  } // kk
+} // void lu_decomposition(...)
+
+
+/**
+ * \brief Solves Ax = b in place (i.e. x contains b on entry) using the output of lu_decomposition.
+ *
+ * Does not check the diagonal of U again, lu_decomposition has already rejected pivots below the singularity
+ * threshold.
+ */
+template <class MatrixType, class VectorType>
+void solve_lu_factorized(const MatrixType& LU, const std::vector<size_t>& pivots, VectorType& x)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using V = Common::VectorAbstraction<VectorType>;
+  using ScalarType = typename V::ScalarType;
+  const size_t num_rows = M::rows(LU);
+  // apply P
+  for (size_t kk = 0; kk < num_rows; ++kk) {
+    if (pivots[kk] != kk) {
+      const ScalarType tmp = V::get_entry(x, kk);
+      V::set_entry(x, kk, V::get_entry(x, pivots[kk]));
+      V::set_entry(x, pivots[kk], tmp);
+    }
+  }
+  // solve Ly = Pb, L has unit diagonal
+  for (size_t rr = 1; rr < num_rows; ++rr) {
+    ScalarType sum(0);
+    for (size_t cc = 0; cc < rr; ++cc)
+      sum += M::get_entry(LU, rr, cc) * V::get_entry(x, cc);
+    V::add_to_entry(x, rr, -sum);
+  }
+  // solve Ux = y
+  for (size_t rr = num_rows - 1; rr < num_rows; --rr) {
+    ScalarType sum = V::get_entry(x, rr);
+    for (size_t cc = rr + 1; cc < num_rows; ++cc)
+      sum -= M::get_entry(LU, rr, cc) * V::get_entry(x, cc);
+    V::set_entry(x, rr, sum / M::get_entry(LU, rr, rr));
+  }
+} // void solve_lu_factorized(...)
+
+
+/**
+ * \brief Inverts A in place by Gauss-Jordan elimination with partial (row) pivoting.
+ *
+ * Needs no memory apart from pivots, which is only resized if it does not have the right size yet, so repeated
+ * inversions of matrices of the same size do not allocate.
+ * \throws FMatrixError if A is not square or numerically singular, i.e. if a pivot is not larger than
+ *         n * epsilon * ||A||_1 (see internal::singularity_threshold).
+ */
+template <class MatrixType>
+void invert_in_place(MatrixType& A, std::vector<size_t>& pivots)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using ScalarType = typename M::ScalarType;
+  using RealType = typename M::RealType;
+  const size_t size = M::rows(A);
+  if (M::cols(A) != size)
+    DUNE_THROW(FMatrixError, "Gauss-Jordan inversion is only implemented for square matrices!");
+  pivots.resize(size);
+  const RealType threshold = internal::singularity_threshold(size, internal::matrix_norm_1(A));
+  for (size_t kk = 0; kk < size; ++kk) {
+    pivots[kk] = internal::partial_pivoting_step(
+        kk,
+        size,
+        threshold,
+        [&](const size_t rr) { return RealType(std::abs(M::get_entry(A, rr, kk))); },
+        [&](const size_t ii, const size_t jj) { internal::swap_rows(A, ii, jj, size); });
+    // the kk-th column of the identity is stored in place of the kk-th column of A
+    const ScalarType inv_diag = ScalarType(1) / M::get_entry(A, kk, kk);
+    M::set_entry(A, kk, kk, ScalarType(1));
+    for (size_t cc = 0; cc < size; ++cc)
+      M::set_entry(A, kk, cc, M::get_entry(A, kk, cc) * inv_diag);
+    for (size_t rr = 0; rr < size; ++rr) {
+      const ScalarType factor = M::get_entry(A, rr, kk);
+      if (rr == kk || factor == ScalarType(0))
+        continue;
+      M::set_entry(A, rr, kk, ScalarType(0));
+      for (size_t cc = 0; cc < size; ++cc)
+        M::add_to_entry(A, rr, cc, -factor * M::get_entry(A, kk, cc));
+    }
+  } // kk
+  // undo the row swaps, which amounts to swapping the columns of the inverse in reverse order
+  for (size_t kk = size - 1; kk < size; --kk)
+    if (pivots[kk] != kk)
+      for (size_t rr = 0; rr < size; ++rr) {
+        const ScalarType tmp = M::get_entry(A, rr, kk);
+        M::set_entry(A, rr, kk, M::get_entry(A, rr, pivots[kk]));
+        M::set_entry(A, rr, pivots[kk], tmp);
+      }
+} // void invert_in_place(...)
+
+
+/**
+ * \brief Blocked LU decomposition with partial (row) pivoting PA = LU, storing the factors for repeated solves.
+ *
+ * factorize() copies A to a column-major buffer and factorizes it in place by a right-looking blocked algorithm: each
+ * panel of block_size columns is factorized column by column, the corresponding block row of U is computed by a
+ * triangular solve and the trailing submatrix is updated by a single gemm (which uses BLAS or is multithreaded with
+ * TBB, if available). The factors can then be applied to any number of vectors or matrices (in the latter case, the
+ * triangular solves are blocked as well). The storage of L, U and the pivots is the same as for lu_decomposition.
+ */
+template <class ScalarImp = double>
+class DenseLuFactorization
+{
+public:
+  using ScalarType = ScalarImp;
+  using RealType = typename Dune::FieldTraits<ScalarType>::real_type;
+
+  DenseLuFactorization()
+    : size_(0)
+    , block_size_(64)
+    , norm_1_(0)
+    , condition_estimate_(-1)
+  {}
+
+  template <class MatrixType>
+  explicit DenseLuFactorization(const MatrixType& A, const size_t block_size = 64)
+    : DenseLuFactorization()
+  {
+    factorize(A, block_size);
+  }
+
+  /**
+   * \brief Computes the factorization of A.
+   * \throws FMatrixError if A is numerically singular, i.e. if a pivot is not larger than n * epsilon * ||A||_1 (see
+   *         internal::singularity_threshold).
+   */
+  template <class MatrixType>
+  void factorize(const MatrixType& A, const size_t block_size = 64)
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    if (M::rows(A) != M::cols(A))
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "Matrix has to be square!\n   rows = " << M::rows(A) << "\n   cols = " << M::cols(A));
+    size_ = M::rows(A);
+    block_size_ = std::max(block_size, size_t(1));
+    values_.resize(size_ * size_);
+    pivots_.resize(size_);
+    norm_1_ = 0;
+    condition_estimate_ = -1;
+    for (size_t jj = 0; jj < size_; ++jj) {
+      RealType column_sum = 0;
+      for (size_t ii = 0; ii < size_; ++ii) {
+        entry(ii, jj) = M::get_entry(A, ii, jj);
+        column_sum += std::abs(entry(ii, jj));
+      }
+      norm_1_ = std::max(norm_1_, column_sum);
+    }
+    const size_t n = size_;
+    const RealType threshold = internal::singularity_threshold(n, norm_1_);
+    for (size_t kb = 0; kb < n; kb += block_size_) {
+      const size_t bs = std::min(block_size_, n - kb);
+      // factorize the panel, swapping whole rows
+      for (size_t kk = kb; kk < kb + bs; ++kk) {
+        pivots_[kk] = internal::partial_pivoting_step(
+            kk,
+            n,
+            threshold,
+            [&](const size_t rr) { return RealType(std::abs(entry(rr, kk))); },
+            [&](const size_t ii, const size_t jj) {
+              for (size_t cc = 0; cc < n; ++cc)
+                std::swap(entry(ii, cc), entry(jj, cc));
+            });
+        const ScalarType inv_diag = ScalarType(1) / entry(kk, kk);
+        for (size_t rr = kk + 1; rr < n; ++rr)
+          entry(rr, kk) *= inv_diag;
+        for (size_t cc = kk + 1; cc < kb + bs; ++cc) {
+          const ScalarType u_kc = entry(kk, cc);
+          for (size_t rr = kk + 1; rr < n; ++rr)
+            entry(rr, cc) -= entry(rr, kk) * u_kc;
+        }
+      } // kk
+      const size_t trailing = n - kb - bs;
+      if (trailing == 0)
+        break;
+      // U_12 = L_11^{-1} A_12
+      for (size_t cc = kb + bs; cc < n; ++cc)
+        for (size_t kk = kb; kk < kb + bs; ++kk)
+          for (size_t rr = kk + 1; rr < kb + bs; ++rr)
+            entry(rr, cc) -= entry(rr, kk) * entry(kk, cc);
+      // A_22 -= L_21 U_12
+      gemm(trailing,
+           trailing,
+           bs,
+           ScalarType(-1),
+           &entry(kb + bs, kb),
+           1,
+           n,
+           &entry(kb, kb + bs),
+           1,
+           n,
+           ScalarType(1),
+           &entry(kb + bs, kb + bs),
+           1,
+           n);
+    } // kb
+  } // ... factorize(...)
+
+  /**
+   * \brief Solves Ax = b in place (i.e. x contains b on entry).
+   */
+  template <class VectorType>
+  std::enable_if_t<Common::is_vector<VectorType>::value, void> apply(VectorType& x) const
+  {
+    using V = Common::VectorAbstraction<VectorType>;
+    check_size(V::size(x));
+    std::vector<ScalarType> work(size_);
+    for (size_t ii = 0; ii < size_; ++ii)
+      work[ii] = V::get_entry(x, ii);
+    solve(work.data(), 1);
+    for (size_t ii = 0; ii < size_; ++ii)
+      V::set_entry(x, ii, work[ii]);
+  } // ... apply(...)
+
+  /**
+   * \brief Solves AX = B for all columns of B at once.
+   */
+  template <class RhsMatrixType, class SolutionMatrixType>
+  std::enable_if_t<Common::is_matrix<RhsMatrixType>::value && Common::is_matrix<SolutionMatrixType>::value, void>
+  apply(const RhsMatrixType& B, SolutionMatrixType& X) const
+  {
+    using MB = Common::MatrixAbstraction<RhsMatrixType>;
+    using MX = Common::MatrixAbstraction<SolutionMatrixType>;
+    check_size(MB::rows(B));
+    const size_t num_rhs = MB::cols(B);
+    if (MX::rows(X) != size_ || MX::cols(X) != num_rhs)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "X has to be a " << size_ << "x" << num_rhs << " matrix, but is " << MX::rows(X) << "x"
+                                  << MX::cols(X) << "!");
+    std::vector<ScalarType> work(size_ * num_rhs);
+    for (size_t cc = 0; cc < num_rhs; ++cc)
+      for (size_t ii = 0; ii < size_; ++ii)
+        work[ii + cc * size_] = MB::get_entry(B, ii, cc);
+    solve(work.data(), num_rhs);
+    for (size_t cc = 0; cc < num_rhs; ++cc)
+      for (size_t ii = 0; ii < size_; ++ii)
+        MX::set_entry(X, ii, cc, work[ii + cc * size_]);
+  } // ... apply(...)
+
+  /**
+   * \brief Computes x = A^{-1} rhs.
+   */
+  template <class VectorType>
+  std::enable_if_t<Common::is_vector<VectorType>::value, void> apply(const VectorType& rhs, VectorType& x) const
+  {
+    x = rhs;
+    apply(x);
+  }
+
+  /**
+   * \brief Estimate of the condition number ||A||_1 ||A^{-1}||_1 (a lower bound, usually accurate within a factor of
+   *        3), see internal::hager_condition_estimate. Costs a few solves on the first call, the result is kept until
+   *        the next factorization.
+   */
+  RealType condition_estimate() const
+  {
+    if (condition_estimate_ >= 0)
+      return condition_estimate_;
+    condition_estimate_ = internal::hager_condition_estimate<ScalarType>(
+        size_,
+        norm_1_,
+        [&](std::vector<ScalarType>& x) { solve(x.data(), 1); },
+        [&](std::vector<ScalarType>& x) { solve_adjoint(x.data()); });
+    return condition_estimate_;
+  } // ... condition_estimate(...)
+
+  size_t rows() const
+  {
+    return size_;
+  }
+
+  //! In step kk of the factorization, row kk was swapped with row pivots()[kk].
+  const std::vector<size_t>& pivots() const
+  {
+    return pivots_;
+  }
+
+private:
+  ScalarType& entry(const size_t ii, const size_t jj)
+  {
+    return values_[ii + jj * size_];
+  }
+
+  const ScalarType& entry(const size_t ii, const size_t jj) const
+  {
+    return values_[ii + jj * size_];
+  }
+
+  void check_size(const size_t size) const
+  {
+    if (size != size_)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match, "size of rhs = " << size << ", size of A = " << size_);
+  }
+
+  // solves in place for the num_rhs columns of the column-major n x num_rhs matrix B
+  void solve(ScalarType* B, const size_t num_rhs) const
+  {
+    const size_t n = size_;
+    if (n == 0)
+      return;
+    for (size_t kk = 0; kk < n; ++kk)
+      if (pivots_[kk] != kk)
+        for (size_t cc = 0; cc < num_rhs; ++cc)
+          std::swap(B[kk + cc * n], B[pivots_[kk] + cc * n]);
+    // for a few right hand sides, the unblocked substitutions are faster than the gemm calls
+    const size_t block_size = num_rhs < 8 ? n : block_size_;
+    // L Y = P B, L has unit diagonal
+    for (size_t kb = 0; kb < n; kb += block_size) {
+      const size_t bs = std::min(block_size, n - kb);
+      for (size_t cc = 0; cc < num_rhs; ++cc) {
+        ScalarType* b = B + cc * n;
+        for (size_t jj = kb; jj < kb + bs; ++jj)
+          for (size_t rr = jj + 1; rr < kb + bs; ++rr)
+            b[rr] -= entry(rr, jj) * b[jj];
+      }
+      if (kb + bs < n)
+        gemm(n - kb - bs,
+             num_rhs,
+             bs,
+             ScalarType(-1),
+             &entry(kb + bs, kb),
+             1,
+             n,
+             B + kb,
+             1,
+             n,
+             ScalarType(1),
+             B + kb + bs,
+             1,
+             n);
+    }
+    // U X = Y
+    for (size_t kb = ((n - 1) / block_size) * block_size; kb < n; kb -= block_size) {
+      const size_t bs = std::min(block_size, n - kb);
+      for (size_t cc = 0; cc < num_rhs; ++cc) {
+        ScalarType* b = B + cc * n;
+        for (size_t jj = kb + bs - 1; jj + 1 > kb; --jj) {
+          b[jj] /= entry(jj, jj);
+          for (size_t rr = kb; rr < jj; ++rr)
+            b[rr] -= entry(rr, jj) * b[jj];
+        }
+      }
+      gemm(kb, num_rhs, bs, ScalarType(-1), &entry(0, kb), 1, n, B + kb, 1, n, ScalarType(1), B, 1, n);
+    }
+  } // ... solve(...)
+
+  // solves A^H x = b in place, i.e. U^H L^H P x = b
+  void solve_adjoint(ScalarType* x) const
+  {
+    const size_t n = size_;
+    for (size_t jj = 0; jj < n; ++jj) {
+      ScalarType sum = x[jj];
+      for (size_t rr = 0; rr < jj; ++rr)
+        sum -= Common::conj(entry(rr, jj)) * x[rr];
+      x[jj] = sum / Common::conj(entry(jj, jj));
+    }
+    for (size_t jj = n - 1; jj < n; --jj)
+      for (size_t rr = jj + 1; rr < n; ++rr)
+        x[jj] -= Common::conj(entry(rr, jj)) * x[rr];
+    for (size_t kk = n - 1; kk < n; --kk)
+      if (pivots_[kk] != kk)
+        std::swap(x[kk], x[pivots_[kk]]);
+  } // ... solve_adjoint(...)
+
+  size_t size_;
+  size_t block_size_;
+  RealType norm_1_;
+  mutable RealType condition_estimate_;
+  // column-major, L below and U on and above the diagonal
+  std::vector<ScalarType> values_;
+  std::vector<size_t> pivots_;
+}; // class DenseLuFactorization
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_LU_HH
@@ -12,6 +12,8 @@
 #define DUNE_XT_LA_ALGORITHMS_QR_HH
 
 #include <complex>
+#include <limits>
+#include <vector>
 
 #include <dune/xt/common/lapacke.hh>
 #include <dune/xt/common/fmatrix.hh>
@@ -19,6 +21,9 @@
 #include <dune/xt/common/matrix.hh>
 #include <dune/xt/common/vector.hh>
 
+#include <dune/xt/la/algorithms/condition_estimate.hh>
+#include <dune/xt/la/algorithms/gemm.hh>
+#include <dune/xt/la/algorithms/static_size_kernels.hh>
 #include <dune/xt/la/algorithms/triangular_solves.hh>
 #include <dune/xt/la/container/eye-matrix.hh>
 
@@ -130,7 +135,8 @@ std::complex<T> get_s(std::complex<T> val)
  * \see http://www.cs.cornell.edu/~bindel/class/cs6210-f09/lec18.pdf
  */
 template <class MatrixType, class VectorType, class IndexVectorType>
-void qr_decomposition(MatrixType& A, VectorType& tau, IndexVectorType& permutations)
+std::enable_if_t<!is_small_field_matrix<MatrixType>::value, void>
+qr_decomposition(MatrixType& A, VectorType& tau, IndexVectorType& permutations)
 {
   using M = typename Common::MatrixAbstraction<MatrixType>;
   using V = typename Common::VectorAbstraction<VectorType>;
@@ -156,7 +162,8 @@ void qr_decomposition(MatrixType& A, VectorType& tau, IndexVectorType& permutati
 
   auto w = W::create(num_rows, ScalarType(0.));
 
-  for (size_t jj = 0; jj < num_cols - 1; ++jj) {
+  // the last column of a square matrix needs no reflection, but all columns of a matrix with more rows than columns do
+  for (size_t jj = 0; jj < num_cols && jj + 1 < num_rows; ++jj) {
 
     // Pivoting
     // swap column jj and column with greatest norm
@@ -204,6 +211,14 @@ void qr_decomposition(MatrixType& A, VectorType& tau, IndexVectorType& permutati
   } // jj
 } // void qr_decomposition(...)
 
+// fully unrolled variant for small FieldMatrix types
+template <class MatrixType, class VectorType, class IndexVectorType>
+std::enable_if_t<is_small_field_matrix<MatrixType>::value, void>
+qr_decomposition(MatrixType& A, VectorType& tau, IndexVectorType& permutations)
+{
+  static_qr(static_cast<typename is_small_field_matrix<MatrixType>::FieldMatrixType&>(A), tau, permutations);
+}
+
 // specialization for BlockedFieldMatrix
 template <class FieldType,
           size_t num_blocks,
@@ -230,6 +245,245 @@ void qr_decomposition(XT::Common::BlockedFieldMatrix<FieldType, num_blocks, bloc
   }
 }
 
+// Copies the matrix A to a column-major buffer.
+template <class MatrixType, class ScalarType>
+void copy_to_column_major(const MatrixType& A, std::vector<ScalarType>& buffer)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  const size_t num_rows = M::rows(A);
+  buffer.resize(num_rows * M::cols(A));
+  for (size_t cc = 0; cc < M::cols(A); ++cc)
+    for (size_t rr = 0; rr < num_rows; ++rr)
+      buffer[rr + cc * num_rows] = M::get_entry(A, rr, cc);
+}
+
+// Copies a column-major buffer back to the matrix A.
+template <class MatrixType, class ScalarType>
+void copy_from_column_major(const std::vector<ScalarType>& buffer, MatrixType& A)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  const size_t num_rows = M::rows(A);
+  for (size_t rr = 0; rr < num_rows; ++rr)
+    for (size_t cc = 0; cc < M::cols(A); ++cc)
+      M::set_entry(A, rr, cc, buffer[rr + cc * num_rows]);
+}
+
+/**
+ * \brief Compact WY representation of a block of Householder reflections.
+ *
+ * For the reflections H_jj = I - tau_jj w_jj w_jj^H, jj = first, ..., first + nb - 1, stored as in qr_decomposition in
+ * the column-major num_rows x num_cols matrix QR, computes V and T such that H_first ... H_{first+nb-1} = I - V T V^H.
+ * V is the column-major (num_rows - first) x nb matrix [w_first, ..., w_{first+nb-1}] (restricted to the rows
+ * first, ..., num_rows - 1, including the unit diagonal) and T is upper triangular and stored column-major. If
+ * conjugate is true, conj(tau_jj) is used instead of tau_jj, i.e. H_first^H ... H_{first+nb-1}^H = I - V T V^H.
+ */
+template <class ScalarType>
+void compute_wy_block(const std::vector<ScalarType>& QR,
+                      const size_t num_rows,
+                      const std::vector<ScalarType>& tau,
+                      const size_t first,
+                      const size_t nb,
+                      const bool conjugate,
+                      std::vector<ScalarType>& V,
+                      std::vector<ScalarType>& T)
+{
+  const size_t block_rows = num_rows - first;
+  V.assign(block_rows * nb, ScalarType(0));
+  for (size_t jj = 0; jj < nb; ++jj) {
+    V[jj + jj * block_rows] = ScalarType(1);
+    for (size_t rr = jj + 1; rr < block_rows; ++rr)
+      V[rr + jj * block_rows] = QR[first + rr + (first + jj) * num_rows];
+  }
+  T.assign(nb * nb, ScalarType(0));
+  std::vector<ScalarType> VH_v(nb);
+  for (size_t jj = 0; jj < nb; ++jj) {
+    const ScalarType tau_jj = conjugate ? Common::conj(tau[first + jj]) : tau[first + jj];
+    // T(0:jj, jj) = -tau_jj T(0:jj, 0:jj) V(:, 0:jj)^H w_jj, where w_jj vanishes above row jj
+    for (size_t ii = 0; ii < jj; ++ii) {
+      VH_v[ii] = ScalarType(0);
+      for (size_t rr = jj; rr < block_rows; ++rr)
+        VH_v[ii] += Common::conj(V[rr + ii * block_rows]) * V[rr + jj * block_rows];
+    }
+    for (size_t ii = 0; ii < jj; ++ii) {
+      ScalarType sum(0);
+      for (size_t ll = ii; ll < jj; ++ll)
+        sum += T[ii + ll * nb] * VH_v[ll];
+      T[ii + jj * nb] = -tau_jj * sum;
+    }
+    T[jj + jj * nb] = tau_jj;
+  }
+} // ... compute_wy_block(...)
+
+// Calculates C = (I - V T V^H) C (or C = (I - V T^H V^H) C, if transpose_T is true) for the column-major
+// block_rows x num_rhs matrix C with leading dimension ldc, using two gemms and a triangular multiplication.
+template <class ScalarType>
+void apply_wy_block(const std::vector<ScalarType>& V,
+                    const std::vector<ScalarType>& T,
+                    const size_t block_rows,
+                    const size_t nb,
+                    const bool transpose_T,
+                    ScalarType* C,
+                    const size_t ldc,
+                    const size_t num_rhs)
+{
+  if (num_rhs == 0)
+    return;
+  // W = V^H C
+  std::vector<ScalarType> VH(nb * block_rows);
+  for (size_t jj = 0; jj < nb; ++jj)
+    for (size_t rr = 0; rr < block_rows; ++rr)
+      VH[jj * block_rows + rr] = Common::conj(V[rr + jj * block_rows]);
+  std::vector<ScalarType> W(nb * num_rhs);
+  gemm(nb, num_rhs, block_rows, ScalarType(1), VH.data(), block_rows, 1, C, 1, ldc, ScalarType(0), W.data(), 1, nb);
+  // W = T W or W = T^H W (in place, the order of the rows ensures that only old values of W are used)
+  for (size_t cc = 0; cc < num_rhs; ++cc) {
+    ScalarType* w = W.data() + cc * nb;
+    if (!transpose_T) {
+      for (size_t ii = 0; ii < nb; ++ii) {
+        ScalarType sum(0);
+        for (size_t ll = ii; ll < nb; ++ll)
+          sum += T[ii + ll * nb] * w[ll];
+        w[ii] = sum;
+      }
+    } else {
+      for (size_t ii = nb; ii-- > 0;) {
+        ScalarType sum(0);
+        for (size_t ll = 0; ll <= ii; ++ll)
+          sum += Common::conj(T[ll + ii * nb]) * w[ll];
+        w[ii] = sum;
+      }
+    }
+  }
+  // C = C - V W
+  gemm(block_rows, num_rhs, nb, ScalarType(-1), V.data(), 1, block_rows, W.data(), 1, nb, ScalarType(1), C, 1, ldc);
+} // ... apply_wy_block(...)
+
+/**
+ * \brief Blocked version of qr_decomposition without pivoting, working on a column-major buffer.
+ *
+ * Each block of block_size columns (the panel) is factorized column by column, the reflections are only applied to the
+ * panel. The trailing columns are then updated at once using the compact WY representation of the panel.
+ */
+template <class ScalarType>
+void blocked_qr_decomposition(std::vector<ScalarType>& A,
+                              const size_t num_rows,
+                              const size_t num_cols,
+                              std::vector<ScalarType>& tau,
+                              const size_t block_size)
+{
+  using RealType = typename Dune::FieldTraits<ScalarType>::real_type;
+  const size_t num_reflections = std::min(num_rows, num_cols);
+  tau.assign(num_cols, ScalarType(0));
+  std::vector<ScalarType> V, T;
+  for (size_t kk = 0; kk < num_reflections; kk += block_size) {
+    const size_t nb = std::min(block_size, num_reflections - kk);
+    // panel factorization
+    for (size_t jj = kk; jj < kk + nb; ++jj) {
+      ScalarType* a_jj = A.data() + jj * num_rows;
+      RealType sigma(0);
+      for (size_t rr = jj + 1; rr < num_rows; ++rr)
+        sigma += std::pow(std::abs(a_jj[rr]), 2);
+      if (sigma == 0.)
+        continue; // H_jj = I
+      const RealType normx = std::sqrt(std::pow(std::abs(a_jj[jj]), 2) + sigma);
+      const auto s = get_s(a_jj[jj]);
+      const ScalarType u1 = a_jj[jj] - s * normx;
+      for (size_t rr = jj + 1; rr < num_rows; ++rr)
+        a_jj[rr] /= u1;
+      a_jj[jj] = s * normx;
+      tau[jj] = static_cast<ScalarType>(-s) * Common::conj(u1) / normx;
+      for (size_t cc = jj + 1; cc < kk + nb; ++cc) {
+        ScalarType* a_cc = A.data() + cc * num_rows;
+        ScalarType wH_a = a_cc[jj];
+        for (size_t rr = jj + 1; rr < num_rows; ++rr)
+          wH_a += Common::conj(a_jj[rr]) * a_cc[rr];
+        a_cc[jj] -= tau[jj] * wH_a;
+        for (size_t rr = jj + 1; rr < num_rows; ++rr)
+          a_cc[rr] -= tau[jj] * wH_a * a_jj[rr];
+      }
+    } // jj
+    // trailing update A(kk:, kk+nb:) = H_{kk+nb-1} ... H_kk A(kk:, kk+nb:)
+    if (kk + nb < num_cols) {
+      compute_wy_block(A, num_rows, tau, kk, nb, true, V, T);
+      apply_wy_block(V, T, num_rows - kk, nb, true, A.data() + kk + (kk + nb) * num_rows, num_rows, num_cols - kk - nb);
+    }
+  } // kk
+} // ... blocked_qr_decomposition(...)
+
+// Calculates C = Q C or C = Q^T C for the column-major num_rows x num_rhs matrix C, where Q is given by the first
+// num_reflections columns of the column-major QR and tau (as in QrHelper::apply_q_from_qr).
+template <Common::Transpose transpose, class ScalarType>
+void apply_q_blocked(const std::vector<ScalarType>& QR,
+                     const size_t num_rows,
+                     const size_t num_reflections,
+                     const std::vector<ScalarType>& tau,
+                     const size_t block_size,
+                     std::vector<ScalarType>& C,
+                     const size_t num_rhs)
+{
+  std::vector<ScalarType> V, T;
+  const size_t num_blocks = (num_reflections + block_size - 1) / block_size;
+  for (size_t bb = 0; bb < num_blocks; ++bb) {
+    // Q = H_0 ... H_{k-1} is applied starting with the last block, Q^T starting with the first block
+    const size_t kk = (transpose == Common::Transpose::no ? num_blocks - 1 - bb : bb) * block_size;
+    const size_t nb = std::min(block_size, num_reflections - kk);
+    const bool transposed = (transpose == Common::Transpose::yes);
+    compute_wy_block(QR, num_rows, tau, kk, nb, transposed, V, T);
+    apply_wy_block(V, T, num_rows - kk, nb, transposed, C.data() + kk, num_rows, num_rhs);
+  }
+} // ... apply_q_blocked(...)
+
+// Solves R x = b (adjoint == false) or R^H x = b (adjoint == true) in place (x contains b on entry), where R is the
+// upper triangular part of the column-major size x size matrix R.
+template <class ScalarType>
+void solve_upper_triangular_in_place(const std::vector<ScalarType>& R,
+                                     const size_t size,
+                                     std::vector<ScalarType>& x,
+                                     const bool adjoint)
+{
+  if (adjoint) {
+    for (size_t ii = 0; ii < size; ++ii) {
+      for (size_t kk = 0; kk < ii; ++kk)
+        x[ii] -= Common::conj(R[kk + ii * size]) * x[kk];
+      x[ii] /= Common::conj(R[ii + ii * size]);
+    }
+  } else {
+    for (size_t jj = size; jj-- > 0;) {
+      x[jj] /= R[jj + jj * size];
+      for (size_t ii = 0; ii < jj; ++ii)
+        x[ii] -= R[ii + jj * size] * x[jj];
+    }
+  }
+} // ... solve_upper_triangular_in_place(...)
+
+// Computes the Givens rotation G = [c s; -s c] with G [a; b] = [r; 0], applies it to the rows ii and ii + 1 of R
+// (starting at column first_col) and G^T to the columns ii and ii + 1 of Q, such that Q R is unchanged.
+template <class MatrixType, class SecondMatrixType, class ScalarType>
+void apply_givens_rotation(
+    MatrixType& Q, SecondMatrixType& R, const size_t ii, const size_t first_col, const ScalarType a, const ScalarType b)
+{
+  using MQ = Common::MatrixAbstraction<MatrixType>;
+  using MR = Common::MatrixAbstraction<SecondMatrixType>;
+  if (b == ScalarType(0))
+    return;
+  const ScalarType r = std::hypot(a, b);
+  const ScalarType c = a / r;
+  const ScalarType s = b / r;
+  for (size_t jj = first_col; jj < MR::cols(R); ++jj) {
+    const ScalarType upper = MR::get_entry(R, ii, jj);
+    const ScalarType lower = MR::get_entry(R, ii + 1, jj);
+    MR::set_entry(R, ii, jj, c * upper + s * lower);
+    MR::set_entry(R, ii + 1, jj, c * lower - s * upper);
+  }
+  for (size_t kk = 0; kk < MQ::rows(Q); ++kk) {
+    const ScalarType left = MQ::get_entry(Q, kk, ii);
+    const ScalarType right = MQ::get_entry(Q, kk, ii + 1);
+    MQ::set_entry(Q, kk, ii, c * left + s * right);
+    MQ::set_entry(Q, kk, ii + 1, c * right - s * left);
+  }
+} // ... apply_givens_rotation(...)
+
+
 template <class MatrixType,
           class VectorType,
           class IndexVectorType = std::vector<int>,
@@ -323,6 +577,8 @@ struct QrHelper
     using V3 = Common::VectorAbstraction<ThirdVectorType>;
     const size_t num_rows = M::rows(QR);
     const size_t num_cols = M::cols(QR);
+    // Q is the product of min(num_rows, num_cols) Householder reflections, also for wide matrices
+    const size_t num_reflections = std::min(num_rows, num_cols);
     for (size_t ii = 0; ii < M::rows(QR); ++ii)
       V3::set_entry(y, ii, V2::get_entry(x, ii));
     if (false) {
@@ -338,9 +594,9 @@ struct QrHelper
                                 transpose == XT::Common::Transpose::yes ? 'T' : 'N',
                                 num_rhs_rows,
                                 num_rhs_cols,
-                                static_cast<int>(num_rows),
+                                static_cast<int>(num_reflections),
                                 M::data(QR),
-                                num_rhs_rows,
+                                is_row_major ? static_cast<int>(num_cols) : num_rhs_rows,
                                 V::data(tau),
                                 V3::data(y),
                                 is_row_major ? num_rhs_cols : num_rhs_rows);
@@ -351,12 +607,12 @@ struct QrHelper
       assert(num_cols < std::numeric_limits<int>::max());
       auto w = W::create(num_rows, ScalarType(0.));
       if (transpose == XT::Common::Transpose::no)
-        for (int jj = static_cast<int>(num_cols) - 1; jj >= 0; --jj) {
+        for (int jj = static_cast<int>(num_reflections) - 1; jj >= 0; --jj) {
           set_w_vector(QR, jj, w);
           multiply_householder_from_left(y, tau[jj], w, jj, num_rows);
         }
       else
-        for (int jj = 0; jj < static_cast<int>(num_cols); ++jj) {
+        for (int jj = 0; jj < static_cast<int>(num_reflections); ++jj) {
           set_w_vector(QR, jj, w);
           multiply_householder_from_left(y, tau[jj], w, jj, num_rows);
         }
@@ -500,17 +756,88 @@ qr(MatrixType& A, VectorType& tau, IndexVectorType& permutations)
   internal::QrHelper<MatrixType, VectorType, IndexVectorType>::qr(A, tau, permutations);
 } // void solve_lower_triangular(...)
 
+/**
+ * \brief Performs a blocked QR factorization A = QR without pivoting.
+ *
+ * The columns of A are processed in blocks of block_size columns. Each block is factorized using Householder
+ * reflections, which are then applied to the remaining columns at once using their compact WY representation
+ * I - V T V^H, i.e., using matrix-matrix products. A is copied to a column-major buffer, so this works for all dense
+ * matrices and does not require LAPACKE. The result is stored as in qr (with permutations set to the identity), so
+ * apply_q_from_qr, calculate_q_from_qr and solve_qr_factorized can be used afterwards.
+ * \note In contrast to qr, the columns are not pivoted, so R does not reveal the rank of A.
+ */
+template <class MatrixType, class VectorType, class IndexVectorType>
+typename std::enable_if_t<Common::is_matrix<MatrixType>::value, void>
+blocked_qr(MatrixType& A, VectorType& tau, IndexVectorType& permutations, const size_t block_size = 32)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using V = Common::VectorAbstraction<VectorType>;
+  using VI = Common::VectorAbstraction<IndexVectorType>;
+  using IndexType = typename VI::ScalarType;
+  using ScalarType = typename M::ScalarType;
+  if (block_size == 0)
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "block_size has to be positive!");
+  const size_t num_rows = M::rows(A);
+  const size_t num_cols = M::cols(A);
+  assert(tau.size() == num_cols && permutations.size() == num_cols);
+  std::vector<ScalarType> buffer, tau_buffer;
+  internal::copy_to_column_major(A, buffer);
+  internal::blocked_qr_decomposition(buffer, num_rows, num_cols, tau_buffer, block_size);
+  internal::copy_from_column_major(buffer, A);
+  for (size_t jj = 0; jj < num_cols; ++jj) {
+    V::set_entry(tau, jj, tau_buffer[jj]);
+    VI::set_entry(permutations, jj, static_cast<IndexType>(jj));
+  }
+} // ... blocked_qr(...)
+
 // calculate y =  Q * x or y = Q^T * x where Q is from the qr decomposition A = QR
 template <Common::Transpose transpose,
           class MatrixType,
           class VectorType,
           class SecondVectorType,
           class ThirdVectorType>
-void apply_q_from_qr(const MatrixType& QR, const VectorType& tau, const SecondVectorType& x, ThirdVectorType& y)
+std::enable_if_t<!Common::is_matrix<SecondVectorType>::value, void>
+apply_q_from_qr(const MatrixType& QR, const VectorType& tau, const SecondVectorType& x, ThirdVectorType& y)
 {
   internal::QrHelper<MatrixType, VectorType>::template apply_q_from_qr<transpose>(QR, tau, x, y);
 }
 
+// calculate Y = Q * X or Y = Q^T * X for all columns of X at once, where Q is from the qr decomposition A = QR
+// (the reflections are applied in blocks of block_size using their compact WY representation)
+// \note For complex matrices, the reflections are expected in the form computed by qr_decomposition or blocked_qr.
+template <Common::Transpose transpose,
+          class MatrixType,
+          class VectorType,
+          class SecondMatrixType,
+          class ThirdMatrixType>
+std::enable_if_t<Common::is_matrix<SecondMatrixType>::value && Common::is_matrix<ThirdMatrixType>::value, void>
+apply_q_from_qr(const MatrixType& QR,
+                const VectorType& tau,
+                const SecondMatrixType& X,
+                ThirdMatrixType& Y,
+                const size_t block_size = 32)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using V = Common::VectorAbstraction<VectorType>;
+  using M2 = Common::MatrixAbstraction<SecondMatrixType>;
+  using M3 = Common::MatrixAbstraction<ThirdMatrixType>;
+  using ScalarType = typename M::ScalarType;
+  const size_t num_rows = M::rows(QR);
+  if (M2::rows(X) != num_rows || M3::rows(Y) != num_rows || M3::cols(Y) != M2::cols(X))
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "X and Y have to be of the same size and need as many rows as QR (" << num_rows << ")!");
+  if (block_size == 0)
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "block_size has to be positive!");
+  std::vector<ScalarType> QR_buffer, C, tau_buffer(M::cols(QR));
+  internal::copy_to_column_major(QR, QR_buffer);
+  internal::copy_to_column_major(X, C);
+  for (size_t jj = 0; jj < tau_buffer.size(); ++jj)
+    tau_buffer[jj] = V::get_entry(tau, jj);
+  internal::apply_q_blocked<transpose>(
+      QR_buffer, num_rows, std::min(num_rows, M::cols(QR)), tau_buffer, block_size, C, M2::cols(X));
+  internal::copy_from_column_major(C, Y);
+} // ... apply_q_from_qr(...)
+
 // calculate y =  Q * x or y = Q^T * x where Q is from the qr decomposition A = QR
 template <class MatrixType, class VectorType, class M = Common::MatrixAbstraction<MatrixType>>
 typename M::template MatrixTypeTemplate<M::static_rows, M::static_rows> calculate_q_from_qr(const MatrixType& QR,
@@ -533,12 +860,13 @@ void get_permutation_matrix(const IndexVectorType& permutations, MatrixType& P)
  *  \see qr
  */
 template <class MatrixType, class VectorType, class SecondVectorType, class RhsVectorType, class IndexVectorType>
-void solve_qr_factorized(const MatrixType& QR,
-                         const VectorType& tau,
-                         const IndexVectorType& permutations,
-                         SecondVectorType& x,
-                         const RhsVectorType& b,
-                         SecondVectorType* work = nullptr)
+std::enable_if_t<!Common::is_matrix<SecondVectorType>::value, void>
+solve_qr_factorized(const MatrixType& QR,
+                    const VectorType& tau,
+                    const IndexVectorType& permutations,
+                    SecondVectorType& x,
+                    const RhsVectorType& b,
+                    SecondVectorType* work = nullptr)
 {
   using M = Common::MatrixAbstraction<MatrixType>;
   using V2 = Common::VectorAbstraction<SecondVectorType>;
@@ -579,13 +907,265 @@ void solve_qr_factorized(const MatrixType& QR,
     V2::set_entry(x, VI::get_entry(permutations, ii), V2::get_entry(*work, ii));
 }
 
+/**
+ *  \brief Solves AX = B for all columns of B at once, where AP = QR is the QR decomposition.
+ *  Q^T B is computed blockwise (\see apply_q_from_qr), followed by a backward substitution for all columns.
+ *  \see qr
+ */
+template <class MatrixType, class VectorType, class IndexVectorType, class SolutionMatrixType, class RhsMatrixType>
+std::enable_if_t<Common::is_matrix<SolutionMatrixType>::value && Common::is_matrix<RhsMatrixType>::value, void>
+solve_qr_factorized(const MatrixType& QR,
+                    const VectorType& tau,
+                    const IndexVectorType& permutations,
+                    SolutionMatrixType& X,
+                    const RhsMatrixType& B,
+                    const size_t block_size = 32)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using V = Common::VectorAbstraction<VectorType>;
+  using VI = Common::VectorAbstraction<IndexVectorType>;
+  using MB = Common::MatrixAbstraction<RhsMatrixType>;
+  using MX = Common::MatrixAbstraction<SolutionMatrixType>;
+  using ScalarType = typename M::ScalarType;
+
+  const size_t num_rows = M::rows(QR);
+  if (M::cols(QR) != num_rows)
+    DUNE_THROW(NotImplemented, "Not implemented for non-square matrices!");
+  const size_t num_rhs = MB::cols(B);
+  if (MB::rows(B) != num_rows || MX::rows(X) != num_rows || MX::cols(X) != num_rhs)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "X and B have to be of the same size and need as many rows as QR (" << num_rows << ")!");
+  if (block_size == 0)
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "block_size has to be positive!");
+
+  // Calculate C = Q^T B
+  std::vector<ScalarType> QR_buffer, C, tau_buffer(num_rows);
+  internal::copy_to_column_major(QR, QR_buffer);
+  internal::copy_to_column_major(B, C);
+  for (size_t jj = 0; jj < num_rows; ++jj)
+    tau_buffer[jj] = V::get_entry(tau, jj);
+  internal::apply_q_blocked<Common::Transpose::yes>(QR_buffer, num_rows, num_rows, tau_buffer, block_size, C, num_rhs);
+
+  // Solve R Y = C, Y is stored in C
+  for (size_t ii = num_rows; ii-- > 0;) {
+    const ScalarType diag = QR_buffer[ii + ii * num_rows];
+    if (diag == ScalarType(0))
+      DUNE_THROW(Dune::MathError, "Triangular solve failed, matrix is singular!");
+    for (size_t cc = 0; cc < num_rhs; ++cc) {
+      ScalarType* c = C.data() + cc * num_rows;
+      for (size_t jj = ii + 1; jj < num_rows; ++jj)
+        c[ii] -= QR_buffer[ii + jj * num_rows] * c[jj];
+      c[ii] /= diag;
+    }
+  }
+
+  // Undo permutations
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    for (size_t cc = 0; cc < num_rhs; ++cc)
+      MX::set_entry(X, static_cast<size_t>(VI::get_entry(permutations, ii)), cc, C[ii + cc * num_rows]);
+} // ... solve_qr_factorized(...)
+
+/**
+ *  \brief Numerical rank of A, where AP = QR is the QR decomposition with column pivoting computed by qr.
+ *  Due to the pivoting, the diagonal entries of R are (approximately) non-increasing in magnitude, so the rank is
+ *  estimated as the number of leading diagonal entries with |R_ii| > tolerance * |R_00|. If tolerance is not
+ *  positive, max(rows, cols) times the machine epsilon is used.
+ *  \note Only meaningful for pivoted factorizations, i.e. not for blocked_qr.
+ */
+template <class MatrixType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value, size_t> qr_rank(const MatrixType& QR, double tolerance = 0.)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using RealType = typename M::RealType;
+  const size_t num_rows = M::rows(QR);
+  const size_t num_cols = M::cols(QR);
+  const size_t size = std::min(num_rows, num_cols);
+  if (size == 0)
+    return 0;
+  if (!(tolerance > 0.))
+    tolerance = std::max(num_rows, num_cols) * std::numeric_limits<RealType>::epsilon();
+  const RealType threshold = tolerance * std::abs(M::get_entry(QR, 0, 0));
+  size_t rank = 0;
+  while (rank < size && std::abs(M::get_entry(QR, rank, rank)) > threshold)
+    ++rank;
+  return rank;
+} // ... qr_rank(...)
+
+/**
+ *  \brief Estimate of the condition number ||R||_1 ||R^{-1}||_1, where AP = QR is the QR decomposition computed by qr
+ *         (for non-square matrices, the leading square part of R is used).
+ *  As Q is unitary, the 2-norm condition numbers of A and R coincide, and the 1-norm condition number of R differs
+ *  from those by at most a factor of the number of columns. Uses internal::hager_condition_estimate, i.e. a few
+ *  triangular solves with R and R^H, the factorization itself is not touched.
+ *  \returns infinity if R is singular.
+ */
+template <class MatrixType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value, typename Common::MatrixAbstraction<MatrixType>::RealType>
+qr_condition_estimate(const MatrixType& QR)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using ScalarType = typename M::ScalarType;
+  using RealType = typename M::RealType;
+  const size_t n = std::min(M::rows(QR), M::cols(QR));
+  if (n == 0)
+    return 0;
+  // copy R to a column-major buffer and compute its 1-norm
+  std::vector<ScalarType> R(n * n, ScalarType(0));
+  RealType norm_1 = 0;
+  for (size_t jj = 0; jj < n; ++jj) {
+    RealType column_sum = 0;
+    for (size_t ii = 0; ii <= jj; ++ii) {
+      R[ii + jj * n] = M::get_entry(QR, ii, jj);
+      column_sum += std::abs(R[ii + jj * n]);
+    }
+    norm_1 = std::max(norm_1, column_sum);
+    if (R[jj + jj * n] == ScalarType(0))
+      return std::numeric_limits<RealType>::infinity();
+  }
+  return internal::hager_condition_estimate<ScalarType>(
+      n,
+      norm_1,
+      [&](std::vector<ScalarType>& x) { internal::solve_upper_triangular_in_place(R, n, x, false); },
+      [&](std::vector<ScalarType>& x) { internal::solve_upper_triangular_in_place(R, n, x, true); });
+} // ... qr_condition_estimate(...)
+
+/**
+ *  \brief Residual norm min_x ||Ax - b||_2 of the least squares problem, where AP = QR is the QR decomposition
+ *         computed by qr and A has at least as many rows as columns.
+ *  Since ||Ax - b||_2 = ||R P^T x - Q^T b||_2, the residual is the norm of the trailing entries of Q^T b, which is
+ *  computed from the stored reflections. If rank is given (\see qr_rank), the residual of the basic solution using only
+ *  the first rank columns of AP is returned instead.
+ */
+template <class MatrixType, class VectorType, class RhsVectorType>
+std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_vector<RhsVectorType>::value,
+                 typename Common::MatrixAbstraction<MatrixType>::RealType>
+qr_least_squares_residual(const MatrixType& QR,
+                          const VectorType& tau,
+                          const RhsVectorType& b,
+                          const size_t rank = std::numeric_limits<size_t>::max())
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using V = Common::VectorAbstraction<RhsVectorType>;
+  using RealType = typename M::RealType;
+  const size_t num_rows = M::rows(QR);
+  const size_t num_cols = M::cols(QR);
+  if (num_cols > num_rows)
+    DUNE_THROW(NotImplemented, "Not implemented for matrices with more columns than rows!");
+  if (V::size(b) != num_rows)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "b has to have as many entries as QR has rows (" << num_rows << ")!\n   b.size() = " << V::size(b));
+  std::vector<typename M::ScalarType> y(num_rows);
+  apply_q_from_qr<Common::Transpose::yes>(QR, tau, b, y);
+  RealType residual = 0;
+  for (size_t ii = std::min(rank, num_cols); ii < num_rows; ++ii)
+    residual += std::pow(std::abs(y[ii]), 2);
+  return std::sqrt(residual);
+} // ... qr_least_squares_residual(...)
+
+/**
+ *  \brief Updates the factorization AP = QR to (A + u v^T) P = QR in O(rows * (rows + cols)) operations.
+ *  Q (rows x rows) has to be given explicitly (\see calculate_q_from_qr, which has to be called only once for a
+ *  sequence of updates), R (rows x cols) has to be upper triangular (e.g., QR from qr with the strictly lower
+ *  triangular part set to zero). The permutation P is kept, so R does not reveal the rank of the updated matrix any
+ *  more. Q^T u is reduced to a multiple of the first unit vector by Givens rotations, which makes R upper Hessenberg,
+ *  the rank one term is added to the first row of R and R is reduced to triangular form again by further rotations.
+ *  For a downdate A - u v^T, pass -u.
+ *  \see Golub, van Loan: Matrix Computations, Section 12.5.1
+ */
+template <class MatrixType,
+          class SecondMatrixType,
+          class IndexVectorType,
+          class VectorType,
+          class SecondVectorType>
+std::enable_if_t<Common::is_vector<VectorType>::value && Common::is_vector<SecondVectorType>::value, void>
+qr_update(MatrixType& Q,
+          SecondMatrixType& R,
+          const IndexVectorType& permutations,
+          const VectorType& u,
+          const SecondVectorType& v)
+{
+  using MQ = Common::MatrixAbstraction<MatrixType>;
+  using MR = Common::MatrixAbstraction<SecondMatrixType>;
+  using VI = Common::VectorAbstraction<IndexVectorType>;
+  using V = Common::VectorAbstraction<VectorType>;
+  using V2 = Common::VectorAbstraction<SecondVectorType>;
+  using ScalarType = typename MR::ScalarType;
+  static_assert(!Common::is_complex<ScalarType>::value, "Only implemented for real matrices!");
+  const size_t num_rows = MR::rows(R);
+  const size_t num_cols = MR::cols(R);
+  if (MQ::rows(Q) != num_rows || MQ::cols(Q) != num_rows || V::size(u) != num_rows || V2::size(v) != num_cols
+      || VI::size(permutations) != num_cols)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "Q has to be a square matrix with as many rows as R, u needs as many entries as R has rows and v and "
+                   << "permutations as many as R has columns!\n   Q: " << MQ::rows(Q) << "x" << MQ::cols(Q)
+                   << "\n   R: " << num_rows << "x" << num_cols << "\n   u.size() = " << V::size(u)
+                   << "\n   v.size() = " << V2::size(v) << "\n   permutations.size() = " << VI::size(permutations));
+  if (num_rows == 0)
+    return;
+  // w = Q^T u
+  std::vector<ScalarType> w(num_rows, ScalarType(0));
+  for (size_t kk = 0; kk < num_rows; ++kk) {
+    const ScalarType u_k = V::get_entry(u, kk);
+    for (size_t ii = 0; ii < num_rows; ++ii)
+      w[ii] += MQ::get_entry(Q, kk, ii) * u_k;
+  }
+  // reduce w to a multiple of e_0, R becomes upper Hessenberg
+  for (size_t kk = num_rows - 1; kk > 0; --kk) {
+    if (w[kk] != ScalarType(0)) {
+      internal::apply_givens_rotation(Q, R, kk - 1, kk - 1, w[kk - 1], w[kk]);
+      w[kk - 1] = std::hypot(w[kk - 1], w[kk]);
+    }
+  }
+  // add the rank one term, (u v^T) P = u (P^T v)^T
+  for (size_t jj = 0; jj < num_cols; ++jj)
+    MR::add_to_entry(R, 0, jj, w[0] * V2::get_entry(v, static_cast<size_t>(VI::get_entry(permutations, jj))));
+  // restore the triangular form
+  for (size_t kk = 0; kk < std::min(num_rows - 1, num_cols); ++kk) {
+    internal::apply_givens_rotation(Q, R, kk, kk, MR::get_entry(R, kk, kk), MR::get_entry(R, kk + 1, kk));
+    MR::set_entry(R, kk + 1, kk, ScalarType(0));
+  }
+} // ... qr_update(...)
+
+/**
+ *  \brief Rank-k variant of qr_update, updates the factorization AP = QR to (A + U V^T) P = QR.
+ */
+template <class MatrixType,
+          class SecondMatrixType,
+          class IndexVectorType,
+          class ThirdMatrixType,
+          class FourthMatrixType>
+std::enable_if_t<Common::is_matrix<ThirdMatrixType>::value && Common::is_matrix<FourthMatrixType>::value, void>
+qr_update(MatrixType& Q,
+          SecondMatrixType& R,
+          const IndexVectorType& permutations,
+          const ThirdMatrixType& U,
+          const FourthMatrixType& V)
+{
+  using MU = Common::MatrixAbstraction<ThirdMatrixType>;
+  using MV = Common::MatrixAbstraction<FourthMatrixType>;
+  using ScalarType = typename Common::MatrixAbstraction<SecondMatrixType>::ScalarType;
+  if (MU::cols(U) != MV::cols(V))
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "U and V need the same number of columns!\n   U: " << MU::rows(U) << "x" << MU::cols(U) << "\n   V: "
+                                                                   << MV::rows(V) << "x" << MV::cols(V));
+  std::vector<ScalarType> u(MU::rows(U)), v(MV::rows(V));
+  for (size_t jj = 0; jj < MU::cols(U); ++jj) {
+    for (size_t ii = 0; ii < u.size(); ++ii)
+      u[ii] = MU::get_entry(U, ii, jj);
+    for (size_t ii = 0; ii < v.size(); ++ii)
+      v[ii] = MV::get_entry(V, ii, jj);
+    qr_update(Q, R, permutations, u, v);
+  }
+} // ... qr_update(...)
+
 /**
  *  \brief Performs a QR decomposition to solve Ax = b
  *  \see qr
  */
 template <class MatrixType, class VectorType, class SecondVectorType>
 typename std::enable_if_t<Common::is_matrix<MatrixType>::value && Common::is_vector<VectorType>::value
-                              && Common::is_vector<SecondVectorType>::value,
+                              && Common::is_vector<SecondVectorType>::value
+                              && !internal::is_small_field_matrix<MatrixType>::value,
                           void>
 solve_by_qr_decomposition(MatrixType& A, VectorType& x, const SecondVectorType& b)
 {
@@ -596,6 +1176,31 @@ solve_by_qr_decomposition(MatrixType& A, VectorType& x, const SecondVectorType&
   solve_qr_factorized(A, tau, permutations, x, b);
 } // void solve_by_qr_decomposition(...)
 
+/**
+ *  \brief Performs a QR decomposition to solve Ax = b, fully unrolled variant for small FieldMatrix types
+ *  \see qr
+ */
+template <class MatrixType, class VectorType, class SecondVectorType>
+typename std::enable_if_t<internal::is_small_field_matrix<MatrixType>::value && Common::is_vector<VectorType>::value
+                              && Common::is_vector<SecondVectorType>::value,
+                          void>
+solve_by_qr_decomposition(MatrixType& A, VectorType& x, const SecondVectorType& b)
+{
+  using V = Common::VectorAbstraction<VectorType>;
+  using V2 = Common::VectorAbstraction<SecondVectorType>;
+  using FieldMatrixType = typename internal::is_small_field_matrix<MatrixType>::FieldMatrixType;
+  static constexpr int size = FieldMatrixType::rows;
+  auto& QR = static_cast<FieldMatrixType&>(A);
+  FieldVector<typename FieldMatrixType::value_type, size> tau, y;
+  FieldVector<int, size> permutations;
+  for (size_t ii = 0; ii < size; ++ii)
+    y[ii] = V2::get_entry(b, ii);
+  internal::static_qr(QR, tau, permutations);
+  internal::static_solve_qr_factorized(QR, tau, permutations, y);
+  for (size_t ii = 0; ii < size; ++ii)
+    V::set_entry(x, ii, y[ii]);
+} // void solve_by_qr_decomposition(...)
+
 /**
  *  \brief Performs a QR decomposition to solve AX = B, where A, X and B are matrices
  *  \see qr
@@ -0,0 +1,549 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_RANDOMIZED_SVD_HH
+#define DUNE_XT_LA_ALGORITHMS_RANDOMIZED_SVD_HH
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/ftraits.hh>
+#include <dune/common/typetraits.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/matrix.hh>
+#include <dune/xt/common/type_traits.hh>
+#include <dune/xt/common/vector.hh>
+
+#include <dune/xt/la/algorithms/gemm.hh>
+#include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/container/common/matrix/dense.hh>
+#include <dune/xt/la/container/vector-array/list.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+// Number of rows of A which are copied to a buffer at once when multiplying with A.
+static constexpr size_t randomized_svd_row_block_size = 256;
+
+
+/**
+ * \brief Access to the entries of the matrices and vector arrays supported by randomized_range_finder and
+ *        randomized_svd.
+ *
+ * A vector array is treated as the matrix with the vectors as columns.
+ */
+template <class AType, bool is_matrix = Common::is_matrix<AType>::value>
+struct RandomizedSvdTraits
+{
+  static_assert(AlwaysFalse<AType>::value, "Only implemented for matrices and ListVectorArray!");
+};
+
+// U and V are of the type of A if A is dense, CommonDenseMatrix otherwise (a sparse matrix would need a pattern).
+template <class MatrixType>
+struct RandomizedSvdTraits<MatrixType, true>
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  using ScalarType = typename M::ScalarType;
+  using RealType = typename Dune::FieldTraits<ScalarType>::real_type;
+  using LeftType = std::conditional_t<is_dense_layout(M::storage_layout),
+                                      typename M::MatrixType,
+                                      CommonDenseMatrix<ScalarType>>;
+  using RightType = LeftType;
+  static_assert(!M::has_static_size, "Only implemented for matrices of dynamic size!");
+
+  static size_t rows(const MatrixType& A)
+  {
+    return M::rows(A);
+  }
+
+  static size_t cols(const MatrixType& A)
+  {
+    return M::cols(A);
+  }
+
+  // Copies the rows first, ..., first + count - 1 of A to the column-major count x cols(A) buffer.
+  static void gather_rows(const MatrixType& A, const size_t first, const size_t count, ScalarType* buffer)
+  {
+    for (size_t cc = 0; cc < M::cols(A); ++cc)
+      for (size_t rr = 0; rr < count; ++rr)
+        buffer[rr + cc * count] = M::get_entry(A, first + rr, cc);
+  }
+
+  // Creates the num_rows x num_cols matrix given by the column-major buffer.
+  static LeftType create(const std::vector<ScalarType>& buffer, const size_t num_rows, const size_t num_cols)
+  {
+    auto ret = Common::MatrixAbstraction<LeftType>::create(num_rows, num_cols, ScalarType(0));
+    copy_from_column_major(buffer, ret);
+    return ret;
+  }
+}; // struct RandomizedSvdTraits<MatrixType, true>
+
+template <class Vector>
+struct RandomizedSvdTraits<ListVectorArray<Vector>, false>
+{
+  using V = Common::VectorAbstraction<Vector>;
+  using ScalarType = typename V::ScalarType;
+  using RealType = typename Dune::FieldTraits<ScalarType>::real_type;
+  using LeftType = ListVectorArray<Vector>;
+  using RightType = ListVectorArray<Vector>;
+
+  static size_t rows(const ListVectorArray<Vector>& A)
+  {
+    return A.dim();
+  }
+
+  static size_t cols(const ListVectorArray<Vector>& A)
+  {
+    return A.length();
+  }
+
+  static void gather_rows(const ListVectorArray<Vector>& A, const size_t first, const size_t count, ScalarType* buffer)
+  {
+    const auto& vectors = A.vectors();
+    for (size_t cc = 0; cc < vectors.size(); ++cc)
+      for (size_t rr = 0; rr < count; ++rr)
+        buffer[rr + cc * count] = V::get_entry(vectors[cc], first + rr);
+  }
+
+  // Creates an array of num_cols vectors of size num_rows, given by the columns of the column-major buffer.
+  static LeftType create(const std::vector<ScalarType>& buffer, const size_t num_rows, const size_t num_cols)
+  {
+    ListVectorArray<Vector> ret(num_rows, 0, num_cols);
+    for (size_t cc = 0; cc < num_cols; ++cc) {
+      auto vec = V::create(num_rows, ScalarType(0));
+      for (size_t rr = 0; rr < num_rows; ++rr)
+        V::set_entry(vec, rr, buffer[rr + cc * num_rows]);
+      ret.append(std::move(vec));
+    }
+    return ret;
+  }
+}; // struct RandomizedSvdTraits<ListVectorArray<...>, false>
+
+
+// Computes Y = A X for the column-major cols(A) x num_vectors matrix X, Y is column-major rows(A) x num_vectors. Blocks
+// of rows of A are copied to a buffer and multiplied with X by gemm, so A is only read once. If frobenius_norm_squared
+// is given, ||A||_F^2 is computed on the fly.
+template <class AType, class ScalarType>
+void multiply_in_row_blocks(const AType& A,
+                            const std::vector<ScalarType>& X,
+                            const size_t num_vectors,
+                            std::vector<ScalarType>& Y,
+                            ScalarType* frobenius_norm_squared = nullptr)
+{
+  using Traits = RandomizedSvdTraits<AType>;
+  const size_t num_rows = Traits::rows(A);
+  const size_t num_cols = Traits::cols(A);
+  Y.assign(num_rows * num_vectors, ScalarType(0));
+  if (frobenius_norm_squared)
+    *frobenius_norm_squared = ScalarType(0);
+  std::vector<ScalarType> block(randomized_svd_row_block_size * num_cols);
+  for (size_t first = 0; first < num_rows; first += randomized_svd_row_block_size) {
+    const size_t count = std::min(randomized_svd_row_block_size, num_rows - first);
+    Traits::gather_rows(A, first, count, block.data());
+    if (frobenius_norm_squared)
+      for (size_t ii = 0; ii < count * num_cols; ++ii)
+        *frobenius_norm_squared += block[ii] * block[ii];
+    gemm(count,
+         num_vectors,
+         num_cols,
+         ScalarType(1),
+         block.data(),
+         1,
+         count,
+         X.data(),
+         1,
+         num_cols,
+         ScalarType(0),
+         Y.data() + first,
+         1,
+         num_rows);
+  }
+} // ... multiply_in_row_blocks(...)
+
+// Computes W = X^T A for the column-major rows(A) x num_vectors matrix X, W is column-major num_vectors x cols(A).
+template <class AType, class ScalarType>
+void multiply_transposed_in_row_blocks(const AType& A,
+                                       const std::vector<ScalarType>& X,
+                                       const size_t num_vectors,
+                                       std::vector<ScalarType>& W)
+{
+  using Traits = RandomizedSvdTraits<AType>;
+  const size_t num_rows = Traits::rows(A);
+  const size_t num_cols = Traits::cols(A);
+  W.assign(num_vectors * num_cols, ScalarType(0));
+  std::vector<ScalarType> block(randomized_svd_row_block_size * num_cols);
+  for (size_t first = 0; first < num_rows; first += randomized_svd_row_block_size) {
+    const size_t count = std::min(randomized_svd_row_block_size, num_rows - first);
+    Traits::gather_rows(A, first, count, block.data());
+    gemm(num_vectors,
+         num_cols,
+         count,
+         ScalarType(1),
+         X.data() + first,
+         num_rows,
+         1,
+         block.data(),
+         1,
+         count,
+         ScalarType(1),
+         W.data(),
+         1,
+         num_vectors);
+  }
+} // ... multiply_transposed_in_row_blocks(...)
+
+// Orthonormalizes the columns of the column-major num_rows x num_new matrix Y against the first num_old columns of the
+// column-major matrix Q (block Gram-Schmidt) and among themselves (blocked QR). On exit, Y contains the new orthonormal
+// columns. Once the range of A is exhausted, Y lies in the span of Q up to rounding errors and the first pass leaves
+// arbitrary directions, which only become orthogonal to Q in the following passes.
+template <class ScalarType>
+void orthonormalize_block(const std::vector<ScalarType>& Q,
+                          const size_t num_old,
+                          std::vector<ScalarType>& Y,
+                          const size_t num_rows,
+                          const size_t num_new)
+{
+  std::vector<ScalarType> C(num_old * num_new), tau, orthonormal_columns;
+  for (size_t pass = 0; pass < (num_old > 0 ? 3 : 1); ++pass) {
+    if (num_old > 0) {
+      // C = Q^T Y, Y = Y - Q C
+      gemm(num_old,
+           num_new,
+           num_rows,
+           ScalarType(1),
+           Q.data(),
+           num_rows,
+           1,
+           Y.data(),
+           1,
+           num_rows,
+           ScalarType(0),
+           C.data(),
+           1,
+           num_old);
+      gemm(num_rows,
+           num_new,
+           num_old,
+           ScalarType(-1),
+           Q.data(),
+           1,
+           num_rows,
+           C.data(),
+           1,
+           num_old,
+           ScalarType(1),
+           Y.data(),
+           1,
+           num_rows);
+    }
+    blocked_qr_decomposition(Y, num_rows, num_new, tau, 32);
+    // the first num_new columns of the orthogonal factor
+    orthonormal_columns.assign(num_rows * num_new, ScalarType(0));
+    for (size_t jj = 0; jj < num_new; ++jj)
+      orthonormal_columns[jj + jj * num_rows] = ScalarType(1);
+    apply_q_blocked<Common::Transpose::no>(Y, num_rows, num_new, tau, 32, orthonormal_columns, num_new);
+    std::swap(Y, orthonormal_columns);
+  }
+} // ... orthonormalize_block(...)
+
+/**
+ * \brief Blocked adaptive randomized range finder.
+ *
+ * Computes Q (column-major rows(A) x rank) with orthonormal columns and Bt = (Q^T A)^T (column-major cols(A) x rank).
+ * In each step, block_size Gaussian random vectors are multiplied with A (followed by power_iterations
+ * multiplications with A A^T, each orthonormalized), the result is orthonormalized against Q and appended to it. Since
+ * ||A - Q Q^T A||_F^2 = ||A||_F^2 - ||Q^T A||_F^2, the error is available at no extra cost and the iteration stops once
+ * it falls below relative_tolerance * ||A||_F or rank reaches max_rank (a relative_tolerance of 0 always computes
+ * max_rank vectors).
+ *
+ * \return the estimate of ||A - Q Q^T A||_F^2, norm_squared is set to ||A||_F^2
+ */
+template <class AType, class ScalarType>
+ScalarType randomized_qb(const AType& A,
+                         const double relative_tolerance,
+                         size_t max_rank,
+                         const size_t block_size,
+                         const size_t power_iterations,
+                         const unsigned int seed,
+                         std::vector<ScalarType>& Q,
+                         std::vector<ScalarType>& Bt,
+                         size_t& rank,
+                         ScalarType& norm_squared)
+{
+  using Traits = RandomizedSvdTraits<AType>;
+  if (!(relative_tolerance >= 0.))
+    DUNE_THROW(Common::Exceptions::wrong_input_given,
+               "relative_tolerance has to be non-negative!\n   relative_tolerance = " << relative_tolerance);
+  if (block_size == 0)
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "block_size has to be positive!");
+  const size_t num_rows = Traits::rows(A);
+  const size_t num_cols = Traits::cols(A);
+  max_rank = std::min({max_rank, num_rows, num_cols});
+  Q.clear();
+  Bt.clear();
+  rank = 0;
+  norm_squared = ScalarType(0);
+  ScalarType error_squared(0);
+  std::mt19937 generator(seed);
+  std::normal_distribution<ScalarType> distribution;
+  std::vector<ScalarType> Omega, Y, W;
+  while (rank < max_rank) {
+    const size_t num_new = std::min(block_size, max_rank - rank);
+    Omega.resize(num_cols * num_new);
+    for (auto& entry : Omega)
+      entry = distribution(generator);
+    if (rank == 0) {
+      multiply_in_row_blocks(A, Omega, num_new, Y, &norm_squared);
+      error_squared = norm_squared;
+    } else
+      multiply_in_row_blocks(A, Omega, num_new, Y);
+    orthonormalize_block(Q, rank, Y, num_rows, num_new);
+    for (size_t qq = 0; qq < power_iterations; ++qq) {
+      // Omega = orth(A^T Y), Y = orth(A Omega)
+      multiply_transposed_in_row_blocks(A, Y, num_new, W);
+      for (size_t jj = 0; jj < num_cols; ++jj)
+        for (size_t ii = 0; ii < num_new; ++ii)
+          Omega[jj + ii * num_cols] = W[ii + jj * num_new];
+      orthonormalize_block(Q, 0, Omega, num_cols, num_new);
+      multiply_in_row_blocks(A, Omega, num_new, Y);
+      orthonormalize_block(Q, rank, Y, num_rows, num_new);
+    }
+    // append the new columns to Q and Bt
+    multiply_transposed_in_row_blocks(A, Y, num_new, W);
+    Q.insert(Q.end(), Y.begin(), Y.end());
+    Bt.resize(num_cols * (rank + num_new));
+    for (size_t ii = 0; ii < num_new; ++ii)
+      for (size_t jj = 0; jj < num_cols; ++jj) {
+        Bt[jj + (rank + ii) * num_cols] = W[ii + jj * num_new];
+        error_squared -= W[ii + jj * num_new] * W[ii + jj * num_new];
+      }
+    rank += num_new;
+    if (rank == std::min(num_rows, num_cols))
+      error_squared = ScalarType(0); // the range of A is covered
+    else if (relative_tolerance > 0. && error_squared <= relative_tolerance * relative_tolerance * norm_squared)
+      break;
+  }
+  return std::max(error_squared, ScalarType(0));
+} // ... randomized_qb(...)
+
+// One-sided Jacobi method: orthogonalizes the columns of the column-major num_rows x num_cols matrix G by plane
+// rotations from the right, which are accumulated in the column-major num_cols x num_cols matrix W, i.e.
+// G_in W = G_out and W is orthogonal.
+template <class RealType>
+void one_sided_jacobi(std::vector<RealType>& G,
+                      const size_t num_rows,
+                      const size_t num_cols,
+                      std::vector<RealType>& W,
+                      const size_t max_sweeps = 60)
+{
+  const RealType eps = std::numeric_limits<RealType>::epsilon();
+  W.assign(num_cols * num_cols, RealType(0));
+  for (size_t jj = 0; jj < num_cols; ++jj)
+    W[jj + jj * num_cols] = RealType(1);
+  const auto rotate = [](RealType* x, RealType* y, const size_t size, const RealType c, const RealType s) {
+    for (size_t rr = 0; rr < size; ++rr) {
+      const RealType x_rr = x[rr];
+      x[rr] = c * x_rr - s * y[rr];
+      y[rr] = s * x_rr + c * y[rr];
+    }
+  };
+  for (size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+    bool rotated = false;
+    for (size_t pp = 0; pp + 1 < num_cols; ++pp) {
+      for (size_t qq = pp + 1; qq < num_cols; ++qq) {
+        RealType* g_p = G.data() + pp * num_rows;
+        RealType* g_q = G.data() + qq * num_rows;
+        RealType alpha(0), beta(0), gamma(0);
+        for (size_t rr = 0; rr < num_rows; ++rr) {
+          alpha += g_p[rr] * g_p[rr];
+          beta += g_q[rr] * g_q[rr];
+          gamma += g_p[rr] * g_q[rr];
+        }
+        if (!(std::abs(gamma) > eps * std::sqrt(alpha * beta)))
+          continue;
+        rotated = true;
+        // the rotation annihilating the scalar product of the columns pp and qq
+        const RealType zeta = (beta - alpha) / (2 * gamma);
+        const RealType t = (zeta >= 0 ? 1 : -1) / (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+        const RealType c = 1 / std::sqrt(1 + t * t);
+        rotate(g_p, g_q, num_rows, c, c * t);
+        rotate(W.data() + pp * num_cols, W.data() + qq * num_cols, num_cols, c, c * t);
+      } // qq
+    } // pp
+    if (!rotated)
+      break;
+  }
+} // ... one_sided_jacobi(...)
+
+
+} // namespace internal
+
+
+/**
+ * \brief Result of randomized_range_finder: the columns (vectors) of basis are orthonormal and error_estimate is an
+ *        estimate of ||A - basis basis^T A||_F.
+ */
+template <class LeftImp, class RealImp>
+struct RangeFinderResult
+{
+  LeftImp basis;
+  RealImp error_estimate;
+};
+
+/**
+ * \brief Result of randomized_svd: A ~ U diag(singular_values) V^T, where the singular values are sorted in decreasing
+ *        order and error_estimate is an estimate of ||A - U diag(singular_values) V^T||_F.
+ */
+template <class LeftImp, class RightImp, class RealImp>
+struct TruncatedSvd
+{
+  LeftImp U;
+  std::vector<RealImp> singular_values;
+  RightImp V;
+  RealImp error_estimate;
+};
+
+
+/**
+ * \brief Computes an orthonormal basis of an approximation of the range of A by the randomized range finder of
+ *        Halko, Martinsson and Tropp (blocked and adaptive).
+ *
+ * A is either a dense or sparse matrix (of dynamic size) or a ListVectorArray, which is treated as the matrix with the
+ * vectors as columns (e.g., a set of snapshots), so the basis is an array of vectors of the same dimension. For a
+ * sparse A, the basis is a CommonDenseMatrix. The basis is extended by block_size vectors at a time, until the
+ * estimated error ||A - Q Q^T A||_F drops below relative_tolerance * ||A||_F or max_rank vectors are reached (if
+ * relative_tolerance is 0, max_rank vectors are computed). Each step reads A 2 * (power_iterations + 1) times, the
+ * work is done by gemm on blocks of rows of A and by the blocked QR decomposition.
+ *
+ * \note The error estimate is computed as the difference of ||A||_F^2 and ||Q^T A||_F^2, so it is only reliable for
+ *       relative tolerances above the square root of the machine precision.
+ * \note The random vectors are generated from seed, so the result is reproducible.
+ */
+template <class AType,
+          class Traits = internal::RandomizedSvdTraits<AType>,
+          class LeftType = typename Traits::LeftType,
+          class RealType = typename Traits::RealType>
+RangeFinderResult<LeftType, RealType>
+randomized_range_finder(const AType& A,
+                        const double relative_tolerance,
+                        const size_t max_rank = std::numeric_limits<size_t>::max(),
+                        const size_t block_size = 10,
+                        const size_t power_iterations = 1,
+                        const unsigned int seed = 0)
+{
+  static_assert(!Common::is_complex<typename Traits::ScalarType>::value, "Only implemented for real matrices!");
+  std::vector<RealType> Q, Bt;
+  size_t rank;
+  RealType norm_squared;
+  const RealType error_squared = internal::randomized_qb(
+      A, relative_tolerance, max_rank, block_size, power_iterations, seed, Q, Bt, rank, norm_squared);
+  return {Traits::create(Q, Traits::rows(A), rank), std::sqrt(error_squared)};
+} // ... randomized_range_finder(...)
+
+/**
+ * \brief Computes a truncated singular value decomposition of A by the randomized algorithm of Halko, Martinsson and
+ *        Tropp.
+ *
+ * The range of A is approximated by randomized_range_finder (using up to max_rank + block_size vectors, the
+ * additional ones serve as oversampling), the SVD of the small matrix Q^T A is computed by the one-sided Jacobi
+ * method. Only the largest singular values are kept, as few as possible such that the estimated error is below
+ * relative_tolerance * ||A||_F, and at most max_rank of them. For a ListVectorArray of snapshots, U contains the POD
+ * modes, ordered by their energy (the squared singular values).
+ *
+ * \sa randomized_range_finder for A and the parameters
+ */
+template <class AType,
+          class Traits = internal::RandomizedSvdTraits<AType>,
+          class LeftType = typename Traits::LeftType,
+          class RightType = typename Traits::RightType,
+          class RealType = typename Traits::RealType>
+TruncatedSvd<LeftType, RightType, RealType> randomized_svd(const AType& A,
+                                                           const double relative_tolerance,
+                                                           const size_t max_rank = std::numeric_limits<size_t>::max(),
+                                                           const size_t block_size = 10,
+                                                           const size_t power_iterations = 1,
+                                                           const unsigned int seed = 0)
+{
+  static_assert(!Common::is_complex<typename Traits::ScalarType>::value, "Only implemented for real matrices!");
+  const size_t num_rows = Traits::rows(A);
+  const size_t num_cols = Traits::cols(A);
+  const size_t range_rank = (max_rank > std::numeric_limits<size_t>::max() - block_size) ? max_rank
+                                                                                         : max_rank + block_size;
+  std::vector<RealType> Q, G, W;
+  size_t rank;
+  RealType norm_squared;
+  RealType error_squared = internal::randomized_qb(
+      A, relative_tolerance, range_rank, block_size, power_iterations, seed, Q, G, rank, norm_squared);
+  // Q^T A = G^T = W diag(singular_values) V^T
+  internal::one_sided_jacobi(G, num_cols, rank, W);
+  std::vector<RealType> singular_values(rank);
+  for (size_t jj = 0; jj < rank; ++jj) {
+    RealType sum(0);
+    for (size_t rr = 0; rr < num_cols; ++rr)
+      sum += G[rr + jj * num_cols] * G[rr + jj * num_cols];
+    singular_values[jj] = std::sqrt(sum);
+  }
+  std::vector<size_t> order(rank);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](const size_t ii, const size_t jj) {
+    return singular_values[ii] > singular_values[jj];
+  });
+  // truncate, the dropped singular values add to the error
+  size_t new_rank = rank;
+  const RealType allowed_error_squared = relative_tolerance * relative_tolerance * norm_squared;
+  while (new_rank > 0
+         && (new_rank > max_rank
+             || error_squared + std::pow(singular_values[order[new_rank - 1]], 2) <= allowed_error_squared
+             || singular_values[order[new_rank - 1]] == 0.)) {
+    error_squared += std::pow(singular_values[order[new_rank - 1]], 2);
+    --new_rank;
+  }
+  // U = Q W(:, order), V(:, jj) = G(:, order[jj]) / singular_values[order[jj]]
+  std::vector<RealType> W_kept(rank * new_rank), U(num_rows * new_rank), V(num_cols * new_rank);
+  std::vector<RealType> kept_singular_values(new_rank);
+  for (size_t jj = 0; jj < new_rank; ++jj) {
+    const size_t kk = order[jj];
+    kept_singular_values[jj] = singular_values[kk];
+    std::copy_n(W.begin() + kk * rank, rank, W_kept.begin() + jj * rank);
+    for (size_t rr = 0; rr < num_cols; ++rr)
+      V[rr + jj * num_cols] = G[rr + kk * num_cols] / singular_values[kk];
+  }
+  gemm(num_rows,
+       new_rank,
+       rank,
+       RealType(1),
+       Q.data(),
+       1,
+       num_rows,
+       W_kept.data(),
+       1,
+       rank,
+       RealType(0),
+       U.data(),
+       1,
+       num_rows);
+  return {Traits::create(U, num_rows, new_rank),
+          std::move(kept_singular_values),
+          Traits::create(V, num_cols, new_rank),
+          std::sqrt(error_squared)};
+} // ... randomized_svd(...)
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_RANDOMIZED_SVD_HH
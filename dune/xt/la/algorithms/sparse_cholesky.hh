@@ -0,0 +1,516 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_SPARSE_CHOLESKY_HH
+#define DUNE_XT_LA_ALGORITHMS_SPARSE_CHOLESKY_HH
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/matrix.hh>
+#include <dune/xt/common/vector.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+static constexpr size_t sparse_cholesky_none = std::numeric_limits<size_t>::max();
+
+
+/**
+ * \brief Factorizes the dense num_rows x num_cols panel (column-major with leading dimension num_rows) of a supernode
+ *        in place.
+ *
+ * The upper num_cols x num_cols block is factorized as LL^T (or LDL^T, where D is stored on the diagonal and the unit
+ * diagonal of L is not stored), the rows below are overwritten by the corresponding rows of L, i.e. this does a potrf
+ * on the diagonal block followed by a trsm on the remaining rows. Only the lower triangle of the diagonal block is
+ * read.
+ */
+template <class ScalarType>
+void factorize_supernode_panel(ScalarType* panel, const size_t num_rows, const size_t num_cols, const bool ldlt)
+{
+  for (size_t jj = 0; jj < num_cols; ++jj) {
+    ScalarType* column = panel + jj * num_rows;
+    // left-looking update of the jj-th column with all previous columns of the panel
+    for (size_t kk = 0; kk < jj; ++kk) {
+      const ScalarType* other_column = panel + kk * num_rows;
+      const ScalarType coefficient = ldlt ? other_column[jj] * other_column[kk] : other_column[jj];
+      for (size_t ii = jj; ii < num_rows; ++ii)
+        column[ii] -= other_column[ii] * coefficient;
+    }
+    if (ldlt ? column[jj] == ScalarType(0) : !(column[jj] > ScalarType(0)))
+      DUNE_THROW(Dune::MathError,
+                 (ldlt ? "LDL^T factorization failed, zero pivot!"
+                       : "Cholesky factorization failed, matrix is not positive definite!"));
+    if (!ldlt)
+      column[jj] = std::sqrt(column[jj]);
+    const ScalarType inverse_diagonal = ScalarType(1) / column[jj];
+    for (size_t ii = jj + 1; ii < num_rows; ++ii)
+      column[ii] *= inverse_diagonal;
+  } // jj
+} // ... factorize_supernode_panel(...)
+
+
+/**
+ * \brief Computes the update C = L_1 L_2^T (or L_1 D L_2^T) of a supernode to one of its ancestors.
+ *
+ * L_1 are the rows first_row, ..., num_rows - 1 and L_2 the rows first_row, ..., last_row - 1 of the given panel. Only
+ * the lower triangular part (a >= b) of C, which is stored column-major with leading dimension num_rows - first_row, is
+ * computed.
+ */
+template <class ScalarType>
+void compute_supernode_update(const ScalarType* panel,
+                              const size_t num_rows,
+                              const size_t num_cols,
+                              const size_t first_row,
+                              const size_t last_row,
+                              const bool ldlt,
+                              std::vector<ScalarType>& update)
+{
+  const size_t update_rows = num_rows - first_row;
+  const size_t update_cols = last_row - first_row;
+  update.assign(update_rows * update_cols, ScalarType(0));
+  for (size_t kk = 0; kk < num_cols; ++kk) {
+    const ScalarType* column = panel + kk * num_rows + first_row;
+    const ScalarType diagonal = ldlt ? panel[kk * num_rows + kk] : ScalarType(1);
+    for (size_t bb = 0; bb < update_cols; ++bb) {
+      const ScalarType coefficient = column[bb] * diagonal;
+      if (coefficient == ScalarType(0))
+        continue;
+      ScalarType* update_column = update.data() + bb * update_rows;
+      for (size_t aa = bb; aa < update_rows; ++aa)
+        update_column[aa] += column[aa] * coefficient;
+    }
+  } // kk
+} // ... compute_supernode_update(...)
+
+
+// symmetric adjacency structure (without the diagonal) of the pattern of a square CSR or CSC matrix
+template <class MatrixType>
+std::vector<std::set<size_t>> symmetric_adjacency(const MatrixType& A)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  static_assert(M::storage_layout == Common::StorageLayout::csr || M::storage_layout == Common::StorageLayout::csc,
+                "Only implemented for matrices in CSR or CSC format!");
+  const size_t size = M::rows(A);
+  const auto* outer_pointers = A.outer_index_ptr();
+  const auto* inner_indices = A.inner_index_ptr();
+  std::vector<std::set<size_t>> adjacency(size);
+  for (size_t oo = 0; oo < size; ++oo) {
+    for (size_t kk = outer_pointers[oo]; kk < outer_pointers[oo + 1]; ++kk) {
+      if (inner_indices[kk] != oo) {
+        adjacency[oo].insert(inner_indices[kk]);
+        adjacency[inner_indices[kk]].insert(oo);
+      }
+    }
+  }
+  return adjacency;
+} // ... symmetric_adjacency(...)
+
+
+} // namespace internal
+
+
+/**
+ * \brief Computes a fill-reducing ordering of the (symmetrized) pattern of A by the minimum degree algorithm.
+ *
+ * This is the plain algorithm on the explicit elimination graph, which is fine for moderately sized matrices. Any
+ * other ordering (e.g. from METIS) may be passed to SparseCholeskyFactorization::symbolic() instead.
+ * \return the permutation p, the ii-th row/column of the reordered matrix is the p[ii]-th row/column of A
+ */
+template <class MatrixType>
+std::vector<size_t> minimum_degree_ordering(const MatrixType& A)
+{
+  auto adjacency = internal::symmetric_adjacency(A);
+  const size_t size = adjacency.size();
+  std::set<std::pair<size_t, size_t>> nodes_by_degree;
+  for (size_t ii = 0; ii < size; ++ii)
+    nodes_by_degree.emplace(adjacency[ii].size(), ii);
+  std::vector<size_t> permutation;
+  permutation.reserve(size);
+  while (!nodes_by_degree.empty()) {
+    const size_t node = nodes_by_degree.begin()->second;
+    nodes_by_degree.erase(nodes_by_degree.begin());
+    permutation.push_back(node);
+    // eliminating the node connects all its neighbours
+    const auto neighbours = std::move(adjacency[node]);
+    for (const auto& neighbour : neighbours) {
+      auto& neighbour_adjacency = adjacency[neighbour];
+      nodes_by_degree.erase(std::make_pair(neighbour_adjacency.size(), neighbour));
+      neighbour_adjacency.erase(node);
+      for (const auto& other : neighbours)
+        if (other != neighbour)
+          neighbour_adjacency.insert(other);
+      nodes_by_degree.emplace(neighbour_adjacency.size(), neighbour);
+    }
+  } // while
+  return permutation;
+} // ... minimum_degree_ordering(...)
+
+
+/**
+ * \brief Supernodal sparse Cholesky (A = LL^T) and LDL^T factorization of a symmetric matrix in CSR or CSC format.
+ *
+ * A has to be stored with its full (symmetric) pattern. The factorization is done for P A P^T, where the permutation P
+ * is given to symbolic() (no reordering by default, see minimum_degree_ordering() for a fill-reducing one).
+ *
+ * symbolic() computes the elimination tree, the complete pattern of L (including all fill-in) and its fundamental
+ * supernodes, i.e. sets of consecutive columns of L sharing the same pattern below the diagonal block. The columns of
+ * each supernode are stored as one dense column-major panel, so numeric() consists of dense factorizations of the
+ * panels and dense updates of one panel to its ancestors. numeric() may be called repeatedly for matrices with the same
+ * pattern. The LDL^T factorization does not pivot, it is thus suited for quasi-definite, but not for general indefinite
+ * matrices.
+ */
+template <class ScalarImp = double>
+class SparseCholeskyFactorization
+{
+public:
+  using ScalarType = ScalarImp;
+
+  SparseCholeskyFactorization()
+    : size_(0)
+    , ldlt_(false)
+    , supernode_begin_(1, 0)
+    , supernode_row_pointers_(1, 0)
+    , supernode_value_pointers_(1, 0)
+  {}
+
+  /**
+   * \brief Symbolic analysis of A, permutation[ii] is the row/column of A which becomes the ii-th row/column (an empty
+   *        permutation is the identity).
+   */
+  template <class MatrixType>
+  void symbolic(const MatrixType& A, std::vector<size_t> permutation = std::vector<size_t>())
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    static_assert(M::storage_layout == Common::StorageLayout::csr || M::storage_layout == Common::StorageLayout::csc,
+                  "Only implemented for matrices in CSR or CSC format!");
+    static constexpr size_t none = internal::sparse_cholesky_none;
+    constexpr bool csr = (M::storage_layout == Common::StorageLayout::csr);
+    if (M::rows(A) != M::cols(A))
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "Matrix has to be square!\n   rows = " << M::rows(A) << "\n   cols = " << M::cols(A));
+    size_ = M::rows(A);
+    if (permutation.empty())
+      for (size_t ii = 0; ii < size_; ++ii)
+        permutation.push_back(ii);
+    if (permutation.size() != size_)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "permutation.size() = " << permutation.size() << ", size of A = " << size_);
+    permutation_ = std::move(permutation);
+    inverse_permutation_.assign(size_, none);
+    for (size_t ii = 0; ii < size_; ++ii) {
+      if (permutation_[ii] >= size_ || inverse_permutation_[permutation_[ii]] != none)
+        DUNE_THROW(Common::Exceptions::wrong_input_given, "The given vector is not a permutation!");
+      inverse_permutation_[permutation_[ii]] = ii;
+    }
+    // lower triangular part of P A P^T, row-wise (for the analysis) and column-wise (for the numeric phase)
+    const auto* outer_pointers = A.outer_index_ptr();
+    const auto* inner_indices = A.inner_index_ptr();
+    a_outer_pointers_.assign(outer_pointers, outer_pointers + size_ + 1);
+    a_inner_indices_.assign(inner_indices, inner_indices + outer_pointers[size_]);
+    const auto for_each_lower_entry = [&](const auto& visitor) {
+      for (size_t oo = 0; oo < size_; ++oo) {
+        for (size_t kk = outer_pointers[oo]; kk < outer_pointers[oo + 1]; ++kk) {
+          const size_t ii = inverse_permutation_[csr ? oo : inner_indices[kk]];
+          const size_t jj = inverse_permutation_[csr ? inner_indices[kk] : oo];
+          if (jj <= ii)
+            visitor(ii, jj, kk);
+        }
+      }
+    };
+    std::vector<size_t> lower_row_pointers(size_ + 1, 0);
+    a_column_pointers_.assign(size_ + 1, 0);
+    for_each_lower_entry([&](const size_t ii, const size_t jj, const size_t /*kk*/) {
+      ++lower_row_pointers[ii + 1];
+      ++a_column_pointers_[jj + 1];
+    });
+    for (size_t ii = 0; ii < size_; ++ii) {
+      lower_row_pointers[ii + 1] += lower_row_pointers[ii];
+      a_column_pointers_[ii + 1] += a_column_pointers_[ii];
+    }
+    std::vector<size_t> lower_column_indices(lower_row_pointers[size_]);
+    a_row_indices_.resize(a_column_pointers_[size_]);
+    a_entry_indices_.resize(a_column_pointers_[size_]);
+    std::vector<size_t> next_in_row(lower_row_pointers.begin(), lower_row_pointers.end() - 1);
+    std::vector<size_t> next_in_column(a_column_pointers_.begin(), a_column_pointers_.end() - 1);
+    for_each_lower_entry([&](const size_t ii, const size_t jj, const size_t kk) {
+      lower_column_indices[next_in_row[ii]++] = jj;
+      a_row_indices_[next_in_column[jj]] = ii;
+      a_entry_indices_[next_in_column[jj]++] = kk;
+    });
+    // elimination tree (Liu's algorithm with path compression)
+    parent_.assign(size_, none);
+    std::vector<size_t> ancestor(size_, none);
+    for (size_t ii = 0; ii < size_; ++ii) {
+      for (size_t pp = lower_row_pointers[ii]; pp < lower_row_pointers[ii + 1]; ++pp) {
+        size_t node = lower_column_indices[pp];
+        while (node < ii && ancestor[node] != none && ancestor[node] != ii) {
+          const size_t next = ancestor[node];
+          ancestor[node] = ii;
+          node = next;
+        }
+        if (node < ii && ancestor[node] == none) {
+          ancestor[node] = ii;
+          parent_[node] = ii;
+        }
+      }
+    } // ii
+    // the pattern of the ii-th row of L is the union of the paths from the entries of the ii-th row of A to ii in the
+    // elimination tree, first count, then fill the columns of L (which are thus sorted)
+    std::vector<size_t> marker(size_, none);
+    const auto for_each_row_entry_of_l = [&](const auto& visitor) {
+      for (size_t ii = 0; ii < size_; ++ii) {
+        marker[ii] = ii;
+        for (size_t pp = lower_row_pointers[ii]; pp < lower_row_pointers[ii + 1]; ++pp)
+          for (size_t node = lower_column_indices[pp]; marker[node] != ii; node = parent_[node]) {
+            marker[node] = ii;
+            visitor(ii, node);
+          }
+      }
+    };
+    std::vector<size_t> l_column_pointers(size_ + 1, 0);
+    for_each_row_entry_of_l([&](const size_t /*ii*/, const size_t jj) { ++l_column_pointers[jj + 1]; });
+    for (size_t jj = 0; jj < size_; ++jj)
+      l_column_pointers[jj + 1] += l_column_pointers[jj];
+    std::vector<size_t> l_row_indices(l_column_pointers[size_]);
+    std::vector<size_t> next_in_l_column(l_column_pointers.begin(), l_column_pointers.end() - 1);
+    marker.assign(size_, none);
+    for_each_row_entry_of_l([&](const size_t ii, const size_t jj) { l_row_indices[next_in_l_column[jj]++] = ii; });
+    // fundamental supernodes: column jj continues the supernode of column jj - 1 if jj - 1 is the only child of jj in
+    // the elimination tree and the pattern of column jj - 1 below the diagonal is the one of column jj plus jj
+    const auto l_column_count = [&](const size_t jj) { return l_column_pointers[jj + 1] - l_column_pointers[jj]; };
+    std::vector<size_t> num_children(size_, 0);
+    for (size_t jj = 0; jj < size_; ++jj)
+      if (parent_[jj] != none)
+        ++num_children[parent_[jj]];
+    supernode_begin_.assign(1, 0);
+    for (size_t jj = 1; jj < size_; ++jj)
+      if (parent_[jj - 1] != jj || num_children[jj] != 1 || l_column_count(jj - 1) != l_column_count(jj) + 1)
+        supernode_begin_.push_back(jj);
+    if (size_ > 0)
+      supernode_begin_.push_back(size_);
+    const size_t num_supernodes = supernode_begin_.size() - 1;
+    column_to_supernode_.resize(size_);
+    supernode_row_pointers_.assign(1, 0);
+    supernode_rows_.clear();
+    supernode_value_pointers_.assign(1, 0);
+    for (size_t ss = 0; ss < num_supernodes; ++ss) {
+      const size_t first_column = supernode_begin_[ss];
+      for (size_t jj = first_column; jj < supernode_begin_[ss + 1]; ++jj)
+        column_to_supernode_[jj] = ss;
+      supernode_rows_.push_back(first_column);
+      supernode_rows_.insert(supernode_rows_.end(),
+                             l_row_indices.begin() + static_cast<std::ptrdiff_t>(l_column_pointers[first_column]),
+                             l_row_indices.begin() + static_cast<std::ptrdiff_t>(l_column_pointers[first_column + 1]));
+      supernode_row_pointers_.push_back(supernode_rows_.size());
+      supernode_value_pointers_.push_back(supernode_value_pointers_.back()
+                                          + supernode_rows(ss) * supernode_cols(ss));
+    }
+    values_.assign(supernode_value_pointers_.back(), ScalarType(0));
+  } // ... symbolic(...)
+
+  /**
+   * \brief Computes L (and D if ldlt is true) on the pattern computed by symbolic().
+   * \throws shapes_do_not_match if the pattern of A differs from the one given to symbolic()
+   * \throws MathError if A is not positive definite (LL^T) or a zero pivot is encountered (LDL^T)
+   */
+  template <class MatrixType>
+  void numeric(const MatrixType& A, const bool ldlt = false)
+  {
+    using M = Common::MatrixAbstraction<MatrixType>;
+    if (M::rows(A) != size_ || M::cols(A) != size_)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "Call symbolic() first!\n   size of the pattern: " << size_ << "\n   rows of A: " << M::rows(A));
+    // the entries of A are addressed by their position in the storage, so the pattern has to be the very same
+    const auto* outer_pointers = A.outer_index_ptr();
+    const auto* inner_indices = A.inner_index_ptr();
+    if (!std::equal(a_outer_pointers_.begin(), a_outer_pointers_.end(), outer_pointers)
+        || !std::equal(a_inner_indices_.begin(), a_inner_indices_.end(), inner_indices))
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "The pattern of A does not match the one given to symbolic()!\n   non-zeros of the pattern: "
+                     << a_inner_indices_.size() << "\n   non-zeros of A: " << outer_pointers[size_]);
+    ldlt_ = ldlt;
+    const auto* a_entries = A.entries();
+    std::fill(values_.begin(), values_.end(), ScalarType(0));
+    std::vector<size_t> relative_positions(size_);
+    std::vector<ScalarType> update;
+    for (size_t ss = 0; ss < supernode_begin_.size() - 1; ++ss) {
+      const size_t* rows = supernode_rows_.data() + supernode_row_pointers_[ss];
+      const size_t num_rows = supernode_rows(ss);
+      const size_t num_cols = supernode_cols(ss);
+      const size_t first_column = supernode_begin_[ss];
+      ScalarType* panel = values_.data() + supernode_value_pointers_[ss];
+      // add the entries of A, the updates of the descendants have already been subtracted
+      for (size_t pp = 0; pp < num_rows; ++pp)
+        relative_positions[rows[pp]] = pp;
+      for (size_t jj = 0; jj < num_cols; ++jj)
+        for (size_t kk = a_column_pointers_[first_column + jj]; kk < a_column_pointers_[first_column + jj + 1]; ++kk)
+          panel[jj * num_rows + relative_positions[a_row_indices_[kk]]] += a_entries[a_entry_indices_[kk]];
+      internal::factorize_supernode_panel(panel, num_rows, num_cols, ldlt_);
+      // update the ancestors, the rows below the diagonal block are grouped by the supernodes they belong to
+      for (size_t first_row = num_cols; first_row < num_rows;) {
+        const size_t target = column_to_supernode_[rows[first_row]];
+        const size_t target_end = supernode_begin_[target + 1];
+        size_t last_row = first_row;
+        while (last_row < num_rows && rows[last_row] < target_end)
+          ++last_row;
+        internal::compute_supernode_update(panel, num_rows, num_cols, first_row, last_row, ldlt_, update);
+        const size_t* target_rows = supernode_rows_.data() + supernode_row_pointers_[target];
+        const size_t target_num_rows = supernode_rows(target);
+        ScalarType* target_panel = values_.data() + supernode_value_pointers_[target];
+        for (size_t pp = 0; pp < target_num_rows; ++pp)
+          relative_positions[target_rows[pp]] = pp;
+        const size_t update_rows = num_rows - first_row;
+        for (size_t bb = 0; bb < last_row - first_row; ++bb) {
+          const size_t target_col = rows[first_row + bb] - supernode_begin_[target];
+          ScalarType* target_column = target_panel + target_col * target_num_rows;
+          for (size_t aa = bb; aa < update_rows; ++aa)
+            target_column[relative_positions[rows[first_row + aa]]] -= update[bb * update_rows + aa];
+        }
+        first_row = last_row;
+      } // first_row
+    } // ss
+  } // ... numeric(...)
+
+  /**
+   * \brief Computes x = A^{-1} x in place.
+   */
+  template <class VectorType>
+  void apply(VectorType& x) const
+  {
+    using V = Common::VectorAbstraction<VectorType>;
+    assert(V::size(x) == size_);
+    std::vector<ScalarType> work(size_);
+    for (size_t ii = 0; ii < size_; ++ii)
+      work[ii] = V::get_entry(x, permutation_[ii]);
+    const size_t num_supernodes = supernode_begin_.size() - 1;
+    // L y = P b
+    for (size_t ss = 0; ss < num_supernodes; ++ss) {
+      const size_t* rows = supernode_rows_.data() + supernode_row_pointers_[ss];
+      const size_t num_rows = supernode_rows(ss);
+      const ScalarType* panel = values_.data() + supernode_value_pointers_[ss];
+      for (size_t jj = 0; jj < supernode_cols(ss); ++jj) {
+        const ScalarType* column = panel + jj * num_rows;
+        ScalarType& y_j = work[rows[jj]];
+        if (!ldlt_)
+          y_j /= column[jj];
+        for (size_t ii = jj + 1; ii < num_rows; ++ii)
+          work[rows[ii]] -= column[ii] * y_j;
+      }
+    } // ss
+    // D z = y
+    if (ldlt_)
+      for (size_t ss = 0; ss < num_supernodes; ++ss)
+        for (size_t jj = 0; jj < supernode_cols(ss); ++jj)
+          work[supernode_begin_[ss] + jj] /= values_[supernode_value_pointers_[ss] + jj * (supernode_rows(ss) + 1)];
+    // L^T x = z
+    for (size_t ss = num_supernodes - 1; ss < num_supernodes; --ss) {
+      const size_t* rows = supernode_rows_.data() + supernode_row_pointers_[ss];
+      const size_t num_rows = supernode_rows(ss);
+      const ScalarType* panel = values_.data() + supernode_value_pointers_[ss];
+      for (size_t jj = supernode_cols(ss) - 1; jj < supernode_cols(ss); --jj) {
+        const ScalarType* column = panel + jj * num_rows;
+        ScalarType sum = work[rows[jj]];
+        for (size_t ii = jj + 1; ii < num_rows; ++ii)
+          sum -= column[ii] * work[rows[ii]];
+        work[rows[jj]] = ldlt_ ? sum : sum / column[jj];
+      }
+    } // ss
+    for (size_t ii = 0; ii < size_; ++ii)
+      V::set_entry(x, permutation_[ii], work[ii]);
+  } // ... apply(...)
+
+  /**
+   * \brief Computes x = A^{-1} rhs.
+   */
+  template <class VectorType>
+  void apply(const VectorType& rhs, VectorType& x) const
+  {
+    x = rhs;
+    apply(x);
+  }
+
+  size_t rows() const
+  {
+    return size_;
+  }
+
+  //! Number of entries of L (including the diagonal).
+  size_t factor_non_zeros() const
+  {
+    size_t ret = 0;
+    for (size_t ss = 0; ss < supernode_begin_.size() - 1; ++ss)
+      ret += supernode_rows(ss) * supernode_cols(ss) - supernode_cols(ss) * (supernode_cols(ss) - 1) / 2;
+    return ret;
+  }
+
+  size_t num_supernodes() const
+  {
+    return supernode_begin_.size() - 1;
+  }
+
+  //! Parent of each column in the elimination tree (of the permuted matrix), the roots have no valid parent.
+  const std::vector<size_t>& elimination_tree() const
+  {
+    return parent_;
+  }
+
+  const std::vector<size_t>& permutation() const
+  {
+    return permutation_;
+  }
+
+private:
+  size_t supernode_rows(const size_t ss) const
+  {
+    return supernode_row_pointers_[ss + 1] - supernode_row_pointers_[ss];
+  }
+
+  size_t supernode_cols(const size_t ss) const
+  {
+    return supernode_begin_[ss + 1] - supernode_begin_[ss];
+  }
+
+  size_t size_;
+  bool ldlt_;
+  std::vector<size_t> permutation_;
+  std::vector<size_t> inverse_permutation_;
+  // pattern of A as given to symbolic()
+  std::vector<size_t> a_outer_pointers_;
+  std::vector<size_t> a_inner_indices_;
+  // lower triangular part of P A P^T, column-wise, as indices into the entries of A
+  std::vector<size_t> a_column_pointers_;
+  std::vector<size_t> a_row_indices_;
+  std::vector<size_t> a_entry_indices_;
+  std::vector<size_t> parent_;
+  // columns supernode_begin_[ss], ..., supernode_begin_[ss + 1] - 1 form the ss-th supernode, its row indices start at
+  // supernode_rows_[supernode_row_pointers_[ss]] and its column-major panel at values_[supernode_value_pointers_[ss]]
+  std::vector<size_t> supernode_begin_;
+  std::vector<size_t> column_to_supernode_;
+  std::vector<size_t> supernode_row_pointers_;
+  std::vector<size_t> supernode_rows_;
+  std::vector<size_t> supernode_value_pointers_;
+  std::vector<ScalarType> values_;
+}; // class SparseCholeskyFactorization
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_SPARSE_CHOLESKY_HH
@@ -0,0 +1,297 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_STATIC_SIZE_KERNELS_HH
+#define DUNE_XT_LA_ALGORITHMS_STATIC_SIZE_KERNELS_HH
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/common/precision.hh>
+
+#include <dune/xt/common/matrix.hh>
+#include <dune/xt/common/vector.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+/**
+ * \brief Calls f(std::integral_constant<size_t, ii>()) for ii = begin, ..., end - 1.
+ *
+ * The loop is unrolled at compile time and the loop index can be used as a template argument (via
+ * decltype(ii)::value), so nested loops with bounds depending on outer indices are fully unrolled as well.
+ */
+template <size_t begin, size_t end, bool = (begin < end)>
+struct StaticFor
+{
+  template <class FunctionType>
+  static void apply(FunctionType& f)
+  {
+    f(std::integral_constant<size_t, begin>());
+    StaticFor<begin + 1, end>::apply(f);
+  }
+};
+
+template <size_t begin, size_t end>
+struct StaticFor<begin, end, false>
+{
+  template <class FunctionType>
+  static void apply(FunctionType& /*f*/)
+  {}
+};
+
+template <size_t begin, size_t end, class FunctionType>
+void static_for(FunctionType&& f)
+{
+  StaticFor<begin, end>::apply(f);
+}
+
+
+/**
+ * \brief True for square Dune::FieldMatrix (and derived) types with floating point entries and at most 8 rows.
+ *
+ * For these, the algorithms below are selected automatically by cholesky, qr, solve_by_qr_decomposition and the
+ * MatrixInverter.
+ */
+template <class MatrixType,
+          bool candidate = Common::is_matrix<MatrixType>::value
+                           && Common::MatrixAbstraction<MatrixType>::has_static_size>
+struct is_small_field_matrix
+{
+  static const constexpr bool value = false;
+};
+
+template <class MatrixType>
+struct is_small_field_matrix<MatrixType, true>
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  static const constexpr size_t size = M::static_rows;
+  using FieldMatrixType = FieldMatrix<typename M::ScalarType, int(size), int(size)>;
+  static const constexpr bool value = M::static_rows == M::static_cols && size > 0 && size <= 8
+                                      && std::is_floating_point<typename M::ScalarType>::value
+                                      && std::is_base_of<FieldMatrixType, MatrixType>::value;
+};
+
+
+// LL^T factorization, L overwrites the lower triangular part of A (\sa cholesky_rowwise)
+template <class K, int N>
+void static_cholesky(FieldMatrix<K, N, N>& A)
+{
+  static_for<0, N>([&](auto ii_) {
+    constexpr size_t ii = decltype(ii_)::value;
+    static_for<0, ii>([&](auto jj_) {
+      constexpr size_t jj = decltype(jj_)::value;
+      K L_ij = A[ii][jj];
+      static_for<0, jj>([&](auto kk) { L_ij -= A[ii][kk] * A[jj][kk]; });
+      A[ii][jj] = L_ij / A[jj][jj];
+    });
+    K L_ii = A[ii][ii];
+    static_for<0, ii>([&](auto kk) { L_ii -= A[ii][kk] * A[ii][kk]; });
+    if (!(L_ii > 0)) // use !(.. > 0) instead of (.. <= 0) to also throw on NaNs
+      DUNE_THROW(MathError, "Cholesky factorization failed!");
+    A[ii][ii] = std::sqrt(L_ii);
+  });
+} // ... static_cholesky(...)
+
+// Solves L L^T x = x, where L is stored in the lower triangular part of L (as computed by static_cholesky)
+template <class K, int N>
+void static_solve_cholesky_factorized(const FieldMatrix<K, N, N>& L, FieldVector<K, N>& x)
+{
+  static_for<0, N>([&](auto ii_) {
+    constexpr size_t ii = decltype(ii_)::value;
+    static_for<0, ii>([&](auto jj) { x[ii] -= L[ii][jj] * x[jj]; });
+    x[ii] /= L[ii][ii];
+  });
+  static_for<0, N>([&](auto ii_) {
+    constexpr size_t ii = N - 1 - decltype(ii_)::value;
+    static_for<ii + 1, N>([&](auto jj) { x[ii] -= L[jj][ii] * x[jj]; });
+    x[ii] /= L[ii][ii];
+  });
+} // ... static_solve_cholesky_factorized(...)
+
+
+/**
+ * \brief LU factorization with partial pivoting, PA = LU.
+ *
+ * L (with unit diagonal) and U overwrite A, in step jj the rows jj and pivots[jj] were swapped. Returns false if a
+ * pivot is not larger than FMatrixPrecision<K>::absolute_limit() (as in batched_gauss_elimination) or NaN, in which
+ * case A is unusable.
+ */
+template <class K, int N>
+bool static_lu(FieldMatrix<K, N, N>& A, FieldVector<int, N>& pivots)
+{
+  bool regular = true;
+  static_for<0, N>([&](auto jj_) {
+    constexpr size_t jj = decltype(jj_)::value;
+    if (!regular)
+      return;
+    int pivot = int(jj);
+    K max_entry = std::abs(A[jj][jj]);
+    static_for<jj + 1, N>([&](auto ii) {
+      if (std::abs(A[ii][jj]) > max_entry) {
+        max_entry = std::abs(A[ii][jj]);
+        pivot = int(ii);
+      }
+    });
+    pivots[jj] = pivot;
+    if (!(max_entry > FMatrixPrecision<K>::absolute_limit())) { // also rejects NaNs
+      regular = false;
+      return;
+    }
+    if (pivot != int(jj))
+      static_for<0, N>([&](auto kk) { std::swap(A[jj][kk], A[pivot][kk]); });
+    const K inverse_pivot = K(1) / A[jj][jj];
+    static_for<jj + 1, N>([&](auto ii) {
+      A[ii][jj] *= inverse_pivot;
+      static_for<jj + 1, N>([&](auto kk) { A[ii][kk] -= A[ii][jj] * A[jj][kk]; });
+    });
+  });
+  return regular;
+} // ... static_lu(...)
+
+// Solves A x = x, where PA = LU is given by static_lu
+template <class K, int N>
+void static_solve_lu_factorized(const FieldMatrix<K, N, N>& LU,
+                                const FieldVector<int, N>& pivots,
+                                FieldVector<K, N>& x)
+{
+  static_for<0, N>([&](auto ii) {
+    if (pivots[ii] != int(ii))
+      std::swap(x[ii], x[pivots[ii]]);
+  });
+  static_for<0, N>([&](auto ii_) {
+    constexpr size_t ii = decltype(ii_)::value;
+    static_for<0, ii>([&](auto jj) { x[ii] -= LU[ii][jj] * x[jj]; });
+  });
+  static_for<0, N>([&](auto ii_) {
+    constexpr size_t ii = N - 1 - decltype(ii_)::value;
+    static_for<ii + 1, N>([&](auto jj) { x[ii] -= LU[ii][jj] * x[jj]; });
+    x[ii] /= LU[ii][ii];
+  });
+} // ... static_solve_lu_factorized(...)
+
+// Replaces A by its inverse, returns false (and leaves A untouched) if A is singular
+template <class K, int N>
+bool static_invert(FieldMatrix<K, N, N>& A)
+{
+  FieldMatrix<K, N, N> LU = A;
+  FieldVector<int, N> pivots;
+  if (!static_lu(LU, pivots))
+    return false;
+  static_for<0, N>([&](auto jj) {
+    FieldVector<K, N> column(0.);
+    column[jj] = K(1);
+    static_solve_lu_factorized(LU, pivots, column);
+    static_for<0, N>([&](auto ii) { A[ii][jj] = column[ii]; });
+  });
+  return true;
+} // ... static_invert(...)
+
+
+/**
+ * \brief Householder QR factorization with column pivoting, AP = QR.
+ *
+ * Computes exactly the same compressed form as qr_decomposition (R in the upper triangular part of A, the Householder
+ * vectors below the diagonal and their multipliers in tau), but without any dynamic memory.
+ */
+template <class K, int N, class VectorType, class IndexVectorType>
+void static_qr(FieldMatrix<K, N, N>& A, VectorType& tau, IndexVectorType& permutations)
+{
+  using V = Common::VectorAbstraction<VectorType>;
+  using VI = Common::VectorAbstraction<IndexVectorType>;
+  using IndexType = typename VI::ScalarType;
+  FieldVector<K, N> col_norms(0.);
+  static_for<0, N>([&](auto jj) {
+    V::set_entry(tau, jj, 0.);
+    VI::set_entry(permutations, jj, static_cast<IndexType>(jj));
+    static_for<0, N>([&](auto ii) { col_norms[jj] += A[ii][jj] * A[ii][jj]; });
+  });
+  static_for<0, N - 1>([&](auto jj_) {
+    constexpr size_t jj = decltype(jj_)::value;
+    // swap column jj and the column with the greatest norm
+    size_t max_index = jj;
+    static_for<jj + 1, N>([&](auto cc) {
+      if (col_norms[cc] > col_norms[max_index])
+        max_index = cc;
+    });
+    if (max_index != jj) {
+      std::swap(col_norms[jj], col_norms[max_index]);
+      const auto tmp_index = VI::get_entry(permutations, jj);
+      VI::set_entry(permutations, jj, VI::get_entry(permutations, max_index));
+      VI::set_entry(permutations, max_index, tmp_index);
+      static_for<0, N>([&](auto rr) { std::swap(A[rr][jj], A[rr][max_index]); });
+    }
+    // reduction by the householder matrix H = I - tau w w^T, w = [1; A(jj+1:N, jj)]
+    K normx(0);
+    static_for<jj, N>([&](auto rr) { normx += A[rr][jj] * A[rr][jj]; });
+    normx = std::sqrt(normx);
+    if (normx != 0.) {
+      const K s = A[jj][jj] < 0 ? K(1) : K(-1);
+      const K u1 = A[jj][jj] - s * normx;
+      const K inverse_u1 = K(1) / u1;
+      static_for<jj + 1, N>([&](auto rr) { A[rr][jj] *= inverse_u1; });
+      A[jj][jj] = s * normx;
+      const K tau_jj = -s * u1 / normx;
+      V::set_entry(tau, jj, tau_jj);
+      static_for<jj + 1, N>([&](auto cc) {
+        K wT_a = A[jj][cc];
+        static_for<jj + 1, N>([&](auto rr) { wT_a += A[rr][jj] * A[rr][cc]; });
+        wT_a *= tau_jj;
+        A[jj][cc] -= wT_a;
+        static_for<jj + 1, N>([&](auto rr) { A[rr][cc] -= wT_a * A[rr][jj]; });
+      });
+    }
+    // norm downdate
+    static_for<jj + 1, N>([&](auto cc) { col_norms[cc] -= A[jj][cc] * A[jj][cc]; });
+  });
+} // ... static_qr(...)
+
+// Solves A x = x, where AP = QR is given by static_qr
+template <class K, int N, class VectorType, class IndexVectorType>
+void static_solve_qr_factorized(const FieldMatrix<K, N, N>& QR,
+                                const VectorType& tau,
+                                const IndexVectorType& permutations,
+                                FieldVector<K, N>& x)
+{
+  using V = Common::VectorAbstraction<VectorType>;
+  using VI = Common::VectorAbstraction<IndexVectorType>;
+  // x = Q^T x
+  static_for<0, N - 1>([&](auto jj_) {
+    constexpr size_t jj = decltype(jj_)::value;
+    K wT_x = x[jj];
+    static_for<jj + 1, N>([&](auto rr) { wT_x += QR[rr][jj] * x[rr]; });
+    wT_x *= V::get_entry(tau, jj);
+    x[jj] -= wT_x;
+    static_for<jj + 1, N>([&](auto rr) { x[rr] -= wT_x * QR[rr][jj]; });
+  });
+  // x = R^{-1} x
+  static_for<0, N>([&](auto ii_) {
+    constexpr size_t ii = N - 1 - decltype(ii_)::value;
+    static_for<ii + 1, N>([&](auto jj) { x[ii] -= QR[ii][jj] * x[jj]; });
+    if (!(std::abs(QR[ii][ii]) > 0)) // also throws on NaNs
+      DUNE_THROW(Dune::MathError, "Triangular solve failed, matrix is singular!");
+    x[ii] /= QR[ii][ii];
+  });
+  // undo permutations
+  const FieldVector<K, N> y = x;
+  static_for<0, N>([&](auto ii) { x[VI::get_entry(permutations, ii)] = y[ii]; });
+} // ... static_solve_qr_factorized(...)
+
+
+} // namespace internal
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_STATIC_SIZE_KERNELS_HH
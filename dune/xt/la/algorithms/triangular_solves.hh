@@ -11,6 +11,15 @@
 #ifndef DUNE_XT_LA_ALGORITHMS_SOLVE_LOWER_TRIANGULAR_HH
 #define DUNE_XT_LA_ALGORITHMS_SOLVE_LOWER_TRIANGULAR_HH
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#if HAVE_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
 #include <dune/common/exceptions.hh>
 
 #include <dune/xt/common/cblas.hh>
@@ -453,6 +462,202 @@ solve_upper_triangular_transposed(const MatrixType& A, FirstVectorType& x, const
 } // void solve_upper_triangular_transposed(...)
 
 
+/**
+ * \brief Dependency levels of the rows of a sparse triangular matrix, used for level-scheduled triangular solves.
+ *
+ * In a forward (backward) substitution, row ii depends on all rows jj < ii (jj > ii) with a nonzero entry (ii, jj).
+ * Rows without dependencies form level 0, all other rows belong to the level following the highest level of the rows
+ * they depend on. The rows of one level are thus independent of each other and are processed concurrently by
+ * for_each_row() if TBB is available.
+ */
+class TriangularLevelSchedule
+{
+public:
+  TriangularLevelSchedule()
+    : level_pointers_(1, 0)
+  {}
+
+  /**
+   * \brief Computes the levels from a row-wise (CSR) index structure, only the entries of the given (strict) triangle
+   *        are taken into account.
+   */
+  TriangularLevelSchedule(const size_t size, const size_t* row_pointers, const size_t* column_indices, const bool lower)
+  {
+    std::vector<size_t> levels(size, 0);
+    size_t num_levels = 0;
+    for (size_t nn = 0; nn < size; ++nn) {
+      const size_t ii = lower ? nn : size - 1 - nn;
+      size_t level = 0;
+      for (size_t kk = row_pointers[ii]; kk < row_pointers[ii + 1]; ++kk) {
+        const size_t jj = column_indices[kk];
+        if (lower ? jj < ii : jj > ii)
+          level = std::max(level, levels[jj] + 1);
+      }
+      levels[ii] = level;
+      num_levels = std::max(num_levels, level + 1);
+    } // nn
+    // sort the rows by level (counting sort, so the rows of each level stay in ascending order)
+    level_pointers_.assign(num_levels + 1, 0);
+    for (const auto& level : levels)
+      ++level_pointers_[level + 1];
+    for (size_t ll = 0; ll < num_levels; ++ll)
+      level_pointers_[ll + 1] += level_pointers_[ll];
+    rows_.resize(size);
+    std::vector<size_t> next_position(level_pointers_.begin(), level_pointers_.end() - 1);
+    for (size_t ii = 0; ii < size; ++ii)
+      rows_[next_position[levels[ii]]++] = ii;
+  } // TriangularLevelSchedule(...)
+
+  size_t num_levels() const
+  {
+    return level_pointers_.size() - 1;
+  }
+
+  //! The rows of level ll are rows()[level_pointers()[ll]], ..., rows()[level_pointers()[ll + 1] - 1].
+  const std::vector<size_t>& level_pointers() const
+  {
+    return level_pointers_;
+  }
+
+  const std::vector<size_t>& rows() const
+  {
+    return rows_;
+  }
+
+  /**
+   * \brief Calls row_kernel(ii) for all rows ii, level by level.
+   *
+   * If TBB is available, the rows of levels containing at least min_parallel_rows rows are processed concurrently,
+   * smaller levels are not worth the synchronization.
+   */
+  template <class RowKernelType>
+  void for_each_row(const RowKernelType& row_kernel, const size_t min_parallel_rows = 512) const
+  {
+    for (size_t ll = 0; ll < num_levels(); ++ll) {
+      const size_t begin = level_pointers_[ll];
+      const size_t end = level_pointers_[ll + 1];
+#if HAVE_TBB
+      if (end - begin >= min_parallel_rows) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(begin, end, std::max(min_parallel_rows / 8, size_t(1))),
+                          [&](const tbb::blocked_range<size_t>& range) {
+                            for (size_t kk = range.begin(); kk != range.end(); ++kk)
+                              row_kernel(rows_[kk]);
+                          });
+        continue;
+      }
+#else // HAVE_TBB
+      (void)min_parallel_rows;
+#endif
+      for (size_t kk = begin; kk < end; ++kk)
+        row_kernel(rows_[kk]);
+    } // ll
+  } // ... for_each_row(...)
+
+private:
+  std::vector<size_t> level_pointers_;
+  std::vector<size_t> rows_;
+}; // class TriangularLevelSchedule
+
+
+/**
+ * \brief Level-scheduled solver for A x = b with a sparse (CSR or CSC) lower or upper triangular matrix A.
+ *
+ * The dependency analysis is done once in the constructor and apply() may be called repeatedly, also after the entries
+ * of A have been changed (as long as its pattern stays the same, A is not copied). The index structure of A is
+ * rearranged row-wise (which is only a copy for CSR matrices), so each row pulls the values it depends on and no
+ * concurrent updates of the same entry of x are needed, regardless of the storage layout.
+ * \note The matrix A is stored as a reference and has to outlive this object.
+ */
+template <class MatrixType>
+class LevelScheduledTriangularSolver
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  static_assert(internal::has_compressed_sparse_layout<MatrixType>,
+                "Only implemented for matrices in CSR or CSC format!");
+
+public:
+  using ScalarType = typename M::ScalarType;
+
+  LevelScheduledTriangularSolver(const MatrixType& A, const Common::MatrixPattern triangular_type)
+    : matrix_(A)
+    , size_(M::rows(A))
+    , row_pointers_(size_ + 1, 0)
+    , diagonal_indices_(size_, std::numeric_limits<size_t>::max())
+  {
+    if (M::cols(A) != size_)
+      DUNE_THROW(Dune::InvalidStateException, "Matrix has to be square!");
+    const bool lower = (triangular_type == Common::MatrixPattern::lower_triangular);
+    constexpr bool csr = (M::storage_layout == Common::StorageLayout::csr);
+    const auto* outer_pointers = A.outer_index_ptr();
+    const auto* inner_indices = A.inner_index_ptr();
+    const auto for_each_entry = [&](const auto& visitor) {
+      for (size_t oo = 0; oo < size_; ++oo)
+        for (size_t kk = outer_pointers[oo]; kk < outer_pointers[oo + 1]; ++kk)
+          visitor(csr ? oo : inner_indices[kk], csr ? inner_indices[kk] : oo, kk);
+    };
+    const auto in_triangle = [&](const size_t ii, const size_t jj) { return lower ? jj < ii : jj > ii; };
+    for_each_entry([&](const size_t ii, const size_t jj, const size_t kk) {
+      if (ii == jj)
+        diagonal_indices_[ii] = kk;
+      else if (in_triangle(ii, jj))
+        ++row_pointers_[ii + 1];
+    });
+    for (size_t ii = 0; ii < size_; ++ii) {
+      if (diagonal_indices_[ii] == std::numeric_limits<size_t>::max())
+        DUNE_THROW(Dune::MathError, "Triangular solve failed, matrix is singular!");
+      row_pointers_[ii + 1] += row_pointers_[ii];
+    }
+    column_indices_.resize(row_pointers_[size_]);
+    entry_indices_.resize(row_pointers_[size_]);
+    std::vector<size_t> next_position(row_pointers_.begin(), row_pointers_.end() - 1);
+    for_each_entry([&](const size_t ii, const size_t jj, const size_t kk) {
+      if (in_triangle(ii, jj)) {
+        column_indices_[next_position[ii]] = jj;
+        entry_indices_[next_position[ii]++] = kk;
+      }
+    });
+    schedule_ = TriangularLevelSchedule(size_, row_pointers_.data(), column_indices_.data(), lower);
+  } // LevelScheduledTriangularSolver(...)
+
+  LevelScheduledTriangularSolver(MatrixType&& A, const Common::MatrixPattern triangular_type) = delete;
+
+  /**
+   * \brief Solves A x = b, x and b may be the same vector.
+   */
+  template <class FirstVectorType, class SecondVectorType>
+  void apply(FirstVectorType& x, const SecondVectorType& b) const
+  {
+    using V1 = Common::VectorAbstraction<FirstVectorType>;
+    using V2 = Common::VectorAbstraction<SecondVectorType>;
+    assert(V1::size(x) == size_ && V2::size(b) == size_);
+    const auto* entries = matrix_.entries();
+    schedule_.for_each_row([&](const size_t ii) {
+      ScalarType sum = V2::get_entry(b, ii);
+      for (size_t kk = row_pointers_[ii]; kk < row_pointers_[ii + 1]; ++kk)
+        sum -= entries[entry_indices_[kk]] * V1::get_entry(x, column_indices_[kk]);
+      const ScalarType diagonal_entry = entries[diagonal_indices_[ii]];
+      if (diagonal_entry == ScalarType(0))
+        DUNE_THROW(Dune::MathError, "Triangular solve failed, matrix is singular!");
+      V1::set_entry(x, ii, sum / diagonal_entry);
+    });
+  } // ... apply(...)
+
+  const TriangularLevelSchedule& schedule() const
+  {
+    return schedule_;
+  }
+
+private:
+  const MatrixType& matrix_;
+  const size_t size_;
+  std::vector<size_t> row_pointers_;
+  std::vector<size_t> column_indices_;
+  std::vector<size_t> entry_indices_;
+  std::vector<size_t> diagonal_indices_;
+  TriangularLevelSchedule schedule_;
+}; // class LevelScheduledTriangularSolver
+
+
 } // namespace LA
 } // namespace XT
 } // namespace Dune
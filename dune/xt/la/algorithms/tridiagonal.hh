@@ -0,0 +1,281 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_ALGORITHMS_TRIDIAGONAL_HH
+#define DUNE_XT_LA_ALGORITHMS_TRIDIAGONAL_HH
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#if HAVE_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fmatrix.hh>
+#include <dune/common/ftraits.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/xt/common/exceptions.hh>
+
+#include <dune/xt/la/algorithms/static_size_kernels.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+// calls f(kk) for kk = 0, ..., count - 1, in parallel if TBB is available and count is large enough
+template <class FunctionType>
+void tridiagonal_parallel_for(const size_t count, const FunctionType& f)
+{
+#if HAVE_TBB
+  if (count >= 4096) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, 1024), [&](const tbb::blocked_range<size_t>& range) {
+      for (size_t kk = range.begin(); kk != range.end(); ++kk)
+        f(kk);
+    });
+    return;
+  }
+#endif
+  for (size_t kk = 0; kk < count; ++kk)
+    f(kk);
+} // ... tridiagonal_parallel_for(...)
+
+
+} // namespace internal
+
+
+/**
+ * \brief Solves num_systems independent tridiagonal systems of the same size by the Thomas algorithm (Gaussian
+ *        elimination without pivoting, so the matrices should be diagonally dominant or symmetric positive definite).
+ *
+ * All arrays are interleaved, i.e. entry ii of system ss is stored at position ii * num_systems + ss, such that all
+ * loops run over the systems in the innermost loop and are vectorized across the systems. lower[ii] couples unknown ii
+ * to unknown ii - 1 (lower[0], ..., lower[num_systems - 1] are not used), upper[ii] couples unknown ii to unknown
+ * ii + 1 (the last num_systems entries are not used). rhs is overwritten by the solutions.
+ * \throws MathError if a pivot of one of the systems is not larger than FMatrixPrecision::absolute_limit() in modulus
+ *         (or NaN), before dividing by it.
+ */
+template <class ScalarType>
+void batched_tridiagonal_solve(const size_t size,
+                               const size_t num_systems,
+                               const ScalarType* lower,
+                               const ScalarType* diag,
+                               const ScalarType* upper,
+                               ScalarType* rhs)
+{
+  if (size == 0 || num_systems == 0)
+    return;
+  const size_t m = num_systems;
+  const auto limit = FMatrixPrecision<typename FieldTraits<ScalarType>::real_type>::absolute_limit();
+  // modified upper diagonal and the pivots of the current row (all systems are checked before any division, the loops
+  // over the systems are thus still vectorized)
+  std::vector<ScalarType> upper_tilde(size * m);
+  std::vector<ScalarType> pivots(m);
+  for (size_t ii = 0; ii < size; ++ii) {
+    const size_t row = ii * m;
+    bool singular = false;
+    for (size_t ss = 0; ss < m; ++ss) {
+      pivots[ss] = diag[row + ss];
+      if (ii > 0)
+        pivots[ss] -= lower[row + ss] * upper_tilde[row - m + ss];
+      singular = singular || !(std::abs(pivots[ss]) > limit); // also catches NaNs
+    }
+    if (singular)
+      DUNE_THROW(MathError, "Zero pivot in the Thomas algorithm, the matrix has to be diagonally dominant!");
+    for (size_t ss = 0; ss < m; ++ss) {
+      if (ii > 0)
+        rhs[row + ss] -= lower[row + ss] * rhs[row - m + ss];
+      upper_tilde[row + ss] = upper[row + ss] / pivots[ss];
+      rhs[row + ss] /= pivots[ss];
+    }
+  }
+  for (size_t ii = size - 1; ii-- > 0;) {
+    const size_t row = ii * m;
+    for (size_t ss = 0; ss < m; ++ss)
+      rhs[row + ss] -= upper_tilde[row + ss] * rhs[row + m + ss];
+  }
+} // ... batched_tridiagonal_solve(...)
+
+
+/**
+ * \brief Batched variant of solve_sym_tridiag_posdef, computing an LDL^T factorization of each system.
+ *
+ * Uses the same interleaved layout as batched_tridiagonal_solve, subdiag[ii * num_systems + ss] is the entry (ii + 1,
+ * ii) of system ss (thus only the first (size - 1) * num_systems entries are used). diag and subdiag are overwritten by
+ * the factorizations (as by tridiagonal_ldlt) and rhs by the solutions.
+ * \throws MathError if one of the matrices is not positive definite.
+ */
+template <class ScalarType>
+void batched_solve_sym_tridiag_posdef(const size_t size,
+                                      const size_t num_systems,
+                                      ScalarType* diag,
+                                      ScalarType* subdiag,
+                                      ScalarType* rhs)
+{
+  if (size == 0 || num_systems == 0)
+    return;
+  const size_t m = num_systems;
+  bool positive = true;
+  // factorize and solve L z = rhs
+  for (size_t ii = 0; ii + 1 < size; ++ii) {
+    const size_t row = ii * m;
+    for (size_t ss = 0; ss < m; ++ss) {
+      positive = positive && (diag[row + ss] > 0); // also catches NaNs
+      subdiag[row + ss] /= diag[row + ss];
+      diag[row + m + ss] -= diag[row + ss] * subdiag[row + ss] * subdiag[row + ss];
+      rhs[row + m + ss] -= subdiag[row + ss] * rhs[row + ss];
+    }
+  }
+  for (size_t ss = 0; ss < m; ++ss)
+    positive = positive && (diag[(size - 1) * m + ss] > 0);
+  if (!positive)
+    DUNE_THROW(MathError, "LDL^T factorization failed!");
+  // solve D L^T x = z
+  for (size_t ss = 0; ss < m; ++ss)
+    rhs[(size - 1) * m + ss] /= diag[(size - 1) * m + ss];
+  for (size_t ii = size - 1; ii-- > 0;) {
+    const size_t row = ii * m;
+    for (size_t ss = 0; ss < m; ++ss)
+      rhs[row + ss] = rhs[row + ss] / diag[row + ss] - subdiag[row + ss] * rhs[row + m + ss];
+  }
+} // ... batched_solve_sym_tridiag_posdef(...)
+
+
+/**
+ * \brief Solves a single (long) tridiagonal system by cyclic reduction.
+ *
+ * Uses the same conventions as batched_tridiagonal_solve with num_systems = 1. In each of the log2(size) reduction
+ * steps, the odd unknowns (of the current level) are eliminated from the even ones, all of which can be updated
+ * independently. These updates (and the ones of the back substitution) are done in parallel if TBB is available. As
+ * for the Thomas algorithm, no pivoting is done. lower, diag and upper are used as workspace and overwritten.
+ * \throws MathError if a pivot is not larger than FMatrixPrecision::absolute_limit() in modulus (or NaN), before
+ *         dividing by it.
+ */
+template <class ScalarType>
+void cyclic_reduction_tridiagonal_solve(std::vector<ScalarType>& lower,
+                                        std::vector<ScalarType>& diag,
+                                        std::vector<ScalarType>& upper,
+                                        std::vector<ScalarType>& rhs)
+{
+  const size_t size = diag.size();
+  if (lower.size() != size || upper.size() != size || rhs.size() != size)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "lower, diag, upper and rhs need to have the same size!\n   lower.size() = "
+                   << lower.size() << "\n   diag.size() = " << diag.size() << "\n   upper.size() = " << upper.size()
+                   << "\n   rhs.size() = " << rhs.size());
+  if (size == 0)
+    return;
+  lower[0] = ScalarType(0);
+  upper[size - 1] = ScalarType(0);
+  const auto limit = FMatrixPrecision<typename FieldTraits<ScalarType>::real_type>::absolute_limit();
+  // the unknowns ii with (ii + 1) % (2 s) == s are the pivots of the step with stride s (and are not changed
+  // afterwards), every unknown is a pivot of exactly one step
+  const auto check_pivots = [&](const size_t pivot_stride) {
+    for (size_t ii = pivot_stride - 1; ii < size; ii += 2 * pivot_stride)
+      if (!(std::abs(diag[ii]) > limit)) // also catches NaNs
+        DUNE_THROW(MathError, "Zero pivot in cyclic reduction!");
+  };
+  // forward reduction, in the step with stride s, the unknowns ii with (ii + 1) % (2 s) == 0 are updated
+  size_t stride = 1;
+  for (; 2 * stride <= size; stride *= 2) {
+    check_pivots(stride);
+    internal::tridiagonal_parallel_for(size / (2 * stride), [&](const size_t kk) {
+      const size_t ii = (kk + 1) * 2 * stride - 1;
+      const size_t below = ii - stride;
+      const size_t above = ii + stride;
+      const ScalarType alpha = -lower[ii] / diag[below];
+      diag[ii] += alpha * upper[below];
+      rhs[ii] += alpha * rhs[below];
+      lower[ii] = alpha * lower[below];
+      if (above < size) {
+        const ScalarType gamma = -upper[ii] / diag[above];
+        diag[ii] += gamma * lower[above];
+        rhs[ii] += gamma * rhs[above];
+        upper[ii] = gamma * upper[above];
+      } else
+        upper[ii] = ScalarType(0);
+    });
+  }
+  // the last remaining unknown stride - 1
+  check_pivots(stride);
+  rhs[stride - 1] /= diag[stride - 1];
+  // back substitution, in the step with stride s, the unknowns ii with (ii + 1) % (2 s) == s are computed
+  for (stride /= 2; stride > 0; stride /= 2) {
+    internal::tridiagonal_parallel_for((size / stride + 1) / 2, [&](const size_t kk) {
+      const size_t ii = (2 * kk + 1) * stride - 1;
+      ScalarType value = rhs[ii];
+      if (ii >= stride)
+        value -= lower[ii] * rhs[ii - stride];
+      if (ii + stride < size)
+        value -= upper[ii] * rhs[ii + stride];
+      rhs[ii] = value / diag[ii];
+    });
+  }
+} // ... cyclic_reduction_tridiagonal_solve(...)
+
+
+/**
+ * \brief Solves a block tridiagonal system with b x b blocks by the block Thomas algorithm.
+ *
+ * diag contains the n diagonal blocks, lower[ii] is the block (ii + 1, ii) and upper[ii] the block (ii, ii + 1) (both
+ * of length n - 1). The (modified) diagonal blocks are LU factorized with partial pivoting, the blocks are not pivoted
+ * against each other. rhs is overwritten by the solution.
+ * \throws MathError if one of the modified diagonal blocks is singular.
+ */
+template <class K, int b>
+void solve_block_tridiagonal(const std::vector<FieldMatrix<K, b, b>>& lower,
+                             const std::vector<FieldMatrix<K, b, b>>& diag,
+                             const std::vector<FieldMatrix<K, b, b>>& upper,
+                             std::vector<FieldVector<K, b>>& rhs)
+{
+  const size_t size = diag.size();
+  if (size == 0)
+    return;
+  if (lower.size() != size - 1 || upper.size() != size - 1 || rhs.size() != size)
+    DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+               "Number of diagonal blocks: " << size << "\n   lower.size() = " << lower.size()
+                                             << "\n   upper.size() = " << upper.size()
+                                             << "\n   rhs.size() = " << rhs.size());
+  // upper_tilde[ii] = D_ii^{-1} U_ii, where D_ii is the modified diagonal block
+  std::vector<FieldMatrix<K, b, b>> upper_tilde(size - 1);
+  FieldMatrix<K, b, b> lu;
+  FieldVector<int, b> pivots;
+  FieldVector<K, b> column;
+  for (size_t ii = 0; ii < size; ++ii) {
+    lu = diag[ii];
+    if (ii > 0) {
+      // D_ii = A_ii - L_{ii - 1} upper_tilde[ii - 1], rhs_ii -= L_{ii - 1} rhs_{ii - 1}
+      lu -= lower[ii - 1].rightmultiplyany(upper_tilde[ii - 1]);
+      lower[ii - 1].mmv(rhs[ii - 1], rhs[ii]);
+    }
+    if (!internal::static_lu(lu, pivots))
+      DUNE_THROW(MathError, "Block " << ii << " of the block Thomas algorithm is singular!");
+    internal::static_solve_lu_factorized(lu, pivots, rhs[ii]);
+    if (ii + 1 < size)
+      for (size_t jj = 0; jj < b; ++jj) {
+        for (size_t kk = 0; kk < b; ++kk)
+          column[kk] = upper[ii][kk][jj];
+        internal::static_solve_lu_factorized(lu, pivots, column);
+        for (size_t kk = 0; kk < b; ++kk)
+          upper_tilde[ii][kk][jj] = column[kk];
+      }
+  } // ii
+  for (size_t ii = size - 1; ii-- > 0;)
+    upper_tilde[ii].mmv(rhs[ii + 1], rhs[ii]);
+} // ... solve_block_tridiagonal(...)
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_ALGORITHMS_TRIDIAGONAL_HH
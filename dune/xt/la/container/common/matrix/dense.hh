@@ -27,6 +27,7 @@
 #include <dune/xt/common/float_cmp.hh>
 #include <dune/xt/common/vector.hh>
 
+#include <dune/xt/la/algorithms/gemm.hh>
 #include <dune/xt/la/container/matrix-interface.hh>
 #include <dune/xt/la/container/pattern.hh>
 #include <dune/xt/la/container/vector-view.hh>
@@ -515,21 +516,48 @@ public:
   using InterfaceType::operator-;
   using InterfaceType::operator+=;
   using InterfaceType::operator-=;
+  using InterfaceType::operator*;
+
+  virtual ThisType operator*(const ThisType& other) const override
+  {
+    if (other.rows() != cols())
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match, "Dimensions of matrices to be multiplied do not match!");
+    ThisType ret(rows(), other.cols());
+    gemm(*this, other, ret);
+    return ret;
+  }
+
+  /// \note Uses gemm if other is stored densely with the same ScalarType.
+  template <class OtherMatrixType>
+  std::enable_if_t<internal::is_gemm_compatible<OtherMatrixType, ScalarType>::value, void>
+  rightmultiply(const OtherMatrixType& other)
+  {
+    using M = typename Common::MatrixAbstraction<OtherMatrixType>;
+    if (M::rows(other) != cols())
+      DUNE_THROW(Dune::XT::Common::Exceptions::shapes_do_not_match,
+                 "For rightmultiply, the number of columns of this has to match the number of rows of other!");
+    ThisType result(rows(), M::cols(other));
+    gemm(*this, other, result);
+    *backend_ = std::move(*result.backend_);
+  }
 
   template <class OtherMatrixType>
-  void rightmultiply(const OtherMatrixType& other)
+  std::enable_if_t<!internal::is_gemm_compatible<OtherMatrixType, ScalarType>::value, void>
+  rightmultiply(const OtherMatrixType& other)
   {
     using M = typename Common::MatrixAbstraction<OtherMatrixType>;
     static_assert(M::is_matrix, "");
-    BackendType new_backend(rows(), M::cols(other), ScalarType(0.));
     if (M::rows(other) != cols())
       DUNE_THROW(Dune::XT::Common::Exceptions::shapes_do_not_match,
                  "For rightmultiply, the number of columns of this has to match the number of rows of other!");
+    BackendType new_backend(rows(), M::cols(other), ScalarType(0.));
     for (size_t rr = 0; rr < rows(); ++rr)
-      for (size_t cc = 0; cc < cols(); ++cc)
-        for (size_t kk = 0; kk < cols(); ++kk)
-          new_backend->get_entry_ref(rr, cc) += get_entry(rr, kk) * M::get_entry(other, kk, cc);
-    *backend_ = new_backend;
+      for (size_t kk = 0; kk < cols(); ++kk) {
+        const ScalarType entry = get_entry(rr, kk);
+        for (size_t cc = 0; cc < M::cols(other); ++cc)
+          new_backend.get_entry_ref(rr, cc) += entry * M::get_entry(other, kk, cc);
+      }
+    *backend_ = std::move(new_backend);
   }
 
   virtual ThisType pruned(const typename Common::FloatCmp::DefaultEpsilon<ScalarType>::Type eps =
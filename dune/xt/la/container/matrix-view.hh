@@ -133,6 +133,12 @@ public:
     return first_col_ + jj;
   }
 
+  //! The viewed matrix, row_index() and col_index() map to its indices.
+  const Matrix& matrix() const
+  {
+    return matrix_;
+  }
+
   inline size_t rows() const
   {
     return past_last_row_ - first_row_;
@@ -342,6 +348,12 @@ public:
     return const_matrix_view_.col_index(jj);
   }
 
+  //! The viewed matrix, row_index() and col_index() map to its indices.
+  const Matrix& matrix() const
+  {
+    return matrix_;
+  }
+
   inline size_t rows() const
   {
     return const_matrix_view_.rows();
@@ -406,6 +418,11 @@ public:
     return const_matrix_view_.pattern(prune, eps);
   } // ... pattern(...)
 
+  const SparsityPatternDefault& get_pattern() const
+  {
+    return const_matrix_view_.get_pattern();
+  }
+
   inline void add_to_entry(const size_t ii, const size_t jj, const ScalarType& value)
   {
     assert(ii < rows() && jj < cols());
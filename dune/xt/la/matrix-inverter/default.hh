@@ -12,6 +12,9 @@
 #ifndef DUNE_XT_LA_MATRIX_INVERTER_DEFAULT_HH
 #define DUNE_XT_LA_MATRIX_INVERTER_DEFAULT_HH
 
+#include <vector>
+
+#include <dune/xt/la/algorithms/lu.hh>
 #include <dune/xt/la/algorithms/qr.hh>
 #include <dune/xt/la/exceptions.hh>
 #include <dune/xt/la/matrix-inverter.hh>
@@ -43,10 +46,21 @@ public:
 }; // class MatrixInverterOptions<MatrixType, true>
 
 
+/**
+ * \brief Inverts dense matrices in place by Gauss-Jordan elimination (see invert_in_place), sparse ones by QR.
+ *
+ * Calling compute() again (e.g. after changing the entries of the matrix) reuses the memory of the previous inverse and
+ * of the pivots, so repeated inversions of matrices of the same size do not allocate (apart from the post checks, which
+ * can be disabled in the options).
+ */
 template <class MatrixImp>
 class MatrixInverter<MatrixImp, true> : public internal::MatrixInverterBase<MatrixImp>
 {
   using BaseType = internal::MatrixInverterBase<MatrixImp>;
+  using M = Common::MatrixAbstraction<MatrixImp>;
+  static constexpr bool is_dense = !is_matrix<MatrixImp>::value
+                                   || M::storage_layout == Common::StorageLayout::dense_row_major
+                                   || M::storage_layout == Common::StorageLayout::dense_column_major;
 
 public:
   using MatrixType = typename BaseType::MatrixType;
@@ -63,13 +77,9 @@ public:
 
   void compute() override final
   {
-    using M = Common::MatrixAbstraction<MatrixType>;
     const auto type = options_.template get<std::string>("type");
     if (type == "direct") {
-      inverse_ = M::make_unique(M::rows(matrix_), M::cols(matrix_));
-      auto tmp_matrix = M::make_unique(M::rows(matrix_), M::cols(matrix_));
-      *tmp_matrix = matrix_;
-      solve_by_qr_decomposition(*tmp_matrix, *inverse_, eye_matrix<MatrixType>(M::rows(matrix_)));
+      compute_direct(std::integral_constant<bool, is_dense>());
     } else
       DUNE_THROW(Common::Exceptions::internal_error,
                  "Given type '" << type
@@ -85,6 +95,36 @@ protected:
   using BaseType::inverse_;
   using BaseType::matrix_;
   using BaseType::options_;
+
+private:
+  void compute_direct(std::true_type /*is_dense*/)
+  {
+    const size_t rows = M::rows(matrix_);
+    const size_t cols = M::cols(matrix_);
+    if (!inverse_ || M::rows(*inverse_) != rows || M::cols(*inverse_) != cols)
+      inverse_ = M::make_unique(rows, cols);
+    for (size_t ii = 0; ii < rows; ++ii)
+      for (size_t jj = 0; jj < cols; ++jj)
+        M::set_entry(*inverse_, ii, jj, M::get_entry(matrix_, ii, jj));
+    try {
+      invert_in_place(*inverse_, pivots_);
+    } catch (const FMatrixError& ee) {
+      inverse_.reset();
+      DUNE_THROW(Exceptions::matrix_invert_failed_bc_data_did_not_fulfill_requirements,
+                 "This was the original error:\n\n"
+                     << ee.what());
+    }
+  } // ... compute_direct(...)
+
+  void compute_direct(std::false_type /*is_dense*/)
+  {
+    inverse_ = M::make_unique(M::rows(matrix_), M::cols(matrix_));
+    auto tmp_matrix = M::make_unique(M::rows(matrix_), M::cols(matrix_));
+    *tmp_matrix = matrix_;
+    solve_by_qr_decomposition(*tmp_matrix, *inverse_, eye_matrix<MatrixType>(M::rows(matrix_)));
+  }
+
+  std::vector<size_t> pivots_;
 }; // class MatrixInverter<MatrixType, true>
 
 
@@ -16,6 +16,7 @@
 
 #include <dune/xt/common/fmatrix.hh>
 
+#include <dune/xt/la/algorithms/static_size_kernels.hh>
 #include <dune/xt/la/exceptions.hh>
 #include <dune/xt/la/container/conversion.hh>
 #include <dune/xt/la/container/eigen/dense.hh>
@@ -27,6 +28,33 @@
 namespace Dune {
 namespace XT {
 namespace LA {
+namespace internal {
+
+
+// uses FieldMatrix::invert in general and an unrolled LU decomposition for small square matrices
+template <class K, int ROWS, int COLS, bool = is_small_field_matrix<FieldMatrix<K, ROWS, COLS>>::value>
+struct FieldMatrixInverter
+{
+  static void invert(FieldMatrix<K, ROWS, COLS>& matrix)
+  {
+    XT::Common::FieldMatrix<K, ROWS, COLS> matrix_xt(matrix);
+    matrix_xt.invert();
+    matrix = matrix_xt;
+  }
+};
+
+template <class K, int ROWS, int COLS>
+struct FieldMatrixInverter<K, ROWS, COLS, true>
+{
+  static void invert(FieldMatrix<K, ROWS, COLS>& matrix)
+  {
+    if (!static_invert(matrix))
+      DUNE_THROW(FMatrixError, "matrix is singular");
+  }
+};
+
+
+} // namespace internal
 
 
 template <class K, int ROWS, int COLS>
@@ -83,10 +111,8 @@ public:
     const auto type = options_.template get<std::string>("type");
     if (type == "direct") {
       inverse_ = std::make_unique<MatrixType>(matrix_);
-      auto inverse_xt = std::make_unique<XT::Common::FieldMatrix<K, ROWS, COLS>>(*inverse_);
       try {
-        inverse_xt->invert();
-        *inverse_ = *inverse_xt;
+        internal::FieldMatrixInverter<K, ROWS, COLS>::invert(*inverse_);
       } catch (const FMatrixError& ee) {
         if (std::strcmp(ee.what(), "matrix is singular") != 0)
           DUNE_THROW(Exceptions::matrix_invert_failed_bc_data_did_not_fulfill_requirements,
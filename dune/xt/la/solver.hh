@@ -12,9 +12,18 @@
 #ifndef DUNE_XT_LA_SOLVER_HH
 #define DUNE_XT_LA_SOLVER_HH
 
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <random>
 #include <string>
 #include <vector>
 
+#include <dune/common/timer.hh>
+
 #include <dune/xt/common/configuration.hh>
 #include <dune/xt/common/matrix.hh>
 #include <dune/xt/common/parallel/helper.hh>
@@ -30,6 +39,164 @@ namespace internal {
 
 static const constexpr size_t max_size_to_print = 5;
 
+// systems with more rows are checked without an additional vector and mat-vec by default, see post_check_mode()
+static const constexpr size_t max_size_for_full_post_check = 10000;
+
+
+/**
+ * \brief Scalar type used for the factorization/preconditioner of the "mixed.*" solver types.
+ *
+ * The residual of these types is computed in the original precision, only the (expensive) inner solve is carried out
+ * in reduced precision.
+ */
+template <class S>
+struct reduced_precision
+{
+  using type = S;
+};
+
+template <>
+struct reduced_precision<double>
+{
+  using type = float;
+};
+
+template <class R>
+struct reduced_precision<std::complex<R>>
+{
+  using type = std::complex<typename reduced_precision<R>::type>;
+};
+
+
+/**
+ * \brief Cheap properties of a matrix, used to choose the solver for the "auto" types.
+ */
+struct MatrixProperties
+{
+  size_t rows = 0;
+  size_t non_zeros = 0;
+  bool symmetric = true;
+  bool positive_diagonal = true;
+  bool diagonally_dominant = true;
+
+  double non_zeros_per_row() const
+  {
+    return rows > 0 ? double(non_zeros) / rows : 0.;
+  }
+
+  // by Gershgorin's theorem, a symmetric diagonally dominant matrix with positive diagonal is positive semi-definite
+  bool spd() const
+  {
+    return symmetric && positive_diagonal && diagonally_dominant;
+  }
+}; // struct MatrixProperties
+
+
+/**
+ * \brief Computes the MatrixProperties in one sweep over the nonzero entries.
+ *
+ * visit_row(ii, f) has to call f(jj, a_ij) for all nonzero entries in row ii, get_entry(ii, jj) has to return a_ij.
+ * The matrix is considered symmetric (hermitian) if |a_ij - conj(a_ji)| <= symmetry_threshold for all entries, as for
+ * pre_check_symmetry.
+ */
+template <class RowVisitorType, class EntryAccessType>
+MatrixProperties compute_matrix_properties(const size_t rows,
+                                           const RowVisitorType& visit_row,
+                                           const EntryAccessType& get_entry,
+                                           const double symmetry_threshold)
+{
+  MatrixProperties ret;
+  ret.rows = rows;
+  for (size_t ii = 0; ii < rows; ++ii) {
+    double diagonal = 0.;
+    double off_diagonal_sum = 0.;
+    visit_row(ii, [&](const size_t jj, const auto& value) {
+      ++ret.non_zeros;
+      if (jj == ii) {
+        diagonal = std::real(value);
+      } else {
+        off_diagonal_sum += std::abs(value);
+        if (ret.symmetric && std::abs(value - std::conj(get_entry(jj, ii))) > symmetry_threshold)
+          ret.symmetric = false;
+      }
+    });
+    if (!(diagonal > 0.))
+      ret.positive_diagonal = false;
+    if (!(diagonal >= off_diagonal_sum))
+      ret.diagonally_dominant = false;
+  }
+  return ret;
+} // ... compute_matrix_properties(...)
+
+
+// the number of nonzeros of matrices without a non_zeros() method (e.g. dense matrices from dune-common) is rows * cols
+template <class MatrixType>
+auto setup_cache_non_zeros(const MatrixType& matrix, int) -> decltype(size_t(matrix.non_zeros()))
+{
+  return matrix.non_zeros();
+}
+
+template <class MatrixType>
+size_t setup_cache_non_zeros(const MatrixType& matrix, long)
+{
+  using M = Common::MatrixAbstraction<MatrixType>;
+  return M::rows(matrix) * M::cols(matrix);
+}
+
+
+/**
+ * \brief Keeps the setup of a solver type (e.g. a factorization or a preconditioner) alive between calls to apply().
+ *
+ * get() returns the object created last time, if it was created for the same type and the same matrix (same address,
+ * size and number of nonzeros) and if it was not reused more than max_reuse times since (a negative max_reuse means
+ * unlimited reuse). Otherwise, a new one is obtained from the given factory. Changes of the matrix entries are not
+ * detected, call clear() in that case.
+ */
+class SetupCache
+{
+public:
+  template <class T, class MatrixType, class FactoryType>
+  std::shared_ptr<T>
+  get(const std::string& type, const MatrixType& matrix, const int max_reuse, const FactoryType& factory)
+  {
+    const size_t rows = Common::MatrixAbstraction<MatrixType>::rows(matrix);
+    const size_t non_zeros = setup_cache_non_zeros(matrix, 0);
+    if (object_ && max_reuse != 0 && type == type_ && &matrix == matrix_address_ && rows == rows_
+        && non_zeros == non_zeros_ && (max_reuse < 0 || reuses_ < static_cast<size_t>(max_reuse))) {
+      ++reuses_;
+      return std::static_pointer_cast<T>(object_);
+    }
+    clear();
+    std::shared_ptr<T> ret = factory();
+    if (max_reuse != 0) {
+      object_ = ret;
+      type_ = type;
+      matrix_address_ = &matrix;
+      rows_ = rows;
+      non_zeros_ = non_zeros;
+    }
+    return ret;
+  } // ... get(...)
+
+  void clear()
+  {
+    object_.reset();
+    type_.clear();
+    matrix_address_ = nullptr;
+    rows_ = 0;
+    non_zeros_ = 0;
+    reuses_ = 0;
+  }
+
+private:
+  std::shared_ptr<void> object_;
+  std::string type_;
+  const void* matrix_address_ = nullptr;
+  size_t rows_ = 0;
+  size_t non_zeros_ = 0;
+  size_t reuses_ = 0;
+}; // class SetupCache
+
 
 class SolverUtils
 {
@@ -46,12 +213,123 @@ public:
                                 << ss.str());
     }
   }
+
+  /**
+   * \brief Decides how post_check_solves_system is carried out, given the option 'post_check_mode':
+   *        - "full": (A x - b).sup_norm() is computed, which requires an additional vector and mat-vec,
+   *        - "reported": the solution is accepted if the residual reported by the solver (or
+   *          statistics().final_residual) is below the threshold (its 2-norm bounds the sup-norm), the full check is
+   *          carried out otherwise,
+   *        - "sampled": only the entries of A x - b for 'post_check_samples' randomly drawn rows are computed,
+   *        - "auto": "full" for systems with at most max_size_for_full_post_check rows, otherwise "reported" if a
+   *          residual was reported and "sampled" if not.
+   *        Note that the residual reported by iterative solvers is usually updated recursively and may thus differ from
+   *        the true one.
+   */
+  static std::string post_check_mode(const Common::Configuration& opts,
+                                     const Common::Configuration& default_opts,
+                                     const size_t size,
+                                     const double reported_residual)
+  {
+    const auto mode = opts.get("post_check_mode", default_opts.get<std::string>("post_check_mode"));
+    check_given(mode, {"auto", "full", "reported", "sampled"});
+    const bool has_reported_residual = !std::isnan(reported_residual);
+    if (mode == "auto") {
+      if (size <= max_size_for_full_post_check)
+        return "full";
+      return has_reported_residual ? "reported" : "sampled";
+    } else if (mode == "reported" && !has_reported_residual)
+      return "full";
+    return mode;
+  } // ... post_check_mode(...)
+
+  /// \brief Draws num_samples rows from {0, ..., size - 1}, returns all rows if there are not more than num_samples.
+  static std::vector<size_t> sampled_rows(const size_t size, const size_t num_samples)
+  {
+    std::vector<size_t> rows;
+    if (size <= num_samples) {
+      rows.resize(size);
+      std::iota(rows.begin(), rows.end(), 0);
+    } else {
+      static thread_local std::mt19937 generator(std::random_device{}());
+      std::uniform_int_distribution<size_t> distribution(0, size - 1);
+      rows.resize(num_samples);
+      for (auto& row : rows)
+        row = distribution(generator);
+    }
+    return rows;
+  } // ... sampled_rows(...)
+
+  /// \brief Maximum of |row_residual(ii)| over the given rows (nan if any of these entries is nan).
+  template <class RowResidualType>
+  static double sampled_sup_norm(const std::vector<size_t>& rows, const RowResidualType& row_residual)
+  {
+    double ret = 0.;
+    for (const auto& ii : rows) {
+      const double abs_val = std::abs(row_residual(ii));
+      if (!(abs_val <= ret))
+        ret = abs_val;
+    }
+    return ret;
+  } // ... sampled_sup_norm(...)
 };
 
 
 } // namespace internal
 
 
+/**
+ * \brief Information about the last call to apply() of a Solver, see Solver::statistics().
+ *
+ * Residuals are given in the 2-norm of the respective backend, times in seconds. The setup time contains everything
+ * before the actual solve (factorization, preconditioner, copies of the matrix), the solve time the iterations or
+ * forward/backward substitutions. Values which are not available for the chosen type (e.g. the final residual of a
+ * direct solver if post_check_solves_system is disabled) or would require additional work (e.g. the residuals of an
+ * iterative solver for a nonzero initial guess, see the respective solver) are NaN.
+ */
+struct SolverStatistics
+{
+  std::string type;
+  size_t iterations = 0;
+  double initial_residual = std::numeric_limits<double>::quiet_NaN();
+  double final_residual = std::numeric_limits<double>::quiet_NaN();
+  double convergence_rate = std::numeric_limits<double>::quiet_NaN();
+  double setup_time = 0.;
+  double solve_time = 0.;
+  double post_check_time = 0.;
+  //! Estimate of the 1-norm condition number of the matrix (of its triangular factor for QR-based solvers), only
+  //! reported by some direct solvers.
+  double condition_estimate = std::numeric_limits<double>::quiet_NaN();
+  //! Only reported by the "*.recycled" types: dimension of the recycled subspace, the residual reduction due to the
+  //! projection onto it and the number of iterations this saved, estimated from the convergence rate.
+  size_t recycled_subspace_size = 0;
+  double recycled_residual_reduction = std::numeric_limits<double>::quiet_NaN();
+  double recycled_iterations_saved = std::numeric_limits<double>::quiet_NaN();
+
+  void reset(const std::string& tp)
+  {
+    *this = SolverStatistics();
+    type = tp;
+  }
+}; // struct SolverStatistics
+
+
+inline std::ostream& operator<<(std::ostream& out, const SolverStatistics& stats)
+{
+  out << "type: " << stats.type << "\niterations: " << stats.iterations
+      << "\ninitial_residual: " << stats.initial_residual << "\nfinal_residual: " << stats.final_residual
+      << "\nconvergence_rate: " << stats.convergence_rate << "\nsetup_time: " << stats.setup_time
+      << "s\nsolve_time: " << stats.solve_time << "s\npost_check_time: " << stats.post_check_time << "s";
+  if (!std::isnan(stats.condition_estimate))
+    out << "\ncondition_estimate: " << stats.condition_estimate;
+  if (!std::isnan(stats.recycled_residual_reduction))
+    out << "\nrecycled_subspace_size: " << stats.recycled_subspace_size
+        << "\nrecycled_residual_reduction: " << stats.recycled_residual_reduction
+        << "\nrecycled_iterations_saved: " << stats.recycled_iterations_saved;
+  return out;
+}
+
+
 template <class MatrixType, class CommunicatorType = SequentialCommunication>
 class SolverOptions
 {
@@ -137,6 +415,15 @@ public:
                "Please include the correct header for your matrix implementation '"
                    << Common::Typename<MatrixType>::value() << "'!");
   }
+
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    DUNE_THROW(NotImplemented,
+               "This is the unspecialized version of LA::Solver< ... >. "
+               "Please include the correct header for your matrix implementation '"
+                   << Common::Typename<MatrixType>::value() << "'!");
+  }
 }; // class Solver
 
 
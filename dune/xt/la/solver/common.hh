@@ -18,11 +18,15 @@
 #include <algorithm>
 #include <sstream>
 #include <cmath>
+#include <memory>
 
 #include <dune/xt/common/configuration.hh>
 
+#include <dune/xt/la/algorithms/lu.hh>
 #include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/algorithms/sparse_cholesky.hh>
 #include <dune/xt/la/container/common/matrix/dense.hh>
+#include <dune/xt/la/container/common/matrix/sparse.hh>
 #include <dune/xt/la/container/common/vector/dense.hh>
 
 #include "../solver.hh"
@@ -40,14 +44,24 @@ public:
 
   static std::vector<std::string> types()
   {
-    return {"qr.householder"};
+    return {"qr.householder", "lu.partialpiv", "mixed.lu"};
   }
 
   static Common::Configuration options(const std::string type = "")
   {
     const std::string tp = !type.empty() ? type : types()[0];
     internal::SolverUtils::check_given(tp, types());
-    return Common::Configuration({"type", "post_check_solves_system"}, {tp.c_str(), "1e-5"});
+    Common::Configuration default_options({"type", "post_check_solves_system", "post_check_mode", "post_check_samples"},
+                                          {tp.c_str(), "1e-5", "auto", "64"});
+    if (tp == "lu.partialpiv") {
+      default_options.set("reuse_setup", "0");
+      default_options.set("block_size", "64");
+    }
+    if (tp == "mixed.lu") {
+      default_options.set("refinement.max_iter", "20");
+      default_options.set("refinement.precision", "1e-14");
+    }
+    return default_options;
   }
 }; // class SolverOptions<CommonDenseMatrix<...>>
 
@@ -69,14 +83,12 @@ public:
 
   static std::vector<std::string> types()
   {
-    return {"qr.householder"};
+    return SolverOptions<MatrixType, CommunicatorType>::types();
   }
 
   static Common::Configuration options(const std::string type = "")
   {
-    const std::string tp = !type.empty() ? type : types()[0];
-    internal::SolverUtils::check_given(tp, types());
-    return Common::Configuration({"type", "post_check_solves_system"}, {tp.c_str(), "1e-5"});
+    return SolverOptions<MatrixType, CommunicatorType>::options(type);
   } // ... options(...)
 
   void apply(const CommonDenseVector<S>& rhs, CommonDenseVector<S>& solution) const
@@ -99,9 +111,32 @@ public:
     internal::SolverUtils::check_given(type, types());
     const Common::Configuration default_opts = options(type);
     // solve
+    statistics_.reset(type);
+    statistics_.initial_residual = rhs.l2_norm();
+    Dune::Timer timer;
     try {
-      auto QR = matrix_;
-      solve_by_qr_decomposition(QR, solution, rhs);
+      if (type == "qr.householder") {
+        auto QR = matrix_;
+        std::vector<S> tau(QR.cols());
+        std::vector<int> permutations(QR.cols());
+        qr(QR, tau, permutations);
+        statistics_.condition_estimate = qr_condition_estimate(QR);
+        statistics_.setup_time = timer.elapsed();
+        timer.reset();
+        solve_qr_factorized(QR, tau, permutations, solution, rhs);
+        statistics_.solve_time = timer.elapsed();
+      } else if (type == "lu.partialpiv") {
+        const auto lu = lu_factorization(opts, default_opts);
+        statistics_.condition_estimate = lu->condition_estimate();
+        statistics_.setup_time = timer.elapsed();
+        timer.reset();
+        lu->apply(rhs, solution);
+        statistics_.solve_time = timer.elapsed();
+      } else if (type == "mixed.lu") {
+        apply_mixed_lu(rhs, solution, opts, default_opts);
+      } else
+        DUNE_THROW(Common::Exceptions::internal_error,
+                   "Given type '" << type << "' is not supported, although it was reported by types()!");
     } catch (FMatrixError&) {
       DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
                  "The dune-common backend reported 'FMatrixError'!\n"
@@ -112,25 +147,300 @@ public:
     const R post_check_solves_system_threshold =
         opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
     if (post_check_solves_system_threshold > 0) {
+      timer.reset();
+      const auto post_check_mode = internal::SolverUtils::post_check_mode(
+          opts, default_opts, matrix_.rows(), statistics_.final_residual);
+      R sup_norm = 0;
+      if (post_check_mode == "reported" && statistics_.final_residual <= post_check_solves_system_threshold) {
+        sup_norm = statistics_.final_residual;
+      } else if (post_check_mode == "sampled") {
+        const auto rows = internal::SolverUtils::sampled_rows(
+            matrix_.rows(), opts.get("post_check_samples", default_opts.get<size_t>("post_check_samples")));
+        sup_norm = internal::SolverUtils::sampled_sup_norm(rows, [&](const size_t ii) {
+          S ret = -rhs.get_entry(ii);
+          for (size_t jj = 0; jj < matrix_.cols(); ++jj)
+            ret += matrix_.get_entry(ii, jj) * solution.get_entry(jj);
+          return ret;
+        });
+      } else {
+        auto tmp = rhs.copy();
+        matrix_.mv(solution, tmp);
+        tmp -= rhs;
+        sup_norm = tmp.sup_norm();
+        statistics_.final_residual = tmp.l2_norm();
+      }
+      statistics_.post_check_time = timer.elapsed();
+      if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
+        DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
+                   "The computed solution does not solve the system (although the dune-common backend "
+                       << "reported no error) and you requested checking (see options below)! "
+                       << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
+                       << "\n\n"
+                       << "  (A * x - b).sup_norm() = " << sup_norm << " (post_check_mode '" << post_check_mode
+                       << "')\n\n"
+                       << "Those were the given options:\n\n"
+                       << opts);
+    }
+  } // ... apply(...)
+
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+  /// \brief Drops the factorization kept due to the 'reuse_setup' option, e.g. if the matrix changed.
+  void clear_setup() const
+  {
+    setup_cache_.clear();
+  }
+
+  /**
+   * \brief Solves for all columns of rhs at once (only for 'lu.partialpiv').
+   *
+   * Shares the factorization with apply() (see the 'reuse_setup' option), but does not check the solution.
+   */
+  void apply(const MatrixType& rhs, MatrixType& solution, const std::string& type = "lu.partialpiv") const
+  {
+    apply(rhs, solution, options(type));
+  }
+
+  void apply(const MatrixType& rhs, MatrixType& solution, const Common::Configuration& opts) const
+  {
+    const auto type = opts.get("type", std::string("lu.partialpiv"));
+    if (type != "lu.partialpiv")
+      DUNE_THROW(Common::Exceptions::wrong_input_given,
+                 "Solving for several right hand sides at once is only implemented for type 'lu.partialpiv'!");
+    const Common::Configuration default_opts = options(type);
+    statistics_.reset(type);
+    Dune::Timer timer;
+    try {
+      const auto lu = lu_factorization(opts, default_opts);
+      statistics_.condition_estimate = lu->condition_estimate();
+      statistics_.setup_time = timer.elapsed();
+      timer.reset();
+      lu->apply(rhs, solution);
+      statistics_.solve_time = timer.elapsed();
+    } catch (FMatrixError&) {
+      DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
+                 "The dune-common backend reported 'FMatrixError'!\n"
+                     << "Those were the given options:\n\n"
+                     << opts);
+    }
+  } // ... apply(...)
+
+private:
+  // blocked LU factorization of the matrix (or the one from the setup cache)
+  std::shared_ptr<DenseLuFactorization<S>> lu_factorization(const Common::Configuration& opts,
+                                                            const Common::Configuration& default_opts) const
+  {
+    return setup_cache_.get<DenseLuFactorization<S>>(
+        "lu.partialpiv", matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+          return std::make_shared<DenseLuFactorization<S>>(
+              matrix_, opts.get("block_size", default_opts.get<size_t>("block_size")));
+        });
+  } // ... lu_factorization(...)
+
+  /**
+   * Factorizes a copy of the matrix in reduced precision (see internal::reduced_precision) and iteratively refines the
+   * solution, computing the residual in full precision. Stops if the relative residual drops below
+   * 'refinement.precision', after 'refinement.max_iter' steps or once the refinement stagnates. Whether the result is
+   * accurate enough is left to the post check. The number of refinement steps is reported as iterations.
+   */
+  void apply_mixed_lu(const CommonDenseVector<S>& rhs,
+                      CommonDenseVector<S>& solution,
+                      const Common::Configuration& opts,
+                      const Common::Configuration& default_opts) const
+  {
+    Dune::Timer timer;
+    using L = typename internal::reduced_precision<S>::type;
+    const size_t num_rows = matrix_.rows();
+    const size_t num_cols = matrix_.cols();
+    CommonDenseMatrix<L> lu(num_rows, num_cols);
+    std::transform(matrix_.data(), matrix_.data() + num_rows * num_cols, lu.data(), [](const S& val) {
+      return static_cast<L>(val);
+    });
+    std::vector<size_t> pivots;
+    lu_decomposition(lu, pivots);
+    statistics_.setup_time = timer.elapsed();
+    timer.reset();
+    const size_t max_iter = opts.get("refinement.max_iter", default_opts.get<size_t>("refinement.max_iter"));
+    const R precision = opts.get("refinement.precision", default_opts.get<R>("refinement.precision"));
+    const R rhs_norm = rhs.sup_norm();
+    // we store A x - b, so the correction d solves A d = -residual
+    solution.set_all(S(0));
+    auto residual = rhs.copy();
+    residual.scal(S(-1));
+    R residual_norm = rhs_norm;
+    std::vector<L> correction(num_rows);
+    for (size_t ii = 0; ii < max_iter && residual_norm > precision * rhs_norm; ++ii) {
+      for (size_t rr = 0; rr < num_rows; ++rr)
+        correction[rr] = static_cast<L>(-residual[rr]);
+      solve_lu_factorized(lu, pivots, correction);
+      statistics_.iterations = ii + 1;
+      for (size_t rr = 0; rr < num_rows; ++rr)
+        solution[rr] += static_cast<S>(correction[rr]);
+      matrix_.mv(solution, residual);
+      residual -= rhs;
+      const R new_residual_norm = residual.sup_norm();
+      const bool stagnated = !(new_residual_norm < 0.5 * residual_norm);
+      residual_norm = new_residual_norm;
+      if (stagnated)
+        break;
+    }
+    statistics_.solve_time = timer.elapsed();
+    statistics_.final_residual = residual.l2_norm();
+  } // ... apply_mixed_lu(...)
+
+  const MatrixType& matrix_;
+  mutable SolverStatistics statistics_;
+  mutable internal::SetupCache setup_cache_;
+}; // class Solver< CommonDenseMatrix< ... > >
+
+
+template <class S, Common::StorageLayout layout, class CommunicatorType>
+class SolverOptions<CommonSparseMatrix<S, layout>, CommunicatorType> : protected internal::SolverUtils
+{
+public:
+  using MatrixType = CommonSparseMatrix<S, layout>;
+
+  static std::vector<std::string> types()
+  {
+    return {"llt.supernodal", "ldlt.supernodal"};
+  }
+
+  static Common::Configuration options(const std::string type = "")
+  {
+    const std::string tp = !type.empty() ? type : types()[0];
+    internal::SolverUtils::check_given(tp, types());
+    return Common::Configuration({"type", "post_check_solves_system", "reuse_setup", "ordering"},
+                                 {tp.c_str(), "1e-5", "0", "minimum_degree"});
+  }
+}; // class SolverOptions<CommonSparseMatrix<...>>
+
+
+/**
+ * \brief Direct solvers for symmetric CommonSparseMatrix, based on SparseCholeskyFactorization.
+ *
+ * "llt.supernodal" requires a positive definite matrix, "ldlt.supernodal" does not pivot and is thus suited for
+ * quasi-definite matrices. Only the lower triangle of the matrix is read, so a nonsymmetric matrix is only detected by
+ * the post check. The option 'ordering' is either "minimum_degree" (see minimum_degree_ordering()) or "natural", the
+ * factorization is kept according to the option 'reuse_setup' (see internal::SetupCache).
+ */
+template <class S, Common::StorageLayout layout, class CommunicatorType>
+class Solver<CommonSparseMatrix<S, layout>, CommunicatorType> : protected internal::SolverUtils
+{
+  static_assert(!Common::is_complex<S>::value, "The supernodal factorization is only implemented for real matrices!");
+
+public:
+  typedef CommonSparseMatrix<S, layout> MatrixType;
+  typedef typename MatrixType::RealType R;
+
+  Solver(const MatrixType& matrix)
+    : matrix_(matrix)
+  {}
+
+  Solver(const MatrixType& matrix, const CommunicatorType& /*communicator*/)
+    : matrix_(matrix)
+  {}
+
+  static std::vector<std::string> types()
+  {
+    return SolverOptions<MatrixType, CommunicatorType>::types();
+  }
+
+  static Common::Configuration options(const std::string type = "")
+  {
+    return SolverOptions<MatrixType, CommunicatorType>::options(type);
+  } // ... options(...)
+
+  void apply(const CommonDenseVector<S>& rhs, CommonDenseVector<S>& solution) const
+  {
+    apply(rhs, solution, types()[0]);
+  }
+
+  void apply(const CommonDenseVector<S>& rhs, CommonDenseVector<S>& solution, const std::string& type) const
+  {
+    apply(rhs, solution, options(type));
+  }
+
+  void apply(const CommonDenseVector<S>& rhs, CommonDenseVector<S>& solution, const Common::Configuration& opts) const
+  {
+    if (!opts.has_key("type"))
+      DUNE_THROW(Common::Exceptions::configuration_error,
+                 "Given options (see below) need to have at least the key 'type' set!\n\n"
+                     << opts);
+    const auto type = opts.get<std::string>("type");
+    internal::SolverUtils::check_given(type, types());
+    const Common::Configuration default_opts = options(type);
+    const auto ordering = opts.get("ordering", default_opts.get<std::string>("ordering"));
+    internal::SolverUtils::check_given(ordering, {"minimum_degree", "natural"});
+    // solve
+    statistics_.reset(type);
+    statistics_.initial_residual = rhs.l2_norm();
+    Dune::Timer timer;
+    try {
+      const auto factorization = setup_cache_.get<SparseCholeskyFactorization<S>>(
+          type + "_" + ordering, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+            auto ret = std::make_shared<SparseCholeskyFactorization<S>>();
+            if (ordering == "minimum_degree")
+              ret->symbolic(matrix_, minimum_degree_ordering(matrix_));
+            else
+              ret->symbolic(matrix_);
+            ret->numeric(matrix_, type == "ldlt.supernodal");
+            return ret;
+          });
+      statistics_.setup_time = timer.elapsed();
+      timer.reset();
+      factorization->apply(rhs, solution);
+      statistics_.solve_time = timer.elapsed();
+    } catch (const MathError& ee) {
+      DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
+                 "The factorization failed, this was the original error:\n\n"
+                     << ee.what() << "\n\n"
+                     << "Those were the given options:\n\n"
+                     << opts);
+    }
+    // check
+    const R post_check_solves_system_threshold =
+        opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
+    if (post_check_solves_system_threshold > 0) {
+      timer.reset();
       auto tmp = rhs.copy();
       matrix_.mv(solution, tmp);
       tmp -= rhs;
       const R sup_norm = tmp.sup_norm();
+      statistics_.final_residual = tmp.l2_norm();
+      statistics_.post_check_time = timer.elapsed();
       if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
         DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
-                   "The computed solution does not solve the system (although the dune-common backend "
-                       << "reported no error) and you requested checking (see options below)! "
+                   "The computed solution does not solve the system (although the factorization did not fail) and "
+                       << "you requested checking (see options below)! "
                        << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
                        << "\n\n"
-                       << "  (A * x - b).sup_norm() = " << tmp.sup_norm() << "\n\n"
+                       << "  (A * x - b).sup_norm() = " << sup_norm << "\n\n"
                        << "Those were the given options:\n\n"
                        << opts);
     }
   } // ... apply(...)
 
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+  /// \brief Drops the factorization kept due to the 'reuse_setup' option, e.g. if the matrix changed.
+  void clear_setup() const
+  {
+    setup_cache_.clear();
+  }
+
 private:
   const MatrixType& matrix_;
-}; // class Solver< CommonDenseMatrix< ... > >
+  mutable SolverStatistics statistics_;
+  mutable internal::SetupCache setup_cache_;
+}; // class Solver< CommonSparseMatrix< ... > >
 
 
 } // namespace LA
@@ -10,10 +10,15 @@
 #ifndef DUNE_XT_LA_SOLVER_DENSE_HH
 #define DUNE_XT_LA_SOLVER_DENSE_HH
 
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include <dune/xt/common/configuration.hh>
 #include <dune/xt/common/matrix.hh>
 #include <dune/xt/common/vector.hh>
 
+#include <dune/xt/la/algorithms/lu.hh>
 #include <dune/xt/la/algorithms/qr.hh>
 #include <dune/xt/la/type_traits.hh>
 
@@ -36,14 +41,19 @@ public:
 
   static std::vector<std::string> types()
   {
-    return {"qr.householder"};
+    return {"qr.householder", "lu.partialpiv"};
   }
 
   static Common::Configuration options(const std::string type = "")
   {
     const std::string tp = !type.empty() ? type : types()[0];
     internal::SolverUtils::check_given(tp, types());
-    return Common::Configuration({"type", "post_check_solves_system"}, {tp.c_str(), "1e-5"});
+    Common::Configuration default_options({"type", "post_check_solves_system"}, {tp.c_str(), "1e-5"});
+    if (tp == "lu.partialpiv") {
+      default_options.set("reuse_setup", "0");
+      default_options.set("block_size", "64");
+    }
+    return default_options;
   }
 }; // class SolverOptions<...>
 
@@ -70,14 +80,12 @@ public:
 
   static std::vector<std::string> types()
   {
-    return {"qr.householder"};
+    return SolverOptions<MatrixType>::types();
   }
 
   static Common::Configuration options(const std::string type = "")
   {
-    const std::string tp = !type.empty() ? type : types()[0];
-    internal::SolverUtils::check_given(tp, types());
-    return Common::Configuration({"type", "post_check_solves_system"}, {tp.c_str(), "1e-5"});
+    return SolverOptions<MatrixType>::options(type);
   }
 
   template <class VectorType>
@@ -104,16 +112,48 @@ public:
     internal::SolverUtils::check_given(type, types());
     const Common::Configuration default_opts = options(type);
     // solve
-    auto writable_copy_of_matrix_ = matrix_;
-    solve_by_qr_decomposition(writable_copy_of_matrix_, solution, rhs);
+    statistics_.reset(type);
+    statistics_.initial_residual = l2_norm(rhs);
+    Dune::Timer timer;
+    try {
+      if (type == "lu.partialpiv") {
+        const auto lu = setup_cache_.get<DenseLuFactorization<typename M::ScalarType>>(
+            type, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+              return std::make_shared<DenseLuFactorization<typename M::ScalarType>>(
+                  matrix_, opts.get("block_size", default_opts.get<size_t>("block_size")));
+            });
+        statistics_.condition_estimate = lu->condition_estimate();
+        statistics_.setup_time = timer.elapsed();
+        timer.reset();
+        lu->apply(rhs, solution);
+      } else {
+        auto writable_copy_of_matrix_ = matrix_;
+        std::vector<typename M::ScalarType> tau(M::cols(matrix_));
+        std::vector<int> permutations(M::cols(matrix_));
+        qr(writable_copy_of_matrix_, tau, permutations);
+        statistics_.condition_estimate = qr_condition_estimate(writable_copy_of_matrix_);
+        statistics_.setup_time = timer.elapsed();
+        timer.reset();
+        solve_qr_factorized(writable_copy_of_matrix_, tau, permutations, solution, rhs);
+      }
+    } catch (FMatrixError&) {
+      DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
+                 "The dune-common backend reported 'FMatrixError'!\n"
+                     << "Those were the given options:\n\n"
+                     << opts);
+    }
+    statistics_.solve_time = timer.elapsed();
     // check
     const auto post_check_solves_system_threshold =
         opts.get("post_check_solves_system", default_opts.get<double>("post_check_solves_system"));
     if (post_check_solves_system_threshold > 0) {
+      timer.reset();
       auto tmp = XT::Common::zeros_like(rhs);
       XT::Common::mv(matrix_, solution, tmp);
       tmp -= rhs;
       const auto sup_norm = XT::Common::sup_norm(tmp);
+      statistics_.final_residual = l2_norm(tmp);
+      statistics_.post_check_time = timer.elapsed();
       if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
         DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
                    "The computed solution does not solve the system and you requested checking (see options below)! "
@@ -125,8 +165,32 @@ public:
     }
   } // ... apply(...)
 
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+  /// \brief Drops the factorization kept due to the 'reuse_setup' option, e.g. if the matrix changed.
+  void clear_setup() const
+  {
+    setup_cache_.clear();
+  }
+
 private:
+  template <class VectorType>
+  static double l2_norm(const VectorType& vec)
+  {
+    using V = Common::VectorAbstraction<VectorType>;
+    double sum = 0.;
+    for (size_t ii = 0; ii < vec.size(); ++ii)
+      sum += std::pow(std::abs(V::get_entry(vec, ii)), 2);
+    return std::sqrt(sum);
+  }
+
   const MatrixType& matrix_;
+  mutable SolverStatistics statistics_;
+  mutable internal::SetupCache setup_cache_;
 }; // class Solver<...>
 
 
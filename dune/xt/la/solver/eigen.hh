@@ -41,6 +41,7 @@
 
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/string.hh>
 #include <dune/xt/la/container/eigen.hh>
 
 #include "../solver.hh"
@@ -72,8 +73,9 @@ public:
   {
     const std::string tp = !type.empty() ? type : types()[0];
     internal::SolverUtils::check_given(tp, types());
-    Common::Configuration default_options({"type", "post_check_solves_system", "check_for_inf_nan"},
-                                          {tp.c_str(), "1e-5", "1"});
+    Common::Configuration default_options(
+        {"type", "post_check_solves_system", "post_check_mode", "post_check_samples", "check_for_inf_nan"},
+        {tp.c_str(), "1e-5", "auto", "64", "1"});
     // for symmetric matrices
     if (tp == "ldlt" || tp == "llt") {
       default_options.set("pre_check_symmetry", "1e-8");
@@ -183,20 +185,29 @@ public:
       }
     }
     // solve
+    statistics_.reset(type);
+    statistics_.initial_residual = rhs.l2_norm();
+    Dune::Timer timer;
+    const auto solve_with = [&](const auto& decomposition) {
+      statistics_.setup_time = timer.elapsed();
+      timer.reset();
+      solution.backend() = decomposition.solve(rhs.backend());
+      statistics_.solve_time = timer.elapsed();
+    };
     if (type == "qr.colpivhouseholder") {
-      solution.backend() = matrix_.backend().colPivHouseholderQr().solve(rhs.backend());
+      solve_with(matrix_.backend().colPivHouseholderQr());
     } else if (type == "qr.fullpivhouseholder")
-      solution.backend() = matrix_.backend().fullPivHouseholderQr().solve(rhs.backend());
+      solve_with(matrix_.backend().fullPivHouseholderQr());
     else if (type == "qr.householder")
-      solution.backend() = matrix_.backend().householderQr().solve(rhs.backend());
+      solve_with(matrix_.backend().householderQr());
     else if (type == "lu.fullpiv")
-      solution.backend() = matrix_.backend().fullPivLu().solve(rhs.backend());
+      solve_with(matrix_.backend().fullPivLu());
     else if (type == "llt")
-      solution.backend() = matrix_.backend().llt().solve(rhs.backend());
+      solve_with(matrix_.backend().llt());
     else if (type == "ldlt")
-      solution.backend() = matrix_.backend().ldlt().solve(rhs.backend());
+      solve_with(matrix_.backend().ldlt());
     else if (type == "lu.partialpiv")
-      solution.backend() = matrix_.backend().partialPivLu().solve(rhs.backend());
+      solve_with(matrix_.backend().partialPivLu());
     else
       DUNE_THROW(Common::Exceptions::internal_error,
                  "Given type '" << type << "' is not supported, although it was reported by types()!");
@@ -222,16 +233,30 @@ public:
     const R post_check_solves_system_threshold =
         opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
     if (post_check_solves_system_threshold > 0) {
-      auto tmp = rhs.copy();
-      tmp.backend() = matrix_.backend() * solution.backend() - rhs.backend();
-      const R sup_norm = tmp.sup_norm();
+      timer.reset();
+      const auto post_check_mode = internal::SolverUtils::post_check_mode(
+          opts, default_opts, matrix_.rows(), statistics_.final_residual);
+      R sup_norm = 0;
+      if (post_check_mode == "sampled") {
+        const auto rows = internal::SolverUtils::sampled_rows(
+            matrix_.rows(), opts.get("post_check_samples", default_opts.get<size_t>("post_check_samples")));
+        sup_norm = internal::SolverUtils::sampled_sup_norm(rows, [&](const size_t ii) {
+          return (matrix_.backend().row(ii) * solution.backend()).value() - rhs.get_entry(ii);
+        });
+      } else {
+        auto tmp = rhs.copy();
+        tmp.backend() = matrix_.backend() * solution.backend() - rhs.backend();
+        sup_norm = tmp.sup_norm();
+        statistics_.final_residual = tmp.l2_norm();
+      }
+      statistics_.post_check_time = timer.elapsed();
       if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm)) {
         std::stringstream msg;
         msg << "The computed solution does not solve the system (although the eigen backend reported "
             << "'Success') and you requested checking (see options below)!\n"
             << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
             << "\n\n"
-            << "  (A * x - b).sup_norm() = " << tmp.sup_norm() << "\n\n"
+            << "  (A * x - b).sup_norm() = " << sup_norm << " (post_check_mode '" << post_check_mode << "')\n\n"
             << "Those were the given options:\n\n"
             << opts;
         if (rhs.size() <= internal::max_size_to_print)
@@ -244,8 +269,15 @@ public:
     }
   } // ... apply(...)
 
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
 private:
   const MatrixType& matrix_;
+  mutable SolverStatistics statistics_;
 }; // class Solver
 
 
@@ -277,6 +309,10 @@ public:
         "cg.identity.lower" // <- does only work with symmetric matrices, may produce correct results
         ,
         "cg.identity.upper" // <- does only work with symmetric matrices, may produce correct results
+        ,
+        "mixed.lu" // <- factorizes in reduced precision, refines in full precision
+        ,
+        "auto" // <- chooses one of the above, see Solver::auto_type()
         //           , "spqr"                  // <- does not compile
         //           , "llt.cholmodsupernodal" // <- does not compile
         //#if HAVE_UMFPACK
@@ -294,14 +330,30 @@ public:
     // check
     internal::SolverUtils::check_given(tp, types());
     // default config
-    Common::Configuration default_options({"type", "post_check_solves_system", "check_for_inf_nan"},
-                                          {tp.c_str(), "1e-5", "1"});
+    Common::Configuration default_options({"type",
+                                           "post_check_solves_system",
+                                           "post_check_mode",
+                                           "post_check_samples",
+                                           "check_for_inf_nan",
+                                           "reuse_setup"},
+                                          {tp.c_str(), "1e-5", "auto", "64", "1", "0"});
     Common::Configuration iterative_options({"max_iter", "precision"}, {"10000", "1e-10"});
     iterative_options += default_options;
     // direct solvers
     if (tp == "lu.sparse" || tp == "qr.sparse" || tp == "lu.umfpack" || tp == "spqr" || tp == "llt.cholmodsupernodal"
         || tp == "superlu")
       return default_options;
+    if (tp == "mixed.lu") {
+      default_options.set("refinement.max_iter", "20");
+      default_options.set("refinement.precision", "1e-14");
+      return default_options;
+    }
+    if (tp == "auto") {
+      // all other options are passed on to the chosen type
+      default_options.set("auto.max_direct_non_zeros", "200000");
+      default_options.set("pre_check_symmetry", "1e-8");
+      return default_options;
+    }
     // * for symmetric matrices
     if (tp == "ldlt.simplicial" || tp == "llt.simplicial") {
       default_options.set("pre_check_symmetry", "1e-8");
@@ -320,6 +372,7 @@ public:
 
 /**
  *  \note lu.sparse will copy the matrix to column major
+ *  \note mixed.lu will copy the matrix to column major in reduced precision
  *  \note qr.sparse will copy the matrix to column major
  *  \note ldlt.simplicial will copy the matrix to column major
  *  \note llt.simplicial will copy the matrix to column major
@@ -355,6 +408,41 @@ public:
     return SolverOptions<MatrixType, CommunicatorType>::options(type);
   } // ... options(...)
 
+  /**
+   * \brief The type the "auto" type dispatches to, chosen from cheap properties of the matrix (see
+   *        internal::MatrixProperties): a direct solver if the matrix has at most 'auto.max_direct_non_zeros' nonzeros
+   *        (llt.simplicial if it seems to be s.p.d., lu.sparse otherwise), cg.diagonal.lower if it seems to be s.p.d.
+   *        and bicgstab.ilut otherwise.
+   * \note   The choice is remembered and only recomputed if the size or the number of nonzeros of the matrix changes.
+   */
+  std::string auto_type(const Common::Configuration& opts = options("auto")) const
+  {
+    if (!auto_type_.empty() && auto_type_rows_ == matrix_.rows() && auto_type_non_zeros_ == matrix_.non_zeros())
+      return auto_type_;
+    const Common::Configuration default_opts = options("auto");
+    typedef typename MatrixType::BackendType::InnerIterator InnerIterator;
+    const auto& backend = matrix_.backend();
+    const auto properties = internal::compute_matrix_properties(
+        matrix_.rows(),
+        [&](const size_t ii, const auto& visit) {
+          for (InnerIterator it(backend, static_cast<EIGEN_size_t>(ii)); it; ++it)
+            visit(static_cast<size_t>(it.col()), it.value());
+        },
+        [&](const size_t ii, const size_t jj) {
+          return backend.coeff(static_cast<EIGEN_size_t>(ii), static_cast<EIGEN_size_t>(jj));
+        },
+        opts.get("pre_check_symmetry", default_opts.get<double>("pre_check_symmetry")));
+    const bool small = properties.non_zeros
+                       <= opts.get("auto.max_direct_non_zeros", default_opts.get<size_t>("auto.max_direct_non_zeros"));
+    if (small)
+      auto_type_ = properties.spd() ? "llt.simplicial" : "lu.sparse";
+    else
+      auto_type_ = properties.spd() ? "cg.diagonal.lower" : "bicgstab.ilut";
+    auto_type_rows_ = matrix_.rows();
+    auto_type_non_zeros_ = matrix_.non_zeros();
+    return auto_type_;
+  } // ... auto_type(...)
+
   template <class T1, class T2>
   void apply(const EigenBaseVector<T1, S>& rhs, EigenBaseVector<T2, S>& solution) const
   {
@@ -377,6 +465,12 @@ public:
                      << opts);
     const auto type = opts.get<std::string>("type");
     internal::SolverUtils::check_given(type, types());
+    if (type == "auto") {
+      Common::Configuration actual_opts = opts;
+      actual_opts["type"] = auto_type(opts);
+      apply(rhs, solution, actual_opts);
+      return;
+    }
     const Common::Configuration default_opts = options(type);
     // check for inf or nan
     const bool check_for_inf_nan = opts.get("check_for_inf_nan", default_opts.get<bool>("check_for_inf_nan"));
@@ -426,103 +520,100 @@ public:
       }
     }
     ::Eigen::ComputationInfo info;
+    statistics_.reset(type);
+    statistics_.initial_residual = rhs.l2_norm();
+    Dune::Timer timer;
     if (type == "cg.diagonal.lower") {
       typedef ::Eigen::
           ConjugateGradient<typename MatrixType::BackendType, ::Eigen::Lower, ::Eigen::DiagonalPreconditioner<S>>
               SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_iterative<SolverType>(type, rhs, solution, opts, default_opts, timer);
     } else if (type == "cg.diagonal.upper") {
       typedef ::Eigen::
           ConjugateGradient<typename MatrixType::BackendType, ::Eigen::Upper, ::Eigen::DiagonalPreconditioner<S>>
               SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_iterative<SolverType>(type, rhs, solution, opts, default_opts, timer);
     } else if (type == "cg.identity.lower") {
       typedef ::Eigen::
           ConjugateGradient<typename MatrixType::BackendType, ::Eigen::Lower, ::Eigen::IdentityPreconditioner>
               SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_iterative<SolverType>(type, rhs, solution, opts, default_opts, timer);
     } else if (type == "cg.identity.upper") {
       typedef ::Eigen::
           ConjugateGradient<typename MatrixType::BackendType, ::Eigen::Lower, ::Eigen::IdentityPreconditioner>
               SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_iterative<SolverType>(type, rhs, solution, opts, default_opts, timer);
     } else if (type == "bicgstab.ilut") {
       typedef ::Eigen::BiCGSTAB<typename MatrixType::BackendType, ::Eigen::IncompleteLUT<S>> SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solver.preconditioner().setDroptol(
-          opts.get("preconditioner.drop_tol", default_opts.get<R>("preconditioner.drop_tol")));
-      solver.preconditioner().setFillfactor(
-          opts.get("preconditioner.fill_factor", default_opts.get<int>("preconditioner.fill_factor")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      // the parameters have to be set before the preconditioner is computed
+      const R drop_tol = opts.get("preconditioner.drop_tol", default_opts.get<R>("preconditioner.drop_tol"));
+      const int fill_factor =
+          opts.get("preconditioner.fill_factor", default_opts.get<int>("preconditioner.fill_factor"));
+      // a preconditioner computed with other parameters must not be reused
+      const std::string key = type + "_" + Common::to_string(drop_tol) + "_" + Common::to_string(fill_factor);
+      info = apply_iterative<SolverType>(key, rhs, solution, opts, default_opts, timer, [&](SolverType& solver) {
+        solver.preconditioner().setDroptol(drop_tol);
+        solver.preconditioner().setFillfactor(fill_factor);
+      });
     } else if (type == "bicgstab.diagonal") {
       typedef ::Eigen::BiCGSTAB<typename MatrixType::BackendType, ::Eigen::DiagonalPreconditioner<S>> SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_iterative<SolverType>(type, rhs, solution, opts, default_opts, timer);
     } else if (type == "bicgstab.identity") {
       typedef ::Eigen::BiCGSTAB<typename MatrixType::BackendType, ::Eigen::IdentityPreconditioner> SolverType;
-      SolverType solver(matrix_.backend());
-      solver.setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
-      solver.setTolerance(opts.get("precision", default_opts.get<R>("precision")));
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      info = apply_iterative<SolverType>(type, rhs, solution, opts, default_opts, timer);
     } else if (type == "lu.sparse") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
       typedef ::Eigen::SparseLU<ColMajorBackendType> SolverType;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      const auto solver = factorization<SolverType>(type, opts, default_opts);
+      statistics_.setup_time = timer.elapsed();
+      solution.backend() = solver->solve(rhs.backend());
+      info = solver->info();
     } else if (type == "qr.sparse") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
       typedef ::Eigen::SparseQR<ColMajorBackendType, ::Eigen::COLAMDOrdering<int>> SolverType;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      const auto solver = factorization<SolverType>(type, opts, default_opts);
+      statistics_.setup_time = timer.elapsed();
+      solution.backend() = solver->solve(rhs.backend());
+      info = solver->info();
     } else if (type == "ldlt.simplicial") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
       typedef ::Eigen::SimplicialLDLT<ColMajorBackendType> SolverType;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      const auto solver = factorization<SolverType>(type, opts, default_opts);
+      statistics_.setup_time = timer.elapsed();
+      solution.backend() = solver->solve(rhs.backend());
+      info = solver->info();
     } else if (type == "llt.simplicial") {
-      ColMajorBackendType colmajor_copy(matrix_.backend());
-      colmajor_copy.makeCompressed();
       typedef ::Eigen::SimplicialLLT<ColMajorBackendType> SolverType;
-      SolverType solver;
-      solver.analyzePattern(colmajor_copy);
-      solver.factorize(colmajor_copy);
-      solution.backend() = solver.solve(rhs.backend());
-      info = solver.info();
+      const auto solver = factorization<SolverType>(type, opts, default_opts);
+      statistics_.setup_time = timer.elapsed();
+      solution.backend() = solver->solve(rhs.backend());
+      info = solver->info();
+    } else if (type == "mixed.lu") {
+      // factorize in reduced precision, compute the residual in full precision
+      using L = typename internal::reduced_precision<S>::type;
+      typedef ::Eigen::SparseMatrix<L, ::Eigen::ColMajor> ReducedColMajorBackendType;
+      typedef ::Eigen::Matrix<S, ::Eigen::Dynamic, 1> VectorType;
+      typedef ::Eigen::Matrix<L, ::Eigen::Dynamic, 1> ReducedVectorType;
+      typedef ::Eigen::SparseLU<ReducedColMajorBackendType> SolverType;
+      const auto solver = factorization<SolverType, ReducedColMajorBackendType>(type, opts, default_opts);
+      info = solver->info();
+      statistics_.setup_time = timer.elapsed();
+      const size_t max_iter = opts.get("refinement.max_iter", default_opts.get<size_t>("refinement.max_iter"));
+      const R precision = opts.get("refinement.precision", default_opts.get<R>("refinement.precision"));
+      const R rhs_norm = rhs.backend().template lpNorm<::Eigen::Infinity>();
+      solution.backend().setZero();
+      VectorType residual = rhs.backend();
+      R residual_norm = rhs_norm;
+      for (size_t ii = 0; info == ::Eigen::Success && ii < max_iter && residual_norm > precision * rhs_norm; ++ii) {
+        const ReducedVectorType correction = solver->solve(residual.template cast<L>());
+        info = solver->info();
+        statistics_.iterations = ii + 1;
+        solution.backend() += correction.template cast<S>();
+        residual = rhs.backend() - matrix_.backend() * solution.backend();
+        const R new_residual_norm = residual.template lpNorm<::Eigen::Infinity>();
+        const bool stagnated = !(new_residual_norm < 0.5 * residual_norm);
+        residual_norm = new_residual_norm;
+        if (stagnated)
+          break;
+      }
+      statistics_.final_residual = residual.norm();
       //#if HAVE_UMFPACK
       //    } else if (type == "lu.umfpack") {
       //      typedef ::Eigen::UmfPackLU< typename MatrixType::BackendType > SolverType;
@@ -562,6 +653,7 @@ public:
     } else
       DUNE_THROW(Common::Exceptions::internal_error,
                  "Given type '" << type << "' is not supported, although it was reported by types()!");
+    statistics_.solve_time = timer.elapsed() - statistics_.setup_time;
     // handle eigens info
     if (info != ::Eigen::Success) {
       if (info == ::Eigen::NumericalIssue)
@@ -605,23 +697,120 @@ public:
     const R post_check_solves_system_threshold =
         opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
     if (post_check_solves_system_threshold > 0) {
-      auto tmp = rhs.copy();
-      tmp.backend() = matrix_.backend() * solution.backend() - rhs.backend();
-      const R sup_norm = tmp.sup_norm();
+      timer.reset();
+      const auto post_check_mode = internal::SolverUtils::post_check_mode(
+          opts, default_opts, matrix_.rows(), statistics_.final_residual);
+      R sup_norm = 0;
+      if (post_check_mode == "reported" && statistics_.final_residual <= post_check_solves_system_threshold) {
+        sup_norm = statistics_.final_residual;
+      } else if (post_check_mode == "sampled") {
+        typedef typename MatrixType::BackendType::InnerIterator InnerIterator;
+        const auto rows = internal::SolverUtils::sampled_rows(
+            matrix_.rows(), opts.get("post_check_samples", default_opts.get<size_t>("post_check_samples")));
+        sup_norm = internal::SolverUtils::sampled_sup_norm(rows, [&](const size_t ii) {
+          S ret = -rhs.get_entry(ii);
+          for (InnerIterator it(matrix_.backend(), static_cast<EIGEN_size_t>(ii)); it; ++it)
+            ret += it.value() * solution.backend()(it.col());
+          return ret;
+        });
+      } else {
+        auto tmp = rhs.copy();
+        tmp.backend() = matrix_.backend() * solution.backend() - rhs.backend();
+        sup_norm = tmp.sup_norm();
+        statistics_.final_residual = tmp.l2_norm();
+      }
+      statistics_.post_check_time = timer.elapsed();
       if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
         DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
                    "The computed solution does not solve the system (although the eigen backend reported "
                        << "'Success') and you requested checking (see options below)!\n"
                        << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
                        << "\n\n"
-                       << "  (A * x - b).sup_norm() = " << tmp.sup_norm() << "\n\n"
+                       << "  (A * x - b).sup_norm() = " << sup_norm << " (post_check_mode '" << post_check_mode
+                       << "')\n\n"
                        << "Those were the given options:\n\n"
                        << opts);
     }
   } // ... apply(...)
 
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+  /// \brief Drops the factorization or preconditioner kept due to the 'reuse_setup' option, e.g. if the matrix changed.
+  void clear_setup() const
+  {
+    setup_cache_.clear();
+  }
+
 private:
+  // factorizes a column major copy of the matrix (or takes the factorization from the setup cache)
+  template <class SolverType, class ColMajorType = ColMajorBackendType>
+  std::shared_ptr<SolverType> factorization(const std::string& type,
+                                            const Common::Configuration& opts,
+                                            const Common::Configuration& default_opts) const
+  {
+    return setup_cache_.get<SolverType>(
+        type, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+          ColMajorType colmajor_copy(matrix_.backend().template cast<typename ColMajorType::Scalar>());
+          colmajor_copy.makeCompressed();
+          auto ret = std::make_shared<SolverType>();
+          ret->analyzePattern(colmajor_copy);
+          ret->factorize(colmajor_copy);
+          return ret;
+        });
+  } // ... factorization(...)
+
+  template <class SolverType, class T1, class T2>
+  ::Eigen::ComputationInfo apply_iterative(const std::string& cache_key,
+                                           const EigenBaseVector<T1, S>& rhs,
+                                           EigenBaseVector<T2, S>& solution,
+                                           const Common::Configuration& opts,
+                                           const Common::Configuration& default_opts,
+                                           const Dune::Timer& timer) const
+  {
+    return apply_iterative<SolverType>(cache_key, rhs, solution, opts, default_opts, timer, [](SolverType&) {});
+  }
+
+  // computes the preconditioner (or takes it from the setup cache, prepare is only called for a new one) and solves,
+  // cache_key has to contain the type and all parameters used in prepare
+  template <class SolverType, class T1, class T2, class PreparationType>
+  ::Eigen::ComputationInfo apply_iterative(const std::string& cache_key,
+                                           const EigenBaseVector<T1, S>& rhs,
+                                           EigenBaseVector<T2, S>& solution,
+                                           const Common::Configuration& opts,
+                                           const Common::Configuration& default_opts,
+                                           const Dune::Timer& timer,
+                                           const PreparationType& prepare) const
+  {
+    const auto solver = setup_cache_.get<SolverType>(
+        cache_key, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+          auto ret = std::make_shared<SolverType>();
+          prepare(*ret);
+          ret->compute(matrix_.backend());
+          return ret;
+        });
+    solver->setMaxIterations(opts.get("max_iter", default_opts.get<int>("max_iter")));
+    solver->setTolerance(opts.get("precision", default_opts.get<R>("precision")));
+    statistics_.setup_time = timer.elapsed();
+    solution.backend() = solver->solve(rhs.backend());
+    // eigens iterative solvers start with a zero initial guess and report the relative residual
+    const R relative_error = solver->error();
+    statistics_.iterations = solver->iterations();
+    statistics_.final_residual = relative_error * statistics_.initial_residual;
+    if (statistics_.iterations > 0)
+      statistics_.convergence_rate = std::pow(relative_error, 1. / statistics_.iterations);
+    return solver->info();
+  } // ... apply_iterative(...)
+
   const MatrixType& matrix_;
+  mutable SolverStatistics statistics_;
+  mutable internal::SetupCache setup_cache_;
+  mutable std::string auto_type_;
+  mutable size_t auto_type_rows_ = 0;
+  mutable size_t auto_type_non_zeros_ = 0;
 }; // class Solver
 
 
@@ -13,8 +13,11 @@
 #ifndef DUNE_XT_LA_SOLVER_ISTL_HH
 #define DUNE_XT_LA_SOLVER_ISTL_HH
 
+#include <algorithm>
 #include <type_traits>
 #include <cmath>
+#include <limits>
+#include <memory>
 
 #include <dune/istl/operators.hh>
 #include <dune/istl/preconditioners.hh>
@@ -25,11 +28,13 @@
 
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/string.hh>
 
 #include <dune/xt/la/container/istl.hh>
 
 #include "istl/amg.hh"
 #include "istl/preconditioners.hh"
+#include "istl/recycling.hh"
 #include "../solver.hh"
 
 namespace Dune {
@@ -88,9 +93,10 @@ struct IstlSolverTraits<S, SequentialCommunication>
     return ScalarproductType();
   }
 
+  // returns a reference, copying would also copy the setup (e.g. the incomplete factorization) of the preconditioner
   template <class SequentialPreconditionerType>
-  static SequentialPreconditionerType make_preconditioner(const SequentialPreconditionerType& seq_preconditioner,
-                                                          const SequentialCommunication& /*communicator*/)
+  static SequentialPreconditionerType& make_preconditioner(SequentialPreconditionerType& seq_preconditioner,
+                                                           const SequentialCommunication& /*communicator*/)
   {
     return seq_preconditioner;
   }
@@ -109,16 +115,19 @@ public:
   static std::vector<std::string> types()
   {
     std::vector<std::string> ret{
-        "bicgstab.ssor", "bicgstab.amg.ssor", "bicgstab.amg.ilu0", "bicgstab.ilut", "bicgstab", "cg"};
+        "bicgstab.ssor", "bicgstab.amg.ssor", "bicgstab.amg.ilu0", "amg.cg",        "bicgstab.ilut",
+        "bicgstab",      "cg",                "cg.recycled",       "gmres.recycled"};
 
     if (std::is_same<CommunicatorType, XT::SequentialCommunication>::value) {
 #if HAVE_SUPERLU
       ret.insert(ret.begin(), "superlu");
 #endif
+      ret.push_back("mixed.amg");
 #if HAVE_UMFPACK
       ret.push_back("umfpack");
 #endif
     }
+    ret.push_back("auto");
     return ret;
   } // ... types(...)
 
@@ -126,10 +135,16 @@ public:
   {
     const std::string tp = !type.empty() ? type : types()[0];
     internal::SolverUtils::check_given(tp, types());
-    Common::Configuration general_opts({"type", "post_check_solves_system", "verbose"}, {tp.c_str(), "1e-5", "0"});
+    Common::Configuration general_opts(
+        {"type", "post_check_solves_system", "post_check_mode", "post_check_samples", "verbose", "reuse_setup"},
+        {tp.c_str(), "1e-5", "auto", "64", "0", "0"});
     Common::Configuration iterative_options({"max_iter", "precision"}, {"10000", "1e-10"});
     iterative_options += general_opts;
-    if (tp.substr(0, 13) == "bicgstab.amg." || tp == "bicgstab" || tp == "cg") {
+    if (tp.substr(0, 13) == "bicgstab.amg." || tp == "amg.cg" || tp == "bicgstab" || tp == "cg" || tp == "mixed.amg") {
+      // amg.cg requires a symmetric preconditioner, i.e. a symmetric smoother ('smoother.type' is one of "jacobi",
+      // "gs", "sor", "ssor" or "ilu0", for the bicgstab.amg.* types it is given by the type)
+      if (tp == "amg.cg" || tp == "mixed.amg")
+        iterative_options.set("smoother.type", "ssor");
       iterative_options.set("smoother.iterations", "1");
       iterative_options.set("smoother.relaxation_factor", "1");
       iterative_options.set("smoother.verbose", "0");
@@ -139,12 +154,24 @@ public:
       iterative_options.set("preconditioner.prolong_damp", "1.6");
       iterative_options.set("preconditioner.anisotropy_dim", "2"); // <- this should be the dimDomain of the problem!
       iterative_options.set("preconditioner.isotropy_dim", "2"); // <- this as well
+      // "symmetric" or "unsymmetric", the aggregate sizes are derived from the dimensions above if 0
+      iterative_options.set("preconditioner.criterion", (tp == "amg.cg") ? "symmetric" : "unsymmetric");
+      iterative_options.set("preconditioner.min_aggregate_size", "0");
+      iterative_options.set("preconditioner.max_aggregate_size", "0");
       iterative_options.set("preconditioner.verbose", "0");
       return iterative_options;
     } else if (tp == "bicgstab.ilut" || tp == "bicgstab.ssor") {
       iterative_options.set("preconditioner.iterations", "2");
       iterative_options.set("preconditioner.relaxation_factor", "1.0");
       return iterative_options;
+    } else if (tp == "cg.recycled" || tp == "gmres.recycled") {
+      // cg.recycled uses SSOR (has to be symmetric), gmres.recycled uses ILU(n) as preconditioner
+      iterative_options.set("preconditioner.iterations", tp == "cg.recycled" ? "1" : "2");
+      iterative_options.set("preconditioner.relaxation_factor", "1.0");
+      iterative_options.set("recycle.max_size", "5");
+      if (tp == "gmres.recycled")
+        iterative_options.set("restart", "50");
+      return iterative_options;
 #if HAVE_UMFPACK
     } else if (tp == "umfpack") {
       return general_opts;
@@ -153,6 +180,11 @@ public:
     } else if (tp == "superlu") {
       return general_opts;
 #endif
+    } else if (tp == "auto") {
+      // all other options are passed on to the chosen type, see Solver::auto_type()
+      general_opts.set("auto.max_direct_non_zeros", "200000");
+      general_opts.set("pre_check_symmetry", "1e-8");
+      return general_opts;
     } else
       DUNE_THROW(Common::Exceptions::internal_error, "Given solver type '" << tp << "' has no default options");
     return Common::Configuration();
@@ -179,6 +211,23 @@ public:
 
   Solver(Solver&& source) = default;
 
+  /**
+   * \brief Dimension of the subspace which the "*.recycled" types have kept from previous calls to apply().
+   *
+   * The subspace is spanned by previous solutions (solution-space deflation, no Ritz vectors are recycled). It is used
+   * to improve the initial guess (and, for cg.recycled, to deflate the Krylov space) of the next solve, which pays off
+   * for sequences of similar systems, e.g. from time stepping. The gain is reported in statistics().
+   */
+  size_t recycled_subspace_size() const
+  {
+    return recycled_subspace_.size();
+  }
+
+  void clear_recycled_subspace() const
+  {
+    recycled_subspace_.clear();
+  }
+
   static std::vector<std::string> types()
   {
     return SolverOptions<MatrixType, CommunicatorType>::types();
@@ -199,6 +248,57 @@ public:
     apply(rhs, solution, options(type));
   }
 
+  /**
+   * \brief The type the "auto" type dispatches to, chosen from cheap properties of the matrix (see
+   *        internal::MatrixProperties): a direct solver if the matrix has at most 'auto.max_direct_non_zeros' nonzeros
+   *        (and one is available), an AMG preconditioned CG (amg.cg) if the matrix seems to be s.p.d. and bicgstab.ilut
+   *        otherwise.
+   * \note   The choice is remembered and only recomputed if the size or the number of nonzeros of the matrix changes.
+   */
+  std::string auto_type(const Common::Configuration& opts = options("auto")) const
+  {
+    if (!auto_type_.empty() && auto_type_rows_ == matrix_.rows() && auto_type_non_zeros_ == matrix_.non_zeros())
+      return auto_type_;
+    const Common::Configuration default_opts = options("auto");
+    const auto& backend = matrix_.backend();
+    const auto properties = internal::compute_matrix_properties(
+        matrix_.rows(),
+        [&](const size_t ii, const auto& visit) {
+          const auto& row = backend[ii];
+          for (auto it = row.begin(); it != row.end(); ++it)
+            visit(it.index(), (*it)[0][0]);
+        },
+        [&](const size_t ii, const size_t jj) {
+          const auto it = backend[ii].find(jj);
+          return (it != backend[ii].end()) ? (*it)[0][0] : S(0);
+        },
+        opts.get("pre_check_symmetry", default_opts.get<double>("pre_check_symmetry")));
+    const auto available_types = types();
+    const auto available = [&](const std::string& tp) {
+      return std::find(available_types.begin(), available_types.end(), tp) != available_types.end();
+    };
+    const bool small = properties.non_zeros
+                       <= opts.get("auto.max_direct_non_zeros", default_opts.get<size_t>("auto.max_direct_non_zeros"));
+    // in parallel, all ranks have to choose the same type (direct solvers are only available sequentially)
+    const bool spd =
+#if HAVE_MPI
+        communicator_.access().communicator().min(properties.spd() ? 1 : 0) == 1;
+#else
+        properties.spd();
+#endif
+    if (small && available("umfpack"))
+      auto_type_ = "umfpack";
+    else if (small && available("superlu"))
+      auto_type_ = "superlu";
+    else if (spd)
+      auto_type_ = "amg.cg";
+    else
+      auto_type_ = "bicgstab.ilut";
+    auto_type_rows_ = matrix_.rows();
+    auto_type_non_zeros_ = matrix_.non_zeros();
+    return auto_type_;
+  } // ... auto_type(...)
+
   int verbosity(const Common::Configuration& opts, const Common::Configuration& default_opts) const
   {
     const auto actual_value = opts.get("verbose", default_opts.get<int>("verbose"));
@@ -212,6 +312,8 @@ public:
 
   /**
    *  \note does a copy of the rhs
+   *  \note For a nonzero initial guess, the initial and final residual in statistics() are only computed for the
+   *        "*.recycled" types or if 'verbose' is set, since this costs an additional mat-vec.
    */
   void apply(const IstlDenseVector<S>& rhs, IstlDenseVector<S>& solution, const Common::Configuration& opts) const
   {
@@ -231,20 +333,62 @@ public:
                        << opts);
       const auto type = opts.get<std::string>("type");
       internal::SolverUtils::check_given(type, types());
+      if (type == "auto") {
+        Common::Configuration actual_opts = opts;
+        actual_opts["type"] = auto_type(opts);
+        apply(rhs, solution, actual_opts);
+        return;
+      }
       const Common::Configuration default_opts = options(type);
+      statistics_.reset(type);
       IstlDenseVector<S> writable_rhs = rhs.copy();
+      // the initial residual is for free for a zero initial guess and computed by the "*.recycled" types anyway, for a
+      // nonzero initial guess it costs an additional mat-vec and is thus only computed if requested by 'verbose' (in
+      // parallel, all ranks have to take the same branch, since applying the operator communicates)
+      R initial_guess_norm = solution.sup_norm();
+#if HAVE_MPI
+      initial_guess_norm = communicator_.access().communicator().max(initial_guess_norm);
+#endif
+      if (!(initial_guess_norm > 0)) {
+        statistics_.initial_residual = scalar_product.norm(writable_rhs.backend());
+      } else if (type != "cg.recycled" && type != "gmres.recycled"
+                 && opts.get("verbose", default_opts.get<int>("verbose")) > 0) {
+        auto matrix_operator = Traits::make_operator(matrix_.backend(), communicator_.access());
+        matrix_operator.applyscaleadd(-1., solution.backend(), writable_rhs.backend());
+        statistics_.initial_residual = scalar_product.norm(writable_rhs.backend());
+        writable_rhs.backend() = rhs.backend();
+      }
+      Dune::Timer timer;
+      // only set by the "*.recycled" types
+      size_t recycled_subspace_size = 0;
+      R recycled_residual_reduction = std::numeric_limits<R>::quiet_NaN();
+
+      // keeps the operator and the AMG hierarchy of the AMG types alive between calls according to 'reuse_setup'
+      const auto amg_setup_provider = [&](const std::string& key, const auto& factory) {
+        using SetupType = typename std::decay_t<decltype(factory())>::element_type;
+        return setup_cache_.get<SetupType>(
+            type + "_" + key, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), factory);
+      };
 
       if (type.substr(0, 13) == "bicgstab.amg.") {
-        solver_result = AmgApplicator<S, CommunicatorType>(matrix_, communicator_.access())
-                            .call(writable_rhs, solution, opts, default_opts, type.substr(13));
+        solver_result =
+            AmgApplicator<S, CommunicatorType>(matrix_, communicator_.access())
+                .call(writable_rhs, solution, opts, default_opts, type.substr(13), "bicgstab", amg_setup_provider);
+      } else if (type == "amg.cg") {
+        solver_result =
+            AmgApplicator<S, CommunicatorType>(matrix_, communicator_.access())
+                .call(writable_rhs,
+                      solution,
+                      opts,
+                      default_opts,
+                      opts.get("smoother.type", default_opts.get<std::string>("smoother.type")),
+                      "cg",
+                      amg_setup_provider);
       } else if (type == "bicgstab.ilut") {
         auto matrix_operator = Traits::make_operator(matrix_.backend(), communicator_.access());
         typedef SeqILUn<typename MatrixType::BackendType, IstlVectorType, IstlVectorType> SequentialPreconditionerType;
-        SequentialPreconditionerType seq_preconditioner(
-            matrix_.backend(),
-            opts.get("preconditioner.iterations", default_opts.get<int>("preconditioner.iterations")),
-            opts.get("preconditioner.relaxation_factor", default_opts.get<S>("preconditioner.relaxation_factor")));
-        auto preconditioner = Traits::make_preconditioner(seq_preconditioner, communicator_.access());
+        const auto seq_preconditioner = cached_preconditioner<SequentialPreconditionerType>(type, opts, default_opts);
+        auto&& preconditioner = Traits::make_preconditioner(*seq_preconditioner, communicator_.access());
         BiCgSolverType solver(matrix_operator,
                               scalar_product,
                               preconditioner,
@@ -255,11 +399,8 @@ public:
       } else if (type == "bicgstab.ssor") {
         auto matrix_operator = Traits::make_operator(matrix_.backend(), communicator_.access());
         typedef SeqSSOR<typename MatrixType::BackendType, IstlVectorType, IstlVectorType> SequentialPreconditionerType;
-        SequentialPreconditionerType seq_preconditioner(
-            matrix_.backend(),
-            opts.get("preconditioner.iterations", default_opts.get<int>("preconditioner.iterations")),
-            opts.get("preconditioner.relaxation_factor", default_opts.get<S>("preconditioner.relaxation_factor")));
-        auto preconditioner = Traits::make_preconditioner(seq_preconditioner, communicator_.access());
+        const auto seq_preconditioner = cached_preconditioner<SequentialPreconditionerType>(type, opts, default_opts);
+        auto&& preconditioner = Traits::make_preconditioner(*seq_preconditioner, communicator_.access());
         BiCgSolverType solver(matrix_operator,
                               scalar_product,
                               preconditioner,
@@ -272,7 +413,7 @@ public:
         const auto cat = matrix_operator.category();
         typedef IdentityPreconditioner<MatrixOperatorType> SequentialPreconditioner;
         SequentialPreconditioner seq_preconditioner(cat);
-        auto preconditioner = Traits::make_preconditioner(seq_preconditioner, communicator_.access());
+        auto&& preconditioner = Traits::make_preconditioner(seq_preconditioner, communicator_.access());
         // define the BiCGStab as the actual solver
         BiCgSolverType solver(matrix_operator,
                               scalar_product,
@@ -286,7 +427,7 @@ public:
         const auto cat = matrix_operator.category();
         typedef IdentityPreconditioner<MatrixOperatorType> SequentialPreconditioner;
         SequentialPreconditioner seq_preconditioner(cat);
-        auto preconditioner = Traits::make_preconditioner(seq_preconditioner, communicator_.access());
+        auto&& preconditioner = Traits::make_preconditioner(seq_preconditioner, communicator_.access());
         // define the CG as the actual solver
         CgSolverType solver(matrix_operator,
                             scalar_product,
@@ -296,22 +437,149 @@ public:
                             verbosity(opts, default_opts),
                             false);
         solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
+      } else if (type == "cg.recycled") {
+        auto matrix_operator = Traits::make_operator(matrix_.backend(), communicator_.access());
+        typedef SeqSSOR<typename MatrixType::BackendType, IstlVectorType, IstlVectorType> SequentialPreconditionerType;
+        const auto seq_preconditioner = cached_preconditioner<SequentialPreconditionerType>(type, opts, default_opts);
+        auto&& preconditioner = Traits::make_preconditioner(*seq_preconditioner, communicator_.access());
+        // the matrix may have changed since the last call, so the images of the subspace have to be recomputed
+        recycled_subspace_.setup(opts.get("recycle.max_size", default_opts.get<size_t>("recycle.max_size")),
+                                 RecycledSubspace<IstlVectorType>::Orthogonality::energy);
+        recycled_subspace_.refresh(matrix_operator, scalar_product);
+        DeflatedCGSolver<IstlVectorType> solver(matrix_operator,
+                                                scalar_product,
+                                                preconditioner,
+                                                recycled_subspace_,
+                                                opts.get("precision", default_opts.get<R>("precision")),
+                                                opts.get("max_iter", default_opts.get<int>("max_iter")));
+        solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
+        statistics_.initial_residual = solver.initial_defect();
+        recycled_subspace_size = recycled_subspace_.size();
+        recycled_residual_reduction = solver.projection_reduction();
+        recycled_subspace_.add(solution.backend(), matrix_operator, scalar_product);
+      } else if (type == "gmres.recycled") {
+        auto matrix_operator = Traits::make_operator(matrix_.backend(), communicator_.access());
+        typedef SeqILUn<typename MatrixType::BackendType, IstlVectorType, IstlVectorType> SequentialPreconditionerType;
+        const auto seq_preconditioner = cached_preconditioner<SequentialPreconditionerType>(type, opts, default_opts);
+        auto&& preconditioner = Traits::make_preconditioner(*seq_preconditioner, communicator_.access());
+        recycled_subspace_.setup(opts.get("recycle.max_size", default_opts.get<size_t>("recycle.max_size")),
+                                 RecycledSubspace<IstlVectorType>::Orthogonality::image);
+        recycled_subspace_.refresh(matrix_operator, scalar_product);
+        // minimize the residual over the recycled subspace, then let GMRES compute the remaining correction
+        auto& residual = writable_rhs.backend();
+        matrix_operator.applyscaleadd(-1., solution.backend(), residual);
+        const R initial_defect = scalar_product.norm(residual);
+        statistics_.initial_residual = initial_defect;
+        recycled_subspace_.project(solution.backend(), residual, scalar_product);
+        const R projected_defect = scalar_product.norm(residual);
+        const R precision = opts.get("precision", default_opts.get<R>("precision"));
+        if (projected_defect > precision * initial_defect) {
+          IstlVectorType correction(residual.size());
+          correction = S(0);
+          RestartedGMResSolver<IstlVectorType> solver(matrix_operator,
+                                                      scalar_product,
+                                                      preconditioner,
+                                                      precision * initial_defect / projected_defect,
+                                                      opts.get("restart", default_opts.get<int>("restart")),
+                                                      opts.get("max_iter", default_opts.get<int>("max_iter")),
+                                                      verbosity(opts, default_opts));
+          solver.apply(correction, residual, solver_result);
+          solution.backend() += correction;
+          solver_result.reduction *= projected_defect / initial_defect;
+        } else {
+          solver_result.converged = true;
+          solver_result.reduction = (initial_defect > 0) ? projected_defect / initial_defect : 0.;
+        }
+        recycled_subspace_size = recycled_subspace_.size();
+        recycled_residual_reduction = (initial_defect > 0) ? projected_defect / initial_defect : R(0);
+        recycled_subspace_.add(solution.backend(), matrix_operator, scalar_product);
+      } else if (type == "mixed.amg") {
+        // the AMG hierarchy is built and applied in reduced precision, the BiCGStab computes all residuals in full
+        // precision (only available for sequential communication, see types())
+        using L = typename internal::reduced_precision<S>::type;
+        using ReducedIstlMatrixType = typename IstlRowMajorSparseMatrix<L>::BackendType;
+        using ReducedIstlVectorType = typename IstlDenseVector<L>::BackendType;
+        typedef MatrixAdapter<ReducedIstlMatrixType, ReducedIstlVectorType, ReducedIstlVectorType>
+            ReducedMatrixOperatorType;
+        MatrixAdapter<typename MatrixType::BackendType, IstlVectorType, IstlVectorType> matrix_operator(
+            matrix_.backend());
+        SeqScalarProduct<IstlVectorType> sequential_scalar_product;
+        const auto amg_parameters = internal::make_amg_parameters<R>(opts, default_opts);
+        const auto smoother_type = opts.get("smoother.type", default_opts.get<std::string>("smoother.type"));
+        solver_result = internal::with_amg_smoother<ReducedIstlMatrixType, ReducedIstlVectorType>(
+            smoother_type, [&](auto smoother_tag) {
+              typedef typename decltype(smoother_tag)::type SmootherType;
+              const auto smoother_parameters =
+                  internal::make_amg_smoother_parameters<SmootherType, L>(smoother_type, opts, default_opts);
+              return internal::with_amg_criterion<ReducedIstlMatrixType>(
+                  amg_parameters, opts, default_opts, [&](const auto& amg_criterion) {
+                    typedef Amg::AMG<ReducedMatrixOperatorType, ReducedIstlVectorType, SmootherType>
+                        ReducedPreconditionerType;
+                    typedef internal::ReducedPrecisionAmgSetup<IstlRowMajorSparseMatrix<L>,
+                                                               ReducedMatrixOperatorType,
+                                                               ReducedPreconditionerType>
+                        SetupType;
+                    // the reduced precision copy of the matrix is kept together with the AMG built on it
+                    const auto setup =
+                        amg_setup_provider(internal::amg_setup_key(smoother_type, opts, default_opts), [&]() {
+                          auto ret = std::make_shared<SetupType>(matrix_);
+                          ret->preconditioner.reset(
+                              new ReducedPreconditionerType(ret->matrix_operator, amg_criterion, smoother_parameters));
+                          return ret;
+                        });
+                    ReducedPrecisionPreconditioner<IstlVectorType, ReducedPreconditionerType> preconditioner(
+                        *setup->preconditioner, matrix_.rows());
+                    BiCgSolverType solver(matrix_operator,
+                                          sequential_scalar_product,
+                                          preconditioner,
+                                          opts.get("precision", default_opts.get<R>("precision")),
+                                          opts.get("max_iter", default_opts.get<int>("max_iter")),
+                                          verbosity(opts, default_opts));
+                    InverseOperatorResult result;
+                    solver.apply(solution.backend(), writable_rhs.backend(), result);
+                    return result;
+                  });
+            });
 #if HAVE_UMFPACK
       } else if (type == "umfpack") {
-        UMFPack<typename MatrixType::BackendType> solver(matrix_.backend(),
-                                                         opts.get("verbose", default_opts.get<int>("verbose")));
-        solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
+        typedef UMFPack<typename MatrixType::BackendType> SolverType;
+        const auto solver = setup_cache_.get<SolverType>(
+            type, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+              return std::make_shared<SolverType>(matrix_.backend(),
+                                                  opts.get("verbose", default_opts.get<int>("verbose")));
+            });
+        solver->apply(solution.backend(), writable_rhs.backend(), solver_result);
 #endif // HAVE_UMFPACK
 #if HAVE_SUPERLU
       } else if (type == "superlu") {
-        SuperLU<typename MatrixType::BackendType> solver(matrix_.backend(),
-                                                         opts.get("verbose", default_opts.get<int>("verbose")));
-
-        solver.apply(solution.backend(), writable_rhs.backend(), solver_result);
+        typedef SuperLU<typename MatrixType::BackendType> SolverType;
+        const auto solver = setup_cache_.get<SolverType>(
+            type, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+              return std::make_shared<SolverType>(matrix_.backend(),
+                                                  opts.get("verbose", default_opts.get<int>("verbose")));
+            });
+        solver->apply(solution.backend(), writable_rhs.backend(), solver_result);
 #endif // HAVE_SUPERLU
       } else
         DUNE_THROW(Common::Exceptions::internal_error,
                    "Given type '" << type << "' is not supported, although it was reported by types()!");
+      // the dune-istl solvers only time their iterations, everything else is setup
+      const bool direct = (type == "umfpack" || type == "superlu");
+      statistics_.iterations = solver_result.iterations;
+      statistics_.solve_time = solver_result.elapsed;
+      statistics_.setup_time = std::max(0., timer.elapsed() - solver_result.elapsed);
+      if (!direct) {
+        statistics_.final_residual = solver_result.reduction * statistics_.initial_residual;
+        statistics_.convergence_rate = solver_result.conv_rate;
+      }
+      if (!Common::isnan(recycled_residual_reduction)) {
+        statistics_.recycled_subspace_size = recycled_subspace_size;
+        statistics_.recycled_residual_reduction = recycled_residual_reduction;
+        // the iterations the plain method would have needed for the same reduction
+        if (recycled_residual_reduction > 0 && solver_result.conv_rate > 0 && solver_result.conv_rate < 1)
+          statistics_.recycled_iterations_saved =
+              std::log(recycled_residual_reduction) / std::log(solver_result.conv_rate);
+      }
       if (!solver_result.converged)
         DUNE_THROW(Exceptions::linear_solver_failed_bc_it_did_not_converge,
                    "The dune-istl backend reported 'InverseOperatorResult.converged == false'!\n"
@@ -322,20 +590,48 @@ public:
       const R post_check_solves_system_threshold =
           opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
       if (post_check_solves_system_threshold > 0) {
-        matrix_.mv(solution, writable_rhs);
-        //! TODO the additional copy to make the original rhs consistent is only necessary in parallel setups
-        auto tmp_rhs = rhs;
-        communicator_.access().copyOwnerToAll(writable_rhs.backend(), writable_rhs.backend());
-        communicator_.access().copyOwnerToAll(tmp_rhs.backend(), tmp_rhs.backend());
-        writable_rhs -= tmp_rhs;
-        const R sup_norm = writable_rhs.sup_norm();
+        timer.reset();
+        // in parallel, all ranks have to agree on the mode (the reported residual is a global quantity, the local size
+        // is not) and rows cannot be sampled locally, since the local mat-vec is only correct for owned rows
+        constexpr bool sequential = std::is_same<CommunicatorType, SequentialCommunication>::value;
+        auto post_check_mode = internal::SolverUtils::post_check_mode(
+            opts, default_opts, sequential ? matrix_.rows() : std::numeric_limits<size_t>::max(),
+            statistics_.final_residual);
+        if (!sequential && post_check_mode == "sampled")
+          post_check_mode = "full";
+        R sup_norm = 0;
+        if (post_check_mode == "reported" && statistics_.final_residual <= post_check_solves_system_threshold) {
+          sup_norm = statistics_.final_residual;
+        } else if (post_check_mode == "sampled") {
+          const auto rows = internal::SolverUtils::sampled_rows(
+              matrix_.rows(), opts.get("post_check_samples", default_opts.get<size_t>("post_check_samples")));
+          sup_norm = internal::SolverUtils::sampled_sup_norm(rows, [&](const size_t ii) {
+            S ret = -rhs.backend()[ii][0];
+            const auto& row = matrix_.backend()[ii];
+            for (auto it = row.begin(); it != row.end(); ++it)
+              ret += (*it)[0][0] * solution.backend()[it.index()][0];
+            return ret;
+          });
+        } else {
+          matrix_.mv(solution, writable_rhs);
+          //! TODO the additional copy to make the original rhs consistent is only necessary in parallel setups
+          auto tmp_rhs = rhs;
+          communicator_.access().copyOwnerToAll(writable_rhs.backend(), writable_rhs.backend());
+          communicator_.access().copyOwnerToAll(tmp_rhs.backend(), tmp_rhs.backend());
+          writable_rhs -= tmp_rhs;
+          sup_norm = writable_rhs.sup_norm();
+          if (direct)
+            statistics_.final_residual = scalar_product.norm(writable_rhs.backend());
+        }
+        statistics_.post_check_time = timer.elapsed();
         if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
           DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
                      "The computed solution does not solve the system (although the dune-istl backend "
                          << "reported no error) and you requested checking (see options below)!\n"
                          << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
                          << "\n\n"
-                         << "  (A * x - b).sup_norm() = " << sup_norm << "\n\n"
+                         << "  (A * x - b).sup_norm() = " << sup_norm << " (post_check_mode '" << post_check_mode
+                         << "')\n\n"
                          << "Those were the given options:\n\n"
                          << opts);
       }
@@ -346,9 +642,54 @@ public:
     }
   } // ... apply(...)
 
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+  /**
+   * \brief Drops the factorization, preconditioner or AMG hierarchy kept due to the 'reuse_setup' option, e.g. if the
+   *        matrix changed.
+   * \note  Setting up an AMG communicates, so in parallel all ranks have to call this (and change the matrix) at
+   *        once.
+   */
+  void clear_setup() const
+  {
+    setup_cache_.clear();
+  }
+
 private:
+  /**
+   * \brief The SSOR or ILU(n) preconditioner of the given type, kept alive between calls to apply() according to the
+   *        option 'reuse_setup' (e.g. reuse_setup = N - 1 sets it up again every N solves, which usually suffices for
+   *        slowly varying matrices like the Jacobians in a Newton iteration).
+   */
+  template <class SequentialPreconditionerType>
+  std::shared_ptr<SequentialPreconditionerType> cached_preconditioner(const std::string& type,
+                                                                     const Common::Configuration& opts,
+                                                                     const Common::Configuration& default_opts) const
+  {
+    const int iterations = opts.get("preconditioner.iterations", default_opts.get<int>("preconditioner.iterations"));
+    const S relaxation_factor =
+        opts.get("preconditioner.relaxation_factor", default_opts.get<S>("preconditioner.relaxation_factor"));
+    // a preconditioner set up with other parameters must not be reused
+    const std::string key = type + "_" + Common::to_string(iterations) + "_" + Common::to_string(relaxation_factor);
+    return setup_cache_.get<SequentialPreconditionerType>(
+        key, matrix_, opts.get("reuse_setup", default_opts.get<int>("reuse_setup")), [&]() {
+          return std::make_shared<SequentialPreconditionerType>(matrix_.backend(), iterations, relaxation_factor);
+        });
+  } // ... cached_preconditioner(...)
+
   const MatrixType& matrix_;
   const Common::ConstStorageProvider<CommunicatorType> communicator_;
+  mutable SolverStatistics statistics_;
+  mutable internal::SetupCache setup_cache_;
+  mutable std::string auto_type_;
+  mutable size_t auto_type_rows_ = 0;
+  mutable size_t auto_type_non_zeros_ = 0;
+  mutable RecycledSubspace<typename internal::IstlSolverTraits<S, CommunicatorType>::IstlVectorType>
+      recycled_subspace_;
 }; // class Solver
 
 } // namespace LA
@@ -15,10 +15,14 @@
 
 #include <type_traits>
 #include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
 
 #include <dune/istl/operators.hh>
 #include <dune/istl/solvers.hh>
 #include <dune/istl/paamg/amg.hh>
+#include <dune/istl/schwarz.hh>
 #include <dune/istl/preconditioners.hh>
 
 #include <dune/xt/common/exceptions.hh>
@@ -31,9 +35,232 @@
 namespace Dune {
 namespace XT {
 namespace LA {
+namespace internal {
 
 
-//! the general, parallel case
+template <class R>
+Amg::Parameters make_amg_parameters(const Common::Configuration& opts, const Common::Configuration& default_opts)
+{
+  Amg::Parameters amg_parameters(
+      opts.get("preconditioner.max_level", default_opts.get<int>("preconditioner.max_level")),
+      opts.get("preconditioner.coarse_target", default_opts.get<int>("preconditioner.coarse_target")),
+      opts.get("preconditioner.min_coarse_rate", default_opts.get<R>("preconditioner.min_coarse_rate")),
+      opts.get("preconditioner.prolong_damp", default_opts.get<R>("preconditioner.prolong_damp")));
+  amg_parameters.setDefaultValuesIsotropic(
+      opts.get("preconditioner.isotropy_dim", default_opts.get<size_t>("preconditioner.isotropy_dim")));
+  amg_parameters.setDefaultValuesAnisotropic(
+      opts.get("preconditioner.anisotropy_dim", default_opts.get<size_t>("preconditioner.anisotropy_dim")));
+  // a value of 0 (or no value) keeps the aggregate sizes derived from the dimensions above
+  const auto min_aggregate_size =
+      opts.get("preconditioner.min_aggregate_size", default_opts.get("preconditioner.min_aggregate_size", size_t(0)));
+  const auto max_aggregate_size =
+      opts.get("preconditioner.max_aggregate_size", default_opts.get("preconditioner.max_aggregate_size", size_t(0)));
+  if (min_aggregate_size > 0)
+    amg_parameters.setMinAggregateSize(min_aggregate_size);
+  if (max_aggregate_size > 0)
+    amg_parameters.setMaxAggregateSize(max_aggregate_size);
+  amg_parameters.setDebugLevel(opts.get("preconditioner.verbose", default_opts.get<int>("preconditioner.verbose")));
+  return amg_parameters;
+} // ... make_amg_parameters(...)
+
+
+template <class T>
+struct AmgSmootherTag
+{
+  using type = T;
+};
+
+
+/**
+ * \brief Calls f(AmgSmootherTag<SmootherType>()) for the sequential smoother given by smoother_type, one of "jacobi",
+ *        "gs", "sor", "ssor" or "ilu0" (see make_amg_smoother_parameters() for "gs").
+ *
+ * f has to return the same type for all smoothers.
+ */
+template <class IstlMatrixType, class IstlVectorType, class FunctorType>
+auto with_amg_smoother(const std::string& smoother_type, FunctorType&& f)
+    -> decltype(f(AmgSmootherTag<SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType>>()))
+{
+  if (smoother_type == "jacobi")
+    return f(AmgSmootherTag<SeqJac<IstlMatrixType, IstlVectorType, IstlVectorType>>());
+  else if (smoother_type == "gs" || smoother_type == "sor")
+    return f(AmgSmootherTag<SeqSOR<IstlMatrixType, IstlVectorType, IstlVectorType>>());
+  else if (smoother_type == "ssor")
+    return f(AmgSmootherTag<SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType>>());
+  else if (smoother_type == "ilu0")
+    return f(AmgSmootherTag<SeqILU0<IstlMatrixType, IstlVectorType, IstlVectorType>>());
+  else
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown smoother requested: " << smoother_type);
+} // ... with_amg_smoother(...)
+
+
+template <class SmootherType, class S>
+typename Amg::SmootherTraits<SmootherType>::Arguments make_amg_smoother_parameters(
+    const std::string& smoother_type, const Common::Configuration& opts, const Common::Configuration& default_opts)
+{
+  typename Amg::SmootherTraits<SmootherType>::Arguments smoother_parameters;
+  smoother_parameters.iterations = opts.get("smoother.iterations", default_opts.get<int>("smoother.iterations"));
+  // Gauss-Seidel is SOR without relaxation
+  smoother_parameters.relaxationFactor =
+      (smoother_type == "gs")
+          ? S(1)
+          : opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
+  return smoother_parameters;
+} // ... make_amg_smoother_parameters(...)
+
+
+/**
+ * \brief Calls f(criterion) with the coarsening criterion given by the option 'preconditioner.criterion', either
+ *        "symmetric" (only for matrices with a symmetric sparsity pattern, cheaper setup) or "unsymmetric".
+ *
+ * f has to return the same type for both criteria.
+ */
+template <class IstlMatrixType, class FunctorType>
+auto with_amg_criterion(const Amg::Parameters& amg_parameters,
+                        const Common::Configuration& opts,
+                        const Common::Configuration& default_opts,
+                        FunctorType&& f)
+    -> decltype(
+        f(std::declval<const Amg::CoarsenCriterion<Amg::SymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>>&>()))
+{
+  const auto criterion =
+      opts.get("preconditioner.criterion", default_opts.get("preconditioner.criterion", std::string("unsymmetric")));
+  if (criterion == "symmetric") {
+    Amg::CoarsenCriterion<Amg::SymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>> amg_criterion(amg_parameters);
+    return f(amg_criterion);
+  } else if (criterion == "unsymmetric") {
+    Amg::CoarsenCriterion<Amg::UnSymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>> amg_criterion(amg_parameters);
+    return f(amg_criterion);
+  } else
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown coarsening criterion requested: " << criterion);
+} // ... with_amg_criterion(...)
+
+
+//! Applies the Krylov method given by krylov_type ("bicgstab" or "cg", which requires a symmetric preconditioner).
+template <class IstlVectorType, class OperatorType, class ScalarProductType, class PreconditionerType>
+InverseOperatorResult apply_amg_krylov(const std::string& krylov_type,
+                                       OperatorType& matrix_operator,
+                                       ScalarProductType& scalar_product,
+                                       PreconditionerType& preconditioner,
+                                       const Common::Configuration& opts,
+                                       const Common::Configuration& default_opts,
+                                       const int verbose,
+                                       IstlVectorType& solution,
+                                       IstlVectorType& rhs)
+{
+  using R = typename FieldTraits<typename IstlVectorType::field_type>::real_type;
+  const R precision = opts.get("precision", default_opts.get<R>("precision"));
+  const int max_iter = opts.get("max_iter", default_opts.get<int>("max_iter"));
+  InverseOperatorResult stats;
+  if (krylov_type == "bicgstab") {
+    BiCGSTABSolver<IstlVectorType> solver(
+        matrix_operator, scalar_product, preconditioner, precision, max_iter, verbose);
+    solver.apply(solution, rhs, stats);
+  } else if (krylov_type == "cg") {
+    CGSolver<IstlVectorType> solver(matrix_operator, scalar_product, preconditioner, precision, max_iter, verbose);
+    solver.apply(solution, rhs, stats);
+  } else
+    DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown Krylov method requested: " << krylov_type);
+  return stats;
+} // ... apply_amg_krylov(...)
+
+
+/**
+ * \brief Identifies the AMG hierarchy set up for the given smoother and options, an AMG set up with other parameters
+ *        must not be reused.
+ */
+inline std::string amg_setup_key(const std::string& smoother_type,
+                                 const Common::Configuration& opts,
+                                 const Common::Configuration& default_opts)
+{
+  std::string key = smoother_type;
+  for (const std::string option : {"smoother.iterations",
+                                   "smoother.relaxation_factor",
+                                   "preconditioner.max_level",
+                                   "preconditioner.coarse_target",
+                                   "preconditioner.min_coarse_rate",
+                                   "preconditioner.prolong_damp",
+                                   "preconditioner.isotropy_dim",
+                                   "preconditioner.anisotropy_dim",
+                                   "preconditioner.criterion",
+                                   "preconditioner.min_aggregate_size",
+                                   "preconditioner.max_aggregate_size"})
+    key += "_" + opts.get(option, default_opts.get(option, std::string()));
+  return key;
+} // ... amg_setup_key(...)
+
+
+/**
+ * \brief The matrix operator and the AMG hierarchy built on it, which keeps a reference to the operator (both are thus
+ *        kept together if the setup is reused between solves).
+ */
+template <class OperatorType, class PreconditionerType>
+struct AmgSetup
+{
+  template <class... Args>
+  explicit AmgSetup(Args&&... operator_args)
+    : matrix_operator(std::forward<Args>(operator_args)...)
+  {}
+
+  OperatorType matrix_operator;
+  std::unique_ptr<PreconditionerType> preconditioner;
+}; // struct AmgSetup
+
+
+/**
+ * \brief Like AmgSetup, but the operator and the AMG hierarchy are built on a copy of the matrix in reduced precision,
+ *        which is kept as well.
+ */
+template <class ReducedMatrixType, class OperatorType, class PreconditionerType>
+struct ReducedPrecisionAmgSetup
+{
+  template <class MatrixType>
+  explicit ReducedPrecisionAmgSetup(const MatrixType& matrix)
+    : reduced_matrix(matrix.rows(), matrix.cols(), matrix.pattern())
+    , matrix_operator(reduced_matrix.backend())
+  {
+    using L = typename ReducedMatrixType::ScalarType;
+    for (size_t ii = 0; ii < matrix.rows(); ++ii) {
+      const auto& row = matrix.backend()[ii];
+      auto& reduced_row = reduced_matrix.backend()[ii];
+      for (auto it = row.begin(); it != row.end(); ++it)
+        reduced_row[it.index()] = static_cast<L>((*it)[0][0]);
+    }
+  }
+
+  ReducedMatrixType reduced_matrix;
+  OperatorType matrix_operator;
+  std::unique_ptr<PreconditionerType> preconditioner;
+}; // struct ReducedPrecisionAmgSetup
+
+
+/**
+ * \brief Default setup provider of AmgApplicator::call(), builds the AMG hierarchy for every solve.
+ *
+ * A setup provider is called as setup_provider(key, factory), where factory() returns a std::shared_ptr to a new
+ * setup and key identifies it (see amg_setup_key()). It may return a setup obtained earlier for the same key instead,
+ * e.g. from a SetupCache.
+ */
+struct AmgSetupEveryTime
+{
+  template <class FactoryType>
+  auto operator()(const std::string& /*key*/, const FactoryType& factory) const -> decltype(factory())
+  {
+    return factory();
+  }
+};
+
+
+} // namespace internal
+
+
+/**
+ * \brief Applies the Krylov method krylov_type ("bicgstab" or "cg"), preconditioned by an AMG with the given smoother
+ *        (see internal::with_amg_smoother) and the coarsening criterion given by 'preconditioner.criterion'.
+ *
+ * The operator and the AMG hierarchy are obtained from the setup_provider given to call() (see
+ * internal::AmgSetupEveryTime), which allows to reuse them between calls. This is the general, parallel case.
+ */
 template <class S, class CommunicatorType>
 class AmgApplicator
 {
@@ -48,97 +275,60 @@ public:
     , communicator_(comm)
   {}
 
+  template <class SetupProviderType = internal::AmgSetupEveryTime>
   InverseOperatorResult call(IstlDenseVector<S>& rhs,
                              IstlDenseVector<S>& solution,
                              const Common::Configuration& opts,
                              const Common::Configuration& default_opts,
-                             const std::string& smoother_type)
+                             const std::string& smoother_type,
+                             const std::string& krylov_type = "bicgstab",
+                             const SetupProviderType& setup_provider = SetupProviderType())
   {
     // define the matrix operator
-
     typedef OverlappingSchwarzOperator<IstlMatrixType, IstlVectorType, IstlVectorType, CommunicatorType>
         MatrixOperatorType;
-    MatrixOperatorType matrix_operator(matrix_.backend(), communicator_);
 
     // define the scalar product
     OverlappingSchwarzScalarProduct<IstlVectorType, CommunicatorType> scalar_product(communicator_);
 
-    // ILU0 as the smoother for the AMG
-    typedef SeqILU0<IstlMatrixType, IstlVectorType, IstlVectorType, 1> SequentialSmootherType_ILU;
-    typedef BlockPreconditioner<IstlVectorType, IstlVectorType, CommunicatorType, SequentialSmootherType_ILU>
-        SmootherType_ILU;
-    typename Amg::SmootherTraits<SmootherType_ILU>::Arguments smoother_parameters_ILU;
-    smoother_parameters_ILU.iterations =
-        opts.get("smoother.iterations", default_opts.get<size_t>("smoother.iterations"));
-    smoother_parameters_ILU.relaxationFactor =
-        opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-    // SSOR as the smoother for the amg
-    typedef SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType, 1> SequentialSmootherType_SSOR;
-    typedef BlockPreconditioner<IstlVectorType, IstlVectorType, CommunicatorType, SequentialSmootherType_SSOR>
-        SmootherType_SSOR;
-    typename Amg::SmootherTraits<SmootherType_SSOR>::Arguments smoother_parameters_SSOR;
-    smoother_parameters_SSOR.iterations =
-        opts.get("smoother.iterations", default_opts.get<size_t>("smoother.iterations"));
-    smoother_parameters_SSOR.relaxationFactor =
-        opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-
-    // define the AMG as the preconditioner for the BiCGStab solver
-    Amg::Parameters amg_parameters(
-        opts.get("preconditioner.max_level", default_opts.get<size_t>("preconditioner.max_level")),
-        opts.get("preconditioner.coarse_target", default_opts.get<size_t>("preconditioner.coarse_target")),
-        opts.get("preconditioner.min_coarse_rate", default_opts.get<R>("preconditioner.min_coarse_rate")),
-        opts.get("preconditioner.prolong_damp", default_opts.get<R>("preconditioner.prolong_damp")));
-    amg_parameters.setDefaultValuesIsotropic(
-        opts.get("preconditioner.isotropy_dim", default_opts.get<size_t>("preconditioner.isotropy_dim")));
-    amg_parameters.setDefaultValuesAnisotropic(
-        opts.get("preconditioner.anisotropy_dim", default_opts.get<size_t>("preconditioner.anisotropy_dim")));
-    amg_parameters.setDebugLevel(opts.get("preconditioner.verbose", default_opts.get<int>("preconditioner.verbose")));
-    Amg::CoarsenCriterion<Amg::UnSymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>> amg_criterion(amg_parameters);
-    if (smoother_type == "ilu0") {
-      typedef Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType_ILU, CommunicatorType> PreconditionerType_ILU;
-      PreconditionerType_ILU preconditioner(matrix_operator, amg_criterion, smoother_parameters_ILU, communicator_);
-
-      // define the BiCGStab as the actual solver
-      BiCGSTABSolver<IstlVectorType> solver(
-          matrix_operator,
-          scalar_product,
-          preconditioner,
-          opts.get("precision", default_opts.get<S>("precision")),
-          opts.get("max_iter", default_opts.get<size_t>("max_iter")),
-#if HAVE_MPI
-          (communicator_.communicator().rank() == 0) ? opts.get("verbose", default_opts.get<int>("verbose")) : 0
-#else // HAVE_MPI
-          opts.get("verbose", default_opts.get<int>("verbose"))
-#endif
-      );
-
-      InverseOperatorResult stats;
-      solver.apply(solution.backend(), rhs.backend(), stats);
-      return stats;
-    } else if (smoother_type == "ssor") {
-      typedef Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType_SSOR, CommunicatorType> PreconditionerType_SSOR;
-      PreconditionerType_SSOR preconditioner(matrix_operator, amg_criterion, smoother_parameters_ILU, communicator_);
-
-      // define the BiCGStab as the actual solver
-      BiCGSTABSolver<IstlVectorType> solver(
-          matrix_operator,
-          scalar_product,
-          preconditioner,
-          opts.get("precision", default_opts.get<S>("precision")),
-          opts.get("max_iter", default_opts.get<size_t>("max_iter")),
+    const auto amg_parameters = internal::make_amg_parameters<R>(opts, default_opts);
+    const int verbose =
 #if HAVE_MPI
-          (communicator_.communicator().rank() == 0) ? opts.get("verbose", default_opts.get<int>("verbose")) : 0
+        (communicator_.communicator().rank() == 0) ? opts.get("verbose", default_opts.get<int>("verbose")) : 0;
 #else // HAVE_MPI
-          opts.get("verbose", default_opts.get<int>("verbose"))
+        opts.get("verbose", default_opts.get<int>("verbose"));
 #endif
-      );
-
-      InverseOperatorResult stats;
-      solver.apply(solution.backend(), rhs.backend(), stats);
-      return stats;
-    } else
-      DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown smoother requested: " << smoother_type);
+    return internal::with_amg_smoother<IstlMatrixType, IstlVectorType>(smoother_type, [&](auto smoother_tag) {
+      // the sequential smoother is applied on each rank
+      typedef typename decltype(smoother_tag)::type SequentialSmootherType;
+      typedef BlockPreconditioner<IstlVectorType, IstlVectorType, CommunicatorType, SequentialSmootherType>
+          SmootherType;
+      const auto smoother_parameters =
+          internal::make_amg_smoother_parameters<SmootherType, S>(smoother_type, opts, default_opts);
+      return internal::with_amg_criterion<IstlMatrixType>(
+          amg_parameters, opts, default_opts, [&](const auto& amg_criterion) {
+            typedef Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType, CommunicatorType> PreconditionerType;
+            typedef internal::AmgSetup<MatrixOperatorType, PreconditionerType> SetupType;
+            const auto setup =
+                setup_provider(internal::amg_setup_key(smoother_type, opts, default_opts), [&]() {
+                  auto ret = std::make_shared<SetupType>(matrix_.backend(), communicator_);
+                  ret->preconditioner.reset(new PreconditionerType(
+                      ret->matrix_operator, amg_criterion, smoother_parameters, communicator_));
+                  return ret;
+                });
+            return internal::apply_amg_krylov(krylov_type,
+                                              setup->matrix_operator,
+                                              scalar_product,
+                                              *setup->preconditioner,
+                                              opts,
+                                              default_opts,
+                                              verbose,
+                                              solution.backend(),
+                                              rhs.backend());
+          });
+    });
   } // ... call(...)
+
 protected:
   const MatrixType& matrix_;
   const CommunicatorType& communicator_;
@@ -159,69 +349,48 @@ public:
     , communicator_(comm)
   {}
 
+  template <class SetupProviderType = internal::AmgSetupEveryTime>
   InverseOperatorResult call(IstlDenseVector<S>& rhs,
                              IstlDenseVector<S>& solution,
                              const Common::Configuration& opts,
                              const Common::Configuration& default_opts,
-                             const std::string& smoother_type)
+                             const std::string& smoother_type,
+                             const std::string& krylov_type = "bicgstab",
+                             const SetupProviderType& setup_provider = SetupProviderType())
   {
     typedef MatrixAdapter<IstlMatrixType, IstlVectorType, IstlVectorType> MatrixOperatorType;
-    MatrixOperatorType matrix_operator(matrix_.backend());
 
     // define the scalar product
-    Dune::SeqScalarProduct<typename IstlDenseVector<S>::BackendType> scalar_product;
-
-    // define the AMG as the preconditioner for the BiCGStab solver
-    Amg::Parameters amg_parameters(
-        opts.get("preconditioner.max_level", default_opts.get<int>("preconditioner.max_level")),
-        opts.get("preconditioner.coarse_target", default_opts.get<int>("preconditioner.coarse_target")),
-        opts.get("preconditioner.min_coarse_rate", default_opts.get<R>("preconditioner.min_coarse_rate")),
-        opts.get("preconditioner.prolong_damp", default_opts.get<R>("preconditioner.prolong_damp")));
-    amg_parameters.setDefaultValuesIsotropic(
-        opts.get("preconditioner.isotropy_dim", default_opts.get<size_t>("preconditioner.isotropy_dim")));
-    amg_parameters.setDefaultValuesAnisotropic(
-        opts.get("preconditioner.anisotropy_dim", default_opts.get<size_t>("preconditioner.anisotropy_dim")));
-    amg_parameters.setDebugLevel(opts.get("preconditioner.verbose", default_opts.get<int>("preconditioner.verbose")));
-    Amg::CoarsenCriterion<Amg::UnSymmetricCriterion<IstlMatrixType, Amg::FirstDiagonal>> amg_criterion(amg_parameters);
+    Dune::SeqScalarProduct<IstlVectorType> scalar_product;
 
-    InverseOperatorResult stats;
-    if (smoother_type == "ilu0") {
-      typedef SeqILU0<IstlMatrixType, IstlVectorType, IstlVectorType> SmootherType;
-
-      typename Amg::SmootherTraits<SmootherType>::Arguments smoother_parameters;
-      smoother_parameters.iterations = opts.get("smoother.iterations", default_opts.get<int>("smoother.iterations"));
-      smoother_parameters.relaxationFactor =
-          opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-      typedef Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType> PreconditionerType;
-      PreconditionerType preconditioner(matrix_operator, amg_criterion, smoother_parameters);
-      // define the BiCGStab as the actual solver
-      BiCGSTABSolver<IstlVectorType> solver(matrix_operator,
-                                            scalar_product,
-                                            preconditioner,
-                                            opts.get("precision", default_opts.get<S>("precision")),
-                                            opts.get("max_iter", default_opts.get<int>("max_iter")),
-                                            opts.get("verbose", default_opts.get<int>("verbose")));
-      solver.apply(solution.backend(), rhs.backend(), stats);
-    } else if (smoother_type == "ssor") {
-      typedef SeqSSOR<IstlMatrixType, IstlVectorType, IstlVectorType> SmootherType;
-
-      typename Amg::SmootherTraits<SmootherType>::Arguments smoother_parameters;
-      smoother_parameters.iterations = opts.get("smoother.iterations", default_opts.get<int>("smoother.iterations"));
-      smoother_parameters.relaxationFactor =
-          opts.get("smoother.relaxation_factor", default_opts.get<S>("smoother.relaxation_factor"));
-      typedef Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType> PreconditionerType;
-      PreconditionerType preconditioner(matrix_operator, amg_criterion, smoother_parameters);
-      BiCGSTABSolver<IstlVectorType> solver(matrix_operator,
-                                            scalar_product,
-                                            preconditioner,
-                                            opts.get("precision", default_opts.get<S>("precision")),
-                                            opts.get("max_iter", default_opts.get<int>("max_iter")),
-                                            opts.get("verbose", default_opts.get<int>("verbose")));
-      solver.apply(solution.backend(), rhs.backend(), stats);
-    } else {
-      DUNE_THROW(Common::Exceptions::wrong_input_given, "Unknown smoother requested: " << smoother_type);
-    }
-    return stats;
+    const auto amg_parameters = internal::make_amg_parameters<R>(opts, default_opts);
+    const int verbose = opts.get("verbose", default_opts.get<int>("verbose"));
+    return internal::with_amg_smoother<IstlMatrixType, IstlVectorType>(smoother_type, [&](auto smoother_tag) {
+      typedef typename decltype(smoother_tag)::type SmootherType;
+      const auto smoother_parameters =
+          internal::make_amg_smoother_parameters<SmootherType, S>(smoother_type, opts, default_opts);
+      return internal::with_amg_criterion<IstlMatrixType>(
+          amg_parameters, opts, default_opts, [&](const auto& amg_criterion) {
+            typedef Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType> PreconditionerType;
+            typedef internal::AmgSetup<MatrixOperatorType, PreconditionerType> SetupType;
+            const auto setup =
+                setup_provider(internal::amg_setup_key(smoother_type, opts, default_opts), [&]() {
+                  auto ret = std::make_shared<SetupType>(matrix_.backend());
+                  ret->preconditioner.reset(
+                      new PreconditionerType(ret->matrix_operator, amg_criterion, smoother_parameters));
+                  return ret;
+                });
+            return internal::apply_amg_krylov(krylov_type,
+                                              setup->matrix_operator,
+                                              scalar_product,
+                                              *setup->preconditioner,
+                                              opts,
+                                              default_opts,
+                                              verbose,
+                                              solution.backend(),
+                                              rhs.backend());
+          });
+    });
   } // ... call(...)
 
 protected:
@@ -13,8 +13,10 @@
 #ifndef DUNE_XT_LA_SOLVER_ISTL_PRECONDITIONERS_HH
 #define DUNE_XT_LA_SOLVER_ISTL_PRECONDITIONERS_HH
 
+#include <cassert>
 #include <type_traits>
 #include <cmath>
+#include <vector>
 
 #include <dune/istl/preconditioners.hh>
 
@@ -59,6 +61,119 @@ private:
 };
 
 
+/**
+ * \brief Applies a preconditioner acting on vectors of reduced precision (e.g. float) to vectors of type V.
+ *
+ * The defect is rounded to the reduced precision, the correction is computed by the wrapped preconditioner and then
+ * converted back. This allows to set up expensive preconditioners (e.g. an AMG hierarchy) on a reduced precision copy
+ * of the matrix, while the surrounding Krylov solver still computes all residuals in the precision of V.
+ */
+template <class V, class ReducedPreconditionerType>
+class ReducedPrecisionPreconditioner : public Dune::Preconditioner<V, V>
+{
+  typedef typename ReducedPreconditionerType::domain_type ReducedVectorType;
+  typedef typename ReducedVectorType::field_type ReducedFieldType;
+
+public:
+  //! \brief The domain type of the preconditioner.
+  typedef V domain_type;
+  //! \brief The range type of the preconditioner.
+  typedef V range_type;
+  //! \brief The field type of the preconditioner.
+  typedef typename range_type::field_type field_type;
+
+  ReducedPrecisionPreconditioner(ReducedPreconditionerType& preconditioner, const size_t size)
+    : preconditioner_(preconditioner)
+    , reduced_v_(size)
+    , reduced_d_(size)
+  {}
+
+  //! Category of the preconditioner (see SolverCategory::Category)
+  virtual SolverCategory::Category category() const override final
+  {
+    return preconditioner_.category();
+  }
+
+  virtual void pre(domain_type&, range_type&) override final
+  {
+    reduced_v_ = ReducedFieldType(0);
+    reduced_d_ = ReducedFieldType(0);
+    preconditioner_.pre(reduced_v_, reduced_d_);
+  }
+
+  virtual void apply(domain_type& v, const range_type& d) override final
+  {
+    for (size_t ii = 0; ii < d.size(); ++ii)
+      for (size_t jj = 0; jj < d[ii].size(); ++jj)
+        reduced_d_[ii][jj] = static_cast<ReducedFieldType>(d[ii][jj]);
+    reduced_v_ = ReducedFieldType(0);
+    preconditioner_.apply(reduced_v_, reduced_d_);
+    for (size_t ii = 0; ii < v.size(); ++ii)
+      for (size_t jj = 0; jj < v[ii].size(); ++jj)
+        v[ii][jj] = static_cast<field_type>(reduced_v_[ii][jj]);
+  }
+
+  virtual void post(domain_type&) override final
+  {
+    preconditioner_.post(reduced_v_);
+  }
+
+private:
+  ReducedPreconditionerType& preconditioner_;
+  ReducedVectorType reduced_v_;
+  ReducedVectorType reduced_d_;
+};
+
+
+/**
+ * \brief Makes an incomplete factorization (see algorithms/incomplete_factorization.hh) usable as an ISTL
+ *        preconditioner for vectors with blocks of size 1.
+ *
+ * The factorization is not copied, it may thus be recomputed by calling numeric() between the solves.
+ */
+template <class V, class FactorizationType>
+class IncompleteFactorizationPreconditioner : public Dune::Preconditioner<V, V>
+{
+public:
+  //! \brief The domain type of the preconditioner.
+  typedef V domain_type;
+  //! \brief The range type of the preconditioner.
+  typedef V range_type;
+  //! \brief The field type of the preconditioner.
+  typedef typename range_type::field_type field_type;
+
+  IncompleteFactorizationPreconditioner(const FactorizationType& factorization)
+    : factorization_(factorization)
+    , buffer_(factorization_.rows())
+  {}
+
+  //! Category of the preconditioner (see SolverCategory::Category)
+  virtual SolverCategory::Category category() const override final
+  {
+    return SolverCategory::Category::sequential;
+  }
+
+  virtual void pre(domain_type&, range_type&) override final {}
+
+  virtual void apply(domain_type& v, const range_type& d) override final
+  {
+    static_assert(range_type::block_type::dimension == 1, "Only implemented for blocks of size 1!");
+    assert(d.size() == buffer_.size());
+    for (size_t ii = 0; ii < d.size(); ++ii)
+      buffer_[ii] = d[ii][0];
+    factorization_.apply(buffer_);
+    for (size_t ii = 0; ii < v.size(); ++ii)
+      v[ii][0] = buffer_[ii];
+  }
+
+  virtual void post(domain_type&) override final {}
+
+private:
+  const FactorizationType& factorization_;
+  std::vector<field_type> buffer_;
+};
+
+
 } // namespace LA
 } // namespace XT
 } // namespace Dune
@@ -0,0 +1,311 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_SOLVER_ISTL_RECYCLING_HH
+#define DUNE_XT_LA_SOLVER_ISTL_RECYCLING_HH
+
+#include <cmath>
+#include <deque>
+#include <limits>
+
+#include <dune/common/ftraits.hh>
+#include <dune/common/timer.hh>
+
+#include <dune/istl/solver.hh>
+
+namespace Dune {
+namespace XT {
+namespace LA {
+
+
+/**
+ * \brief A small subspace span{u_1, ..., u_k} gathered from previous solves, together with the images c_i = A u_i.
+ *
+ * The subspace is spanned by (orthonormalized) previous solutions, i.e. this is a deflation with the solution space of
+ * the previous systems. No (harmonic) Ritz vectors of the Krylov spaces are extracted, so the subspace only pays off if
+ * the solutions of subsequent systems are close to each other (e.g. in time stepping or continuation), it does not
+ * target the part of the spectrum which slows down the iteration.
+ *
+ * Depending on how vectors are added, the basis is either A-orthonormal (u_i^T A u_j = delta_ij, for symmetric
+ * positive definite matrices) or the images are orthonormal (c_i^T c_j = delta_ij, for general matrices). In both
+ * cases, if more than max_size() vectors are added, the oldest one is dropped, which keeps the remaining basis
+ * orthonormal.
+ */
+template <class V>
+class RecycledSubspace
+{
+  typedef typename V::field_type F;
+  typedef typename FieldTraits<F>::real_type R;
+
+public:
+  enum class Orthogonality
+  {
+    energy,
+    image
+  };
+
+  RecycledSubspace(const size_t max_sz = 0, const Orthogonality orthogonality = Orthogonality::energy)
+    : max_size_(max_sz)
+    , orthogonality_(orthogonality)
+  {}
+
+  size_t size() const
+  {
+    return basis_.size();
+  }
+
+  size_t max_size() const
+  {
+    return max_size_;
+  }
+
+  Orthogonality orthogonality() const
+  {
+    return orthogonality_;
+  }
+
+  void clear()
+  {
+    basis_.clear();
+    images_.clear();
+  }
+
+  /// \note Clears the subspace if the orthogonality changes.
+  void setup(const size_t max_sz, const Orthogonality orthogonality)
+  {
+    if (orthogonality != orthogonality_)
+      clear();
+    orthogonality_ = orthogonality;
+    max_size_ = max_sz;
+    while (size() > max_size_) {
+      basis_.pop_front();
+      images_.pop_front();
+    }
+  } // ... setup(...)
+
+  const std::deque<V>& basis() const
+  {
+    return basis_;
+  }
+
+  const std::deque<V>& images() const
+  {
+    return images_;
+  }
+
+  /**
+   * \brief Orthonormalizes vec against the current basis and adds it, if it is not (almost) contained in it.
+   * \note  Directions which contribute less than 1e-6 (relative) are dropped, they would hardly improve the next
+   *        initial guess.
+   */
+  template <class OperatorType, class ScalarProductType>
+  void add(const V& vec, OperatorType& op, ScalarProductType& sp)
+  {
+    if (max_size_ == 0)
+      return;
+    const R vec_norm = sp.norm(vec);
+    if (!(vec_norm > 0))
+      return;
+    V basis_vector = vec;
+    V image(vec.size());
+    if (orthogonality_ == Orthogonality::energy) {
+      for (size_t ii = 0; ii < size(); ++ii)
+        basis_vector.axpy(-sp.dot(images_[ii], basis_vector), basis_[ii]);
+      if (!(sp.norm(basis_vector) > 1e-6 * vec_norm))
+        return;
+      op.apply(basis_vector, image);
+      const R energy = std::real(sp.dot(basis_vector, image));
+      if (!(energy > 0))
+        return;
+      basis_vector *= 1. / std::sqrt(energy);
+      image *= 1. / std::sqrt(energy);
+    } else {
+      op.apply(basis_vector, image);
+      const R image_norm = sp.norm(image);
+      for (size_t ii = 0; ii < size(); ++ii) {
+        const F coeff = sp.dot(images_[ii], image);
+        image.axpy(-coeff, images_[ii]);
+        basis_vector.axpy(-coeff, basis_[ii]);
+      }
+      const R reduced_norm = sp.norm(image);
+      if (!(reduced_norm > 1e-6 * image_norm))
+        return;
+      basis_vector *= 1. / reduced_norm;
+      image *= 1. / reduced_norm;
+    }
+    if (size() == max_size_) {
+      basis_.pop_front();
+      images_.pop_front();
+    }
+    basis_.push_back(std::move(basis_vector));
+    images_.push_back(std::move(image));
+  } // ... add(...)
+
+  /**
+   * \brief Recomputes the images (and orthonormalizes again), to be called if the operator has changed.
+   */
+  template <class OperatorType, class ScalarProductType>
+  void refresh(OperatorType& op, ScalarProductType& sp)
+  {
+    std::deque<V> old_basis;
+    std::swap(old_basis, basis_);
+    images_.clear();
+    for (const auto& vec : old_basis)
+      add(vec, op, sp);
+  }
+
+  /**
+   * \brief Projects the initial guess onto the subspace, i.e. x += U c and r -= C c, where c is chosen such that the
+   *        error is minimized in the energy norm (Orthogonality::energy) or the residual is minimized in the 2-norm
+   *        (Orthogonality::image).
+   * \note  Expects r = b - A x on entry.
+   */
+  template <class ScalarProductType>
+  void project(V& x, V& r, ScalarProductType& sp) const
+  {
+    for (size_t ii = 0; ii < size(); ++ii) {
+      const F coeff = (orthogonality_ == Orthogonality::energy) ? sp.dot(basis_[ii], r) : sp.dot(images_[ii], r);
+      x.axpy(coeff, basis_[ii]);
+      r.axpy(-coeff, images_[ii]);
+    }
+  } // ... project(...)
+
+  /// \brief Computes p -= U (C^T z), i.e. makes p A-orthogonal to the subspace (for Orthogonality::energy).
+  template <class ScalarProductType>
+  void deflate(V& p, const V& z, ScalarProductType& sp) const
+  {
+    for (size_t ii = 0; ii < size(); ++ii)
+      p.axpy(-sp.dot(images_[ii], z), basis_[ii]);
+  }
+
+private:
+  size_t max_size_;
+  Orthogonality orthogonality_;
+  std::deque<V> basis_;
+  std::deque<V> images_;
+}; // class RecycledSubspace
+
+
+/**
+ * \brief Deflated preconditioned conjugate gradient method.
+ *
+ * The initial guess is projected onto the given (A-orthonormal) subspace and the search directions are kept
+ * A-orthogonal to it. Since the subspace consists of previous solutions (see RecycledSubspace), the gain mostly stems
+ * from the improved initial guess, see projection_reduction().
+ * The reduction is measured with respect to the residual of the given initial guess (before the projection), such that
+ * the iteration counts are comparable to the ones of the undeflated method. Nothing is printed, the progress is only
+ * reported by the InverseOperatorResult and the accessors below.
+ *
+ * \sa Saad, Yeung, Erhel, Guyomarc'h, A deflated version of the conjugate gradient algorithm, SISC 21 (2000)
+ */
+template <class V>
+class DeflatedCGSolver
+{
+  typedef typename V::field_type F;
+  typedef typename FieldTraits<F>::real_type R;
+
+public:
+  DeflatedCGSolver(LinearOperator<V, V>& op,
+                   ScalarProduct<V>& sp,
+                   Preconditioner<V, V>& prec,
+                   const RecycledSubspace<V>& subspace,
+                   const R reduction,
+                   const int maxit)
+    : op_(op)
+    , sp_(sp)
+    , prec_(prec)
+    , subspace_(subspace)
+    , reduction_(reduction)
+    , maxit_(maxit)
+    , initial_defect_(std::numeric_limits<R>::quiet_NaN())
+    , projection_reduction_(std::numeric_limits<R>::quiet_NaN())
+  {}
+
+  /// \brief The norm of the residual of the initial guess given to the last apply() (before the projection).
+  R initial_defect() const
+  {
+    return initial_defect_;
+  }
+
+  /// \brief The residual reduction of the last apply() due to the projection onto the subspace alone.
+  R projection_reduction() const
+  {
+    return projection_reduction_;
+  }
+
+  /// \note Overwrites b with the residual, as the dune-istl solvers do.
+  void apply(V& x, V& b, InverseOperatorResult& res)
+  {
+    res.clear();
+    Dune::Timer watch;
+    op_.applyscaleadd(-1., x, b);
+    const R def_initial = sp_.norm(b);
+    initial_defect_ = def_initial;
+    subspace_.project(x, b, sp_);
+    R def = sp_.norm(b);
+    projection_reduction_ = (def_initial > 0) ? def / def_initial : R(0);
+    int iteration = 0;
+    if (def <= reduction_ * def_initial || !(def > 1e-30)) {
+      finish(res, iteration, def, def_initial, watch);
+      return;
+    }
+    V z(b.size());
+    V p(b.size());
+    V q(b.size());
+    prec_.pre(x, b);
+    z = F(0);
+    prec_.apply(z, b);
+    p = z;
+    subspace_.deflate(p, z, sp_);
+    F rho = sp_.dot(b, z);
+    while (iteration < maxit_) {
+      ++iteration;
+      op_.apply(p, q);
+      const F alpha = rho / sp_.dot(p, q);
+      x.axpy(alpha, p);
+      b.axpy(-alpha, q);
+      def = sp_.norm(b);
+      if (def <= reduction_ * def_initial)
+        break;
+      z = F(0);
+      prec_.apply(z, b);
+      const F rho_new = sp_.dot(b, z);
+      p *= rho_new / rho;
+      p += z;
+      subspace_.deflate(p, z, sp_);
+      rho = rho_new;
+    }
+    prec_.post(x);
+    finish(res, iteration, def, def_initial, watch);
+  } // ... apply(...)
+
+private:
+  void finish(InverseOperatorResult& res, const int iteration, const R def, const R def_initial, Dune::Timer& watch)
+  {
+    res.iterations = iteration;
+    res.reduction = (def_initial > 0) ? def / def_initial : 0.;
+    res.converged = (def <= reduction_ * def_initial) || !(def > 1e-30);
+    res.conv_rate = (iteration > 0) ? std::pow(res.reduction, 1.0 / iteration) : 0.;
+    res.elapsed = watch.elapsed();
+  } // ... finish(...)
+
+  LinearOperator<V, V>& op_;
+  ScalarProduct<V>& sp_;
+  Preconditioner<V, V>& prec_;
+  const RecycledSubspace<V>& subspace_;
+  const R reduction_;
+  const int maxit_;
+  R initial_defect_;
+  R projection_reduction_;
+}; // class DeflatedCGSolver
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_SOLVER_ISTL_RECYCLING_HH
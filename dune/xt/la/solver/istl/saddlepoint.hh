@@ -27,15 +27,137 @@
 #include <dune/xt/la/solver.hh>
 
 #include "preconditioners.hh"
+#include "saddlepointpreconditioner.hh"
 #include "schurcomplement.hh"
 
 namespace Dune {
 namespace XT {
 namespace LA {
+namespace internal {
+
+
+// the block preconditioned Krylov methods rely on the ISTL AMG and are thus only available for ISTL containers
+template <class VectorType, class MatrixType>
+struct BlockPreconditionedSaddlePointSolver
+{
+  static const bool available = false;
+
+  template <class... Args>
+  static InverseOperatorResult apply(Args&&... /*args*/)
+  {
+    DUNE_THROW(Common::Exceptions::wrong_input_given,
+               "The block preconditioned saddle point solvers are only available for ISTL containers!");
+    return InverseOperatorResult();
+  }
+}; // struct BlockPreconditionedSaddlePointSolver
+
+
+template <class S>
+struct BlockPreconditionedSaddlePointSolver<IstlDenseVector<S>, IstlRowMajorSparseMatrix<S>>
+{
+  using Vector = IstlDenseVector<S>;
+  using Matrix = IstlRowMajorSparseMatrix<S>;
+  using R = typename Matrix::RealType;
+  using IstlVectorType = typename Vector::BackendType;
+
+  static const bool available = true;
+
+  static InverseOperatorResult apply(const Matrix& A,
+                                     const Matrix& B1,
+                                     const Matrix& B2,
+                                     const Matrix& C,
+                                     const Matrix* pressure_mass_matrix,
+                                     const Vector& f,
+                                     const Vector& g,
+                                     Vector& u,
+                                     Vector& p,
+                                     const Common::Configuration& opts,
+                                     const Common::Configuration& default_opts,
+                                     SolverStatistics& statistics)
+  {
+    Dune::Timer timer;
+    const auto type = opts.get<std::string>("type");
+    const size_t m = f.size();
+    const size_t n = g.size();
+    // the approximation of the Schur complement
+    const auto schur_approximation =
+        opts.get("schur_approximation", default_opts.get<std::string>("schur_approximation"));
+    SolverUtils::check_given(schur_approximation, {"simple", "mass"});
+    std::unique_ptr<Matrix> simple_S_hat;
+    if (schur_approximation == "mass") {
+      if (pressure_mass_matrix == nullptr)
+        DUNE_THROW(Common::Exceptions::wrong_input_given,
+                   "schur_approximation 'mass' requires a pressure mass matrix to be given on construction!");
+    } else
+      simple_S_hat = std::make_unique<Matrix>(simple_schur_complement_approximation(A, B1, B2, C));
+    const Matrix& S_hat = simple_S_hat ? *simple_S_hat : *pressure_mass_matrix;
+    // the monolithic system, only the vectors are stacked
+    IstlVectorType rhs(m + n);
+    IstlVectorType solution(m + n);
+    for (size_t ii = 0; ii < m; ++ii) {
+      rhs[ii] = f[ii];
+      solution[ii] = u[ii];
+    }
+    for (size_t ii = 0; ii < n; ++ii) {
+      rhs[m + ii] = g[ii];
+      solution[m + ii] = p[ii];
+    }
+    SaddlePointOperator<S> system_operator(A, B1, B2, C);
+    SeqScalarProduct<IstlVectorType> scalar_product;
+    SaddlePointBlockPreconditioner<S> preconditioner(A, B1, S_hat, type == "gmres.blocktriangular", opts, default_opts);
+    // as for the Schur complement types, the initial residual is only reported if it is available for free, i.e. for
+    // a zero initial guess
+    if (!(solution.infinity_norm() > 0))
+      statistics.initial_residual = rhs.two_norm();
+    statistics.setup_time = timer.elapsed();
+    timer.reset();
+    const R precision = opts.get("precision", default_opts.get<R>("precision"));
+    const int max_iter = opts.get("max_iter", default_opts.get<int>("max_iter"));
+    const int verbose = opts.get("verbose", default_opts.get<int>("verbose"));
+    InverseOperatorResult result;
+    if (type == "minres.blockdiagonal") {
+      MINRESSolver<IstlVectorType> solver(
+          system_operator, scalar_product, preconditioner, precision, max_iter, verbose);
+      solver.apply(solution, rhs, result);
+    } else if (type == "gmres.blocktriangular") {
+      RestartedGMResSolver<IstlVectorType> solver(system_operator,
+                                                  scalar_product,
+                                                  preconditioner,
+                                                  precision,
+                                                  opts.get("restart", default_opts.get<int>("restart")),
+                                                  max_iter,
+                                                  verbose);
+      solver.apply(solution, rhs, result);
+    } else
+      DUNE_THROW(Common::Exceptions::internal_error,
+                 "Given type '" << type << "' is not a block preconditioned type!");
+    for (size_t ii = 0; ii < m; ++ii)
+      u[ii] = solution[ii][0];
+    for (size_t ii = 0; ii < n; ++ii)
+      p[ii] = solution[m + ii][0];
+    statistics.solve_time = timer.elapsed();
+    statistics.iterations = result.iterations;
+    statistics.convergence_rate = result.conv_rate;
+    statistics.final_residual = result.reduction * statistics.initial_residual;
+    return result;
+  } // ... apply(...)
+}; // struct BlockPreconditionedSaddlePointSolver<IstlDenseVector<S>, IstlRowMajorSparseMatrix<S>>
+
+
+} // namespace internal
 
 
 // Solver for saddle point system (A B1; B2^T C) (u; p) = (f; g) using the Schur complement, i.e., solve (B2^T A^{-1} B1
 // - C) p = B2^T A^{-1} f - g first and then u = A^{-1} (F - B1 p)
+// For ISTL containers, the types minres.blockdiagonal and gmres.blocktriangular instead apply a Krylov method to the
+// whole system (without assembling it), preconditioned by AMG for A and by AMG for an approximation of the Schur
+// complement, see SaddlePointBlockPreconditioner. The approximation is chosen by the option 'schur_approximation':
+// "simple" (B2^T diag(A)^{-1} B1 - C) or "mass" (the pressure mass matrix given on construction). minres.blockdiagonal
+// requires a symmetric system (A and C symmetric, B1 == B2) and a positive definite approximation.
+// In parallel (i.e. for a CommunicatorType other than SequentialCommunication), the communicators of the velocity and
+// pressure DoFs have to be given on construction and only cg_cg_schurcomplement is available, see
+// SchurComplementOperator for the requirements on the decomposition. The inner solver (option 'inner_solver') has to
+// be a parallel one then.
 template <class VectorType = IstlDenseVector<double>,
           class MatrixType = IstlRowMajorSparseMatrix<double>,
           class CommunicatorType = SequentialCommunication>
@@ -53,11 +175,47 @@ public:
     , B1_(B1)
     , B2_(B2)
     , C_(C)
+    , pressure_mass_matrix_(nullptr)
+    , velocity_communicator_(new CommunicatorType())
+    , pressure_communicator_(new CommunicatorType())
+  {}
+
+  SaddlePointSolver(const Matrix& A,
+                    const Matrix& B1,
+                    const Matrix& B2,
+                    const Matrix& C,
+                    const CommunicatorType& velocity_communicator,
+                    const CommunicatorType& pressure_communicator)
+    : A_(A)
+    , B1_(B1)
+    , B2_(B2)
+    , C_(C)
+    , pressure_mass_matrix_(nullptr)
+    , velocity_communicator_(velocity_communicator)
+    , pressure_communicator_(pressure_communicator)
+  {}
+
+  // the pressure mass matrix M (n x n) is only used by the block preconditioned types with schur_approximation "mass"
+  SaddlePointSolver(const Matrix& A, const Matrix& B1, const Matrix& B2, const Matrix& C, const Matrix& M)
+    : A_(A)
+    , B1_(B1)
+    , B2_(B2)
+    , C_(C)
+    , pressure_mass_matrix_(&M)
+    , velocity_communicator_(new CommunicatorType())
+    , pressure_communicator_(new CommunicatorType())
   {}
 
   static std::vector<std::string> types()
   {
+    // the system matrix for "direct" and the block preconditioners can not be set up in parallel
+    if (!std::is_same<CommunicatorType, SequentialCommunication>::value)
+      return {"cg_cg_schurcomplement"};
     std::vector<std::string> ret{"direct", "cg_cg_schurcomplement", "cg_direct_schurcomplement"};
+    if (internal::BlockPreconditionedSaddlePointSolver<Vector, Matrix>::available) {
+      ret.push_back("minres.blockdiagonal");
+      ret.push_back("gmres.blocktriangular");
+    }
     return ret;
   } // ... types()
 
@@ -68,12 +226,32 @@ public:
     Common::Configuration general_opts({"type", "post_check_solves_system", "verbose"}, {tp.c_str(), "1e-5", "0"});
     Common::Configuration iterative_options({"max_iter", "precision"}, {"10000", "1e-10"});
     iterative_options += general_opts;
-    if (tp == "direct")
+    if (tp == "direct") {
       return general_opts;
-    else if (tp == "cg_direct_schurcomplement" || tp == "cg_cg_schurcomplement")
+    } else if (tp == "cg_direct_schurcomplement" || tp == "cg_cg_schurcomplement") {
+      return iterative_options;
+    } else if (tp == "minres.blockdiagonal" || tp == "gmres.blocktriangular") {
+      iterative_options.set("schur_approximation", "simple");
+      if (tp == "gmres.blocktriangular")
+        iterative_options.set("restart", "100");
+      // these are passed to both AMGs, see SaddlePointBlockPreconditioner (minres requires a symmetric smoother)
+      iterative_options.set("smoother.type", "ssor");
+      iterative_options.set("smoother.iterations", "1");
+      iterative_options.set("smoother.relaxation_factor", "1");
+      iterative_options.set("preconditioner.max_level", "100");
+      iterative_options.set("preconditioner.coarse_target", "1000");
+      iterative_options.set("preconditioner.min_coarse_rate", "1.2");
+      iterative_options.set("preconditioner.prolong_damp", "1.6");
+      iterative_options.set("preconditioner.anisotropy_dim", "2"); // <- this should be the dimDomain of the problem!
+      iterative_options.set("preconditioner.isotropy_dim", "2"); // <- this as well
+      iterative_options.set("preconditioner.criterion", "unsymmetric");
+      iterative_options.set("preconditioner.min_aggregate_size", "0");
+      iterative_options.set("preconditioner.max_aggregate_size", "0");
+      iterative_options.set("preconditioner.verbose", "0");
       return iterative_options;
-    else
+    } else {
       return general_opts;
+    }
   } // ... options(...)
 
   void apply(const Vector& f, const Vector& g, Vector& u, Vector& p) const
@@ -95,6 +273,9 @@ public:
   void apply(const Vector& f, const Vector& g, Vector& u, Vector& p, const Common::Configuration& opts) const
   {
     const auto type = opts.get<std::string>("type");
+    internal::SolverUtils::check_given(type, types());
+    statistics_.reset(type);
+    Dune::Timer timer;
     if (type == "direct") {
       // copy matrices to saddle point system matrix
       // create pattern first
@@ -140,10 +321,15 @@ public:
         system_vector[m + ii] = g[ii];
 
       // solve the system by a direct solver
+      const double assembly_time = timer.elapsed();
+      const auto solver = make_solver(system_matrix);
       if (opts.has_sub("inner_solver"))
-        XT::LA::solve(system_matrix, system_vector, solution_vector, opts.sub("inner_solver"));
+        solver.apply(system_vector, solution_vector, opts.sub("inner_solver"));
       else
-        XT::LA::solve(system_matrix, system_vector, solution_vector);
+        solver.apply(system_vector, solution_vector);
+      statistics_ = solver.statistics();
+      statistics_.type = type;
+      statistics_.setup_time += assembly_time;
 
       // copy to result vectors
       for (size_t ii = 0; ii < m; ++ii)
@@ -151,40 +337,90 @@ public:
       for (size_t ii = 0; ii < n; ++ii)
         p[ii] = solution_vector[m + ii];
     } else if (type == "cg_direct_schurcomplement" || type == "cg_cg_schurcomplement") {
+      using SchurComplementOperatorType = SchurComplementOperator<Vector, Matrix, CommunicatorType>;
+      using Traits = internal::SchurComplementTraits<Vector, CommunicatorType>;
+      const auto default_opts = options(type);
       // calculate rhs B2^T A^{-1} f - g
       auto Ainv_f = f;
       auto rhs_p = g;
-      SchurComplementOperator<Vector, Matrix, CommunicatorType> schur_complement_op(
+      SchurComplementOperatorType schur_complement_op(
           A_,
           B1_,
           B2_,
           C_,
+          velocity_communicator_.access(),
+          pressure_communicator_.access(),
           opts.has_sub("inner_solver") ? opts.sub("inner_solver")
                                        : XT::LA::SolverOptions<Matrix, CommunicatorType>::options(
                                              type == "cg_direct_schurcomplement" ? "" : "cg"));
-      schur_complement_op.A_inv().apply(f, Ainv_f);
+      schur_complement_op.A_inv().apply(f, Ainv_f, schur_complement_op.A_inv_options());
+      Traits::make_consistent(velocity_communicator_.access(), Ainv_f);
       B2_.mtv(Ainv_f, rhs_p);
       rhs_p -= g;
+      Traits::make_consistent(pressure_communicator_.access(), rhs_p);
+      auto scalar_product = schur_complement_op.make_scalar_product();
+      // the initial residual of the Schur complement system is only available for free for a zero initial guess (the
+      // norm is computed anyway, since all ranks have to take part)
+      const auto rhs_p_norm = scalar_product.norm(rhs_p);
+      if (!(p.sup_norm() > 0))
+        statistics_.initial_residual = rhs_p_norm;
+      statistics_.setup_time = timer.elapsed();
+      timer.reset();
 
       // Solve S p = rhs
-      IdentityPreconditioner<SchurComplementOperator<Vector, Matrix, CommunicatorType>> prec(
-          SolverCategory::Category::sequential);
-      Dune::CGSolver<Vector> outer_solver(schur_complement_op, prec, 1e-10, 10000, 0, false);
+      IdentityPreconditioner<SchurComplementOperatorType> prec(schur_complement_op.category());
+      Dune::CGSolver<Vector> outer_solver(schur_complement_op,
+                                          scalar_product,
+                                          prec,
+                                          opts.get("precision", default_opts.get<double>("precision")),
+                                          opts.get("max_iter", default_opts.get<int>("max_iter")),
+                                          0,
+                                          false);
       InverseOperatorResult res;
       outer_solver.apply(p, rhs_p, res);
+      statistics_.iterations = res.iterations;
+      statistics_.convergence_rate = res.conv_rate;
+      statistics_.final_residual = res.reduction * statistics_.initial_residual;
 
       // Now solve u = A^{-1}(f - B1 p)
       auto rhs_u = f;
       rhs_u -= B1_ * p;
-      schur_complement_op.A_inv().apply(rhs_u, u);
+      Traits::make_consistent(velocity_communicator_.access(), rhs_u);
+      schur_complement_op.A_inv().apply(rhs_u, u, schur_complement_op.A_inv_options());
+      Traits::make_consistent(velocity_communicator_.access(), u);
+      statistics_.solve_time = timer.elapsed();
+    } else if (type == "minres.blockdiagonal" || type == "gmres.blocktriangular") {
+      const auto default_opts = options(type);
+      const auto result = internal::BlockPreconditionedSaddlePointSolver<Vector, Matrix>::apply(
+          A_, B1_, B2_, C_, pressure_mass_matrix_, f, g, u, p, opts, default_opts, statistics_);
+      if (!result.converged)
+        DUNE_THROW(Exceptions::linear_solver_failed_bc_it_did_not_converge,
+                   "The dune-istl backend reported 'InverseOperatorResult.converged == false'!\n"
+                       << "Those were the given options:\n\n"
+                       << opts);
     }
   } // ... apply(...)
 
+  /**
+   * \brief Information about the last call to apply().
+   *
+   * For the Schur complement types, iterations and residuals refer to the outer CG for the pressure p, the times
+   * include all inner solves.
+   */
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
 private:
   const Matrix& A_;
   const Matrix& B1_;
   const Matrix& B2_;
   const Matrix& C_;
+  const Matrix* pressure_mass_matrix_;
+  const Common::ConstStorageProvider<CommunicatorType> velocity_communicator_;
+  const Common::ConstStorageProvider<CommunicatorType> pressure_communicator_;
+  mutable SolverStatistics statistics_;
 };
 
 
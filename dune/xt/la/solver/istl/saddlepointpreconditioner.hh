@@ -0,0 +1,301 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_SOLVER_ISTL_SADDLEPOINTPRECONDITIONER_HH
+#define DUNE_XT_LA_SOLVER_ISTL_SADDLEPOINTPRECONDITIONER_HH
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include <dune/istl/operators.hh>
+#include <dune/istl/paamg/amg.hh>
+#include <dune/istl/preconditioner.hh>
+#include <dune/istl/preconditioners.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/configuration.hh>
+#include <dune/xt/la/container/istl.hh>
+#include <dune/xt/la/container/pattern.hh>
+
+#include "amg.hh"
+
+namespace Dune {
+namespace XT {
+namespace LA {
+namespace internal {
+
+
+// y[y_offset + ii] += alpha * sum_jj M_ii,jj x[x_offset + jj] for all rows ii of M
+template <class IstlMatrixType, class IstlVectorType, class F>
+void block_usmv(const F& alpha,
+                const IstlMatrixType& matrix,
+                const IstlVectorType& x,
+                const size_t x_offset,
+                IstlVectorType& y,
+                const size_t y_offset)
+{
+  for (auto row_it = matrix.begin(); row_it != matrix.end(); ++row_it) {
+    F sum(0);
+    for (auto it = row_it->begin(); it != row_it->end(); ++it)
+      sum += (*it)[0][0] * x[x_offset + it.index()][0];
+    y[y_offset + row_it.index()][0] += alpha * sum;
+  }
+} // ... block_usmv(...)
+
+
+// y[y_offset + jj] += alpha * sum_ii M_ii,jj x[x_offset + ii] for all columns jj of M
+template <class IstlMatrixType, class IstlVectorType, class F>
+void block_usmtv(const F& alpha,
+                 const IstlMatrixType& matrix,
+                 const IstlVectorType& x,
+                 const size_t x_offset,
+                 IstlVectorType& y,
+                 const size_t y_offset)
+{
+  for (auto row_it = matrix.begin(); row_it != matrix.end(); ++row_it) {
+    const F x_ii = alpha * x[x_offset + row_it.index()][0];
+    for (auto it = row_it->begin(); it != row_it->end(); ++it)
+      y[y_offset + it.index()][0] += (*it)[0][0] * x_ii;
+  }
+} // ... block_usmtv(...)
+
+
+/**
+ * \brief Assembles the SIMPLE approximation B2^T diag(A)^{-1} B1 - C of the Schur complement B2^T A^{-1} B1 - C.
+ */
+template <class S>
+IstlRowMajorSparseMatrix<S> simple_schur_complement_approximation(const IstlRowMajorSparseMatrix<S>& A,
+                                                                  const IstlRowMajorSparseMatrix<S>& B1,
+                                                                  const IstlRowMajorSparseMatrix<S>& B2,
+                                                                  const IstlRowMajorSparseMatrix<S>& C)
+{
+  const size_t m = A.rows();
+  const size_t n = C.rows();
+  const auto& A_backend = A.backend();
+  const auto& B1_backend = B1.backend();
+  const auto& B2_backend = B2.backend();
+  const auto& C_backend = C.backend();
+  std::vector<S> inverse_diagonal(m);
+  for (size_t ii = 0; ii < m; ++ii) {
+    const auto diag_it = A_backend[ii].find(ii);
+    if (diag_it == A_backend[ii].end() || !(std::abs((*diag_it)[0][0]) > 0))
+      DUNE_THROW(Common::Exceptions::wrong_input_given,
+                 "The SIMPLE approximation of the Schur complement requires a nonzero diagonal of A (row " << ii
+                                                                                                           << ")!");
+    inverse_diagonal[ii] = S(1) / (*diag_it)[0][0];
+  }
+  // the entry (jj, kk) gets a contribution from every row ii of A with B2_ii,jj != 0 and B1_ii,kk != 0
+  SparsityPatternDefault pattern(n);
+  for (size_t ii = 0; ii < m; ++ii)
+    for (auto it2 = B2_backend[ii].begin(); it2 != B2_backend[ii].end(); ++it2)
+      for (auto it1 = B1_backend[ii].begin(); it1 != B1_backend[ii].end(); ++it1)
+        pattern.insert(it2.index(), it1.index());
+  for (size_t jj = 0; jj < n; ++jj)
+    for (auto it = C_backend[jj].begin(); it != C_backend[jj].end(); ++it)
+      pattern.insert(jj, it.index());
+  pattern.sort();
+  IstlRowMajorSparseMatrix<S> ret(n, n, pattern);
+  for (size_t ii = 0; ii < m; ++ii)
+    for (auto it2 = B2_backend[ii].begin(); it2 != B2_backend[ii].end(); ++it2) {
+      const S B2_ii_jj_times_inv_diag = (*it2)[0][0] * inverse_diagonal[ii];
+      for (auto it1 = B1_backend[ii].begin(); it1 != B1_backend[ii].end(); ++it1)
+        ret.add_to_entry(it2.index(), it1.index(), B2_ii_jj_times_inv_diag * (*it1)[0][0]);
+    }
+  for (size_t jj = 0; jj < n; ++jj)
+    for (auto it = C_backend[jj].begin(); it != C_backend[jj].end(); ++it)
+      ret.add_to_entry(jj, it.index(), -(*it)[0][0]);
+  return ret;
+} // ... simple_schur_complement_approximation(...)
+
+
+} // namespace internal
+
+
+/**
+ * \brief The saddle point matrix (A B1; B2^T C) as a linear operator on vectors (u; p) of length m + n, the blocks are
+ *        applied separately (the system matrix is not assembled).
+ */
+template <class S>
+class SaddlePointOperator
+  : public Dune::LinearOperator<typename IstlDenseVector<S>::BackendType, typename IstlDenseVector<S>::BackendType>
+{
+  using MatrixType = IstlRowMajorSparseMatrix<S>;
+
+public:
+  using VectorType = typename IstlDenseVector<S>::BackendType;
+  using field_type = S;
+
+  // A: m x m, B1, B2: m x n, C: n x n
+  SaddlePointOperator(const MatrixType& A, const MatrixType& B1, const MatrixType& B2, const MatrixType& C)
+    : A_(A.backend())
+    , B1_(B1.backend())
+    , B2_(B2.backend())
+    , C_(C.backend())
+    , m_(A.rows())
+  {}
+
+  virtual void apply(const VectorType& x, VectorType& y) const override final
+  {
+    y = S(0);
+    applyscaleadd(S(1), x, y);
+  }
+
+  virtual void applyscaleadd(field_type alpha, const VectorType& x, VectorType& y) const override final
+  {
+    internal::block_usmv(alpha, A_, x, 0, y, 0);
+    internal::block_usmv(alpha, B1_, x, m_, y, 0);
+    internal::block_usmtv(alpha, B2_, x, 0, y, m_);
+    internal::block_usmv(alpha, C_, x, m_, y, m_);
+  }
+
+  virtual SolverCategory::Category category() const override final
+  {
+    return SolverCategory::Category::sequential;
+  }
+
+private:
+  const typename MatrixType::BackendType& A_;
+  const typename MatrixType::BackendType& B1_;
+  const typename MatrixType::BackendType& B2_;
+  const typename MatrixType::BackendType& C_;
+  const size_t m_;
+}; // class SaddlePointOperator
+
+
+/**
+ * \brief Block preconditioner for the saddle point matrix (A B1; B2^T C), using one AMG cycle for A and one AMG cycle
+ *        for a given approximation S_hat of the Schur complement S = B2^T A^{-1} B1 - C.
+ *
+ * If triangular is false, the preconditioner is diag(A, S_hat), which is symmetric positive definite (as required by
+ * MINRES) if A and S_hat are. Otherwise, the preconditioner is the block upper triangular (A B1; 0 -S_hat), which
+ * yields convergence of GMRES in two iterations for exact blocks.
+ * Typical choices for S_hat are the (viscosity scaled) pressure mass matrix for Stokes or the SIMPLE approximation
+ * B2^T diag(A)^{-1} B1 - C, see internal::simple_schur_complement_approximation.
+ *
+ * \note Uses the options of the ISTL AMG (see Solver<IstlRowMajorSparseMatrix<S>>::options("amg.cg")), including
+ *       'smoother.type' and 'preconditioner.criterion'. For MINRES, the smoother has to be symmetric.
+ * \sa   Elman, Silvester, Wathen, Finite elements and fast iterative solvers, Oxford University Press (2014)
+ */
+template <class S>
+class SaddlePointBlockPreconditioner
+  : public Dune::Preconditioner<typename IstlDenseVector<S>::BackendType, typename IstlDenseVector<S>::BackendType>
+{
+  using MatrixType = IstlRowMajorSparseMatrix<S>;
+  using R = typename MatrixType::RealType;
+  using IstlMatrixType = typename MatrixType::BackendType;
+  using IstlVectorType = typename IstlDenseVector<S>::BackendType;
+  using MatrixOperatorType = MatrixAdapter<IstlMatrixType, IstlVectorType, IstlVectorType>;
+  // the type of the AMG depends on the smoother, which is chosen at runtime
+  using AmgType = Dune::Preconditioner<IstlVectorType, IstlVectorType>;
+
+public:
+  using domain_type = IstlVectorType;
+  using range_type = IstlVectorType;
+  using field_type = S;
+
+  SaddlePointBlockPreconditioner(const MatrixType& A,
+                                 const MatrixType& B1,
+                                 const MatrixType& S_hat,
+                                 const bool triangular,
+                                 const Common::Configuration& opts,
+                                 const Common::Configuration& default_opts)
+    : B1_(B1.backend())
+    , triangular_(triangular)
+    , A_op_(A.backend())
+    , S_hat_op_(S_hat.backend())
+    , A_amg_(make_amg(A_op_, opts, default_opts))
+    , S_hat_amg_(make_amg(S_hat_op_, opts, default_opts))
+    , u_in_(A.rows())
+    , u_out_(A.rows())
+    , p_in_(S_hat.rows())
+    , p_out_(S_hat.rows())
+  {}
+
+  virtual void pre(domain_type& /*x*/, range_type& /*b*/) override final
+  {
+    // the AMGs only need pre() to set up their smoothers/coarse solvers, the vectors are not modified
+    u_out_ = S(0);
+    u_in_ = S(0);
+    A_amg_->pre(u_out_, u_in_);
+    p_out_ = S(0);
+    p_in_ = S(0);
+    S_hat_amg_->pre(p_out_, p_in_);
+  }
+
+  virtual void apply(domain_type& v, const range_type& d) override final
+  {
+    const size_t m = u_in_.size();
+    const size_t n = p_in_.size();
+    for (size_t ii = 0; ii < n; ++ii)
+      p_in_[ii] = d[m + ii];
+    p_out_ = S(0);
+    S_hat_amg_->apply(p_out_, p_in_);
+    for (size_t ii = 0; ii < m; ++ii)
+      u_in_[ii] = d[ii];
+    if (triangular_) {
+      // v_p = -S_hat^{-1} d_p, v_u = A^{-1} (d_u - B1 v_p)
+      p_out_ *= S(-1);
+      B1_.usmv(S(-1), p_out_, u_in_);
+    }
+    u_out_ = S(0);
+    A_amg_->apply(u_out_, u_in_);
+    for (size_t ii = 0; ii < m; ++ii)
+      v[ii] = u_out_[ii];
+    for (size_t ii = 0; ii < n; ++ii)
+      v[m + ii] = p_out_[ii];
+  } // ... apply(...)
+
+  virtual void post(domain_type& /*x*/) override final
+  {
+    A_amg_->post(u_out_);
+    S_hat_amg_->post(p_out_);
+  }
+
+  virtual SolverCategory::Category category() const override final
+  {
+    return SolverCategory::Category::sequential;
+  }
+
+private:
+  static std::unique_ptr<AmgType> make_amg(MatrixOperatorType& matrix_operator,
+                                           const Common::Configuration& opts,
+                                           const Common::Configuration& default_opts)
+  {
+    const auto amg_parameters = internal::make_amg_parameters<R>(opts, default_opts);
+    const auto smoother_type = opts.get("smoother.type", default_opts.get("smoother.type", std::string("ssor")));
+    return internal::with_amg_smoother<IstlMatrixType, IstlVectorType>(
+        smoother_type, [&](auto smoother_tag) -> std::unique_ptr<AmgType> {
+          typedef typename decltype(smoother_tag)::type SmootherType;
+          const auto smoother_parameters =
+              internal::make_amg_smoother_parameters<SmootherType, S>(smoother_type, opts, default_opts);
+          return internal::with_amg_criterion<IstlMatrixType>(
+              amg_parameters, opts, default_opts, [&](const auto& amg_criterion) -> std::unique_ptr<AmgType> {
+                return std::make_unique<Amg::AMG<MatrixOperatorType, IstlVectorType, SmootherType>>(
+                    matrix_operator, amg_criterion, smoother_parameters);
+              });
+        });
+  } // ... make_amg(...)
+
+  const IstlMatrixType& B1_;
+  const bool triangular_;
+  MatrixOperatorType A_op_;
+  MatrixOperatorType S_hat_op_;
+  std::unique_ptr<AmgType> A_amg_;
+  std::unique_ptr<AmgType> S_hat_amg_;
+  IstlVectorType u_in_;
+  IstlVectorType u_out_;
+  IstlVectorType p_in_;
+  IstlVectorType p_out_;
+}; // class SaddlePointBlockPreconditioner
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_SOLVER_ISTL_SADDLEPOINTPRECONDITIONER_HH
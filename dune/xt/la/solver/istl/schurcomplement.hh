@@ -10,26 +10,115 @@
 #ifndef DUNE_XT_LA_SOLVER_ISTL_SCHURCOMPLEMENT_HH
 #define DUNE_XT_LA_SOLVER_ISTL_SCHURCOMPLEMENT_HH
 
+#include <type_traits>
+
 #include <dune/istl/operators.hh>
+#include <dune/istl/scalarproducts.hh>
 #include <dune/istl/solvers.hh>
 
 #include <dune/xt/common/exceptions.hh>
 #include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/memory.hh>
 #include <dune/xt/la/container/istl.hh>
 #include <dune/xt/la/solver.hh>
 
 namespace Dune {
 namespace XT {
 namespace LA {
+namespace internal {
+
+
+/**
+ * \brief Scalar product for vectors of our (ISTL) containers on an overlapping domain decomposition, only the owned
+ *        entries are taken into account on each rank (see OverlappingSchwarzScalarProduct).
+ */
+template <class VectorType, class CommunicatorType>
+class OverlappingContainerScalarProduct : public Dune::ScalarProduct<VectorType>
+{
+  using BaseType = Dune::ScalarProduct<VectorType>;
+
+public:
+  using typename BaseType::field_type;
+  using typename BaseType::real_type;
+
+  OverlappingContainerScalarProduct(const CommunicatorType& communicator)
+    : communicator_(communicator)
+  {}
+
+  virtual field_type dot(const VectorType& x, const VectorType& y) const override final
+  {
+    field_type result(0);
+    communicator_.dot(x.backend(), y.backend(), result);
+    return result;
+  }
+
+  virtual real_type norm(const VectorType& x) const override final
+  {
+    return communicator_.norm(x.backend());
+  }
+
+  virtual SolverCategory::Category category() const override final
+  {
+    return SolverCategory::Category::overlapping;
+  }
+
+private:
+  const CommunicatorType& communicator_;
+}; // class OverlappingContainerScalarProduct
+
+
+template <class VectorType, class CommunicatorType>
+struct SchurComplementTraits
+{
+  using ScalarProductType = OverlappingContainerScalarProduct<VectorType, CommunicatorType>;
+  static constexpr SolverCategory::Category category = SolverCategory::Category::overlapping;
+
+  static ScalarProductType make_scalar_product(const CommunicatorType& communicator)
+  {
+    return ScalarProductType(communicator);
+  }
+
+  // the local products are correct for the owned entries, the others are taken from their owners
+  static void make_consistent(const CommunicatorType& communicator, VectorType& vec)
+  {
+    communicator.copyOwnerToAll(vec.backend(), vec.backend());
+  }
+};
+
+
+template <class VectorType>
+struct SchurComplementTraits<VectorType, SequentialCommunication>
+{
+  using ScalarProductType = SeqScalarProduct<VectorType>;
+  static constexpr SolverCategory::Category category = SolverCategory::Category::sequential;
+
+  static ScalarProductType make_scalar_product(const SequentialCommunication& /*communicator*/)
+  {
+    return ScalarProductType();
+  }
+
+  static void make_consistent(const SequentialCommunication& /*communicator*/, VectorType& /*vec*/) {}
+};
+
+
+} // namespace internal
 
 
 // For a saddle point matrix (A B1; B2^T C) this models the Schur complement (B2^T A^{-1} B1 - C)
+// In parallel, an overlapping decomposition is expected (as for the dune-istl OverlappingSchwarzOperator), i.e. the
+// local rows of A, B1, B2^T and C belonging to owned DoFs are complete. The velocity and pressure DoFs (rows of A and
+// C) have their own communicators, x is expected to be consistent and the result is made consistent.
+// Unless 'reuse_setup' is given in solver_opts, the setup of the solver for A (the factorization of the direct types,
+// the preconditioner or the AMG hierarchy of the iterative ones) is computed once and reused in every application of
+// the operator (see the 'reuse_setup' option of the solvers), so A must not change during the lifetime of this
+// operator.
 template <class VectorType = IstlDenseVector<double>,
           class MatrixType = IstlRowMajorSparseMatrix<double>,
           class CommunicatorType = SequentialCommunication>
 class SchurComplementOperator : public Dune::LinearOperator<VectorType, VectorType>
 {
   using BaseType = Dune::LinearOperator<VectorType, VectorType>;
+  using Traits = internal::SchurComplementTraits<VectorType, CommunicatorType>;
 
 public:
   using Vector = VectorType;
@@ -43,13 +132,36 @@ public:
                           const Matrix& _B1,
                           const Matrix& _B2,
                           const Matrix& _C,
-                          const Common::Configuration& solver_opts = SolverOptions<Matrix>::options())
-    : A_(_A)
-    , A_inv_(make_solver(A_))
+                          const Common::Configuration& solver_opts = SolverOptions<Matrix, CommunicatorType>::options())
+    : velocity_communicator_(new CommunicatorType())
+    , pressure_communicator_(new CommunicatorType())
+    , A_(_A)
+    , A_inv_(A_, velocity_communicator_.access())
+    , B1_(_B1)
+    , B2_(_B2)
+    , C_(_C)
+    , solver_opts_(inner_solver_options(solver_opts))
+    , m_vec_1_(_A.rows())
+    , m_vec_2_(_A.rows())
+    , n_vec_1_(_C.rows())
+    , n_vec_2_(_C.rows())
+  {}
+
+  SchurComplementOperator(const Matrix& _A,
+                          const Matrix& _B1,
+                          const Matrix& _B2,
+                          const Matrix& _C,
+                          const CommunicatorType& velocity_communicator,
+                          const CommunicatorType& pressure_communicator,
+                          const Common::Configuration& solver_opts = SolverOptions<Matrix, CommunicatorType>::options())
+    : velocity_communicator_(velocity_communicator)
+    , pressure_communicator_(pressure_communicator)
+    , A_(_A)
+    , A_inv_(A_, velocity_communicator_.access())
     , B1_(_B1)
     , B2_(_B2)
     , C_(_C)
-    , solver_opts_(solver_opts)
+    , solver_opts_(inner_solver_options(solver_opts))
     , m_vec_1_(_A.rows())
     , m_vec_2_(_A.rows())
     , n_vec_1_(_C.rows())
@@ -57,8 +169,10 @@ public:
   {}
 
   SchurComplementOperator(const SchurComplementOperator& other)
-    : A_(other.A_)
-    , A_inv_(make_solver(A_))
+    : velocity_communicator_(other.velocity_communicator_.access())
+    , pressure_communicator_(other.pressure_communicator_.access())
+    , A_(other.A_)
+    , A_inv_(A_, velocity_communicator_.access())
     , B1_(other.B1_)
     , B2_(other.B2_)
     , C_(other.C_)
@@ -79,15 +193,18 @@ public:
     // calculate B1 x
     auto& B1x = m_vec_1_;
     B1_.mv(x, B1x);
+    Traits::make_consistent(velocity_communicator_.access(), B1x);
     // calculate A^{-1} B1 x
     auto& AinvB1x = m_vec_2_;
     A_inv_.apply(B1x, AinvB1x, solver_opts_);
+    Traits::make_consistent(velocity_communicator_.access(), AinvB1x);
     // apply B2^T
     B2_.mtv(AinvB1x, y);
     // calculate Cx
     auto& Cx = n_vec_1_;
     C_.mv(x, Cx);
     y -= Cx;
+    Traits::make_consistent(pressure_communicator_.access(), y);
   }
 
   virtual void applyscaleadd(Field alpha, const Vector& x, Vector& y) const override final
@@ -101,7 +218,23 @@ public:
   //! Category of the linear operator (see SolverCategory::Category)
   virtual SolverCategory::Category category() const override final
   {
-    return SolverCategory::Category::sequential;
+    return Traits::category;
+  }
+
+  //! The scalar product for pressure vectors matching category()
+  typename Traits::ScalarProductType make_scalar_product() const
+  {
+    return Traits::make_scalar_product(pressure_communicator_.access());
+  }
+
+  const CommunicatorType& velocity_communicator() const
+  {
+    return velocity_communicator_.access();
+  }
+
+  const CommunicatorType& pressure_communicator() const
+  {
+    return pressure_communicator_.access();
   }
 
   const SolverType& A_inv() const
@@ -109,6 +242,12 @@ public:
     return A_inv_;
   }
 
+  //! The options used for A_inv(), pass these to A_inv().apply() to benefit from the reused factorization
+  const Common::Configuration& A_inv_options() const
+  {
+    return solver_opts_;
+  }
+
   const Matrix& A() const
   {
     return A_;
@@ -130,6 +269,16 @@ public:
   }
 
 private:
+  static Common::Configuration inner_solver_options(const Common::Configuration& solver_opts)
+  {
+    Common::Configuration ret = solver_opts;
+    if (!ret.has_key("reuse_setup"))
+      ret["reuse_setup"] = "-1";
+    return ret;
+  }
+
+  const Common::ConstStorageProvider<CommunicatorType> velocity_communicator_;
+  const Common::ConstStorageProvider<CommunicatorType> pressure_communicator_;
   const Matrix& A_;
   const SolverType A_inv_;
   const Matrix& B1_;
@@ -0,0 +1,352 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_SOLVER_LOW_RANK_UPDATE_HH
+#define DUNE_XT_LA_SOLVER_LOW_RANK_UPDATE_HH
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <dune/common/dynmatrix.hh>
+#include <dune/common/timer.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/math.hh>
+
+#include <dune/xt/la/algorithms/lu.hh>
+#include <dune/xt/la/exceptions.hh>
+
+#include "../solver.hh"
+
+namespace Dune {
+namespace XT {
+namespace LA {
+
+
+/**
+ * \brief Represents A + U V^T, where A is a matrix of type MatrixImp and U = [u_0, ..., u_{k-1}] and
+ *        V = [v_0, ..., v_{k-1}] are given by k vectors each, such that Solver<LowRankUpdatedMatrix<...>> can solve
+ *        with it by reusing a factorization of A (see there).
+ *
+ * U and V can be changed by set_update() (e.g., in each step of a continuation method) without invalidating the
+ * factorization of A. For complex vectors, V^T has to be read as V^H (since V[jj].dot(x) conjugates V[jj]).
+ * \note The matrix A is stored as a reference and has to outlive this object.
+ */
+template <class MatrixImp, class VectorImp>
+class LowRankUpdatedMatrix
+{
+  using ThisType = LowRankUpdatedMatrix;
+
+public:
+  using MatrixType = MatrixImp;
+  using VectorType = VectorImp;
+  using ScalarType = typename VectorType::ScalarType;
+  using RealType = typename VectorType::RealType;
+
+  explicit LowRankUpdatedMatrix(const MatrixType& matrix)
+    : matrix_(matrix)
+    , revision_(0)
+  {}
+
+  LowRankUpdatedMatrix(const MatrixType& matrix, std::vector<VectorType> U, std::vector<VectorType> V)
+    : LowRankUpdatedMatrix(matrix)
+  {
+    set_update(std::move(U), std::move(V));
+  }
+
+  size_t rows() const
+  {
+    return matrix_.rows();
+  }
+
+  size_t cols() const
+  {
+    return matrix_.cols();
+  }
+
+  //! The number k of columns of U and V.
+  size_t rank() const
+  {
+    return U_.size();
+  }
+
+  const MatrixType& matrix() const
+  {
+    return matrix_;
+  }
+
+  const std::vector<VectorType>& U() const
+  {
+    return U_;
+  }
+
+  const std::vector<VectorType>& V() const
+  {
+    return V_;
+  }
+
+  ThisType& set_update(std::vector<VectorType> U, std::vector<VectorType> V)
+  {
+    if (U.size() != V.size())
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "U and V need the same number of columns!\n   U.size() = " << U.size() << "\n   V.size() = "
+                                                                          << V.size());
+    for (size_t jj = 0; jj < U.size(); ++jj)
+      if (U[jj].size() != rows() || V[jj].size() != cols())
+        DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                   "Column " << jj << " of U (V) has to have as many entries as the matrix has rows (columns)!\n"
+                             << "   U[" << jj << "].size() = " << U[jj].size() << "\n   V[" << jj
+                             << "].size() = " << V[jj].size() << "\n   rows() = " << rows()
+                             << "\n   cols() = " << cols());
+    U_ = std::move(U);
+    V_ = std::move(V);
+    ++revision_;
+    return *this;
+  } // ... set_update(...)
+
+  ThisType& clear_update()
+  {
+    return set_update({}, {});
+  }
+
+  /// \brief Computes y = (A + U V^T) x.
+  void mv(const VectorType& x, VectorType& y) const
+  {
+    matrix_.mv(x, y);
+    for (size_t jj = 0; jj < U_.size(); ++jj)
+      y.axpy(V_[jj].dot(x), U_[jj]);
+  }
+
+  //! Incremented by each call to set_update(), allows to detect changes of U and V.
+  size_t revision() const
+  {
+    return revision_;
+  }
+
+private:
+  const MatrixType& matrix_;
+  std::vector<VectorType> U_;
+  std::vector<VectorType> V_;
+  size_t revision_;
+}; // class LowRankUpdatedMatrix
+
+
+template <class MatrixImp, class VectorImp, class CommunicatorType>
+class SolverOptions<LowRankUpdatedMatrix<MatrixImp, VectorImp>, CommunicatorType> : protected internal::SolverUtils
+{
+  using InnerSolverType = Solver<MatrixImp, CommunicatorType>;
+
+public:
+  //! The types of Solver<MatrixImp>, those which support the option 'reuse_setup' (i.e., keep their factorization,
+  //! preconditioner or AMG hierarchy between solves) first.
+  static std::vector<std::string> types()
+  {
+    auto ret = InnerSolverType::types();
+    std::stable_partition(ret.begin(), ret.end(), [](const std::string& tp) {
+      return InnerSolverType::options(tp).has_key("reuse_setup");
+    });
+    return ret;
+  }
+
+  //! The options of Solver<MatrixImp>, with unlimited reuse of the setup by default.
+  static Common::Configuration options(const std::string type = "")
+  {
+    const std::string tp = !type.empty() ? type : types()[0];
+    internal::SolverUtils::check_given(tp, types());
+    auto opts = InnerSolverType::options(tp);
+    if (opts.has_key("reuse_setup"))
+      opts["reuse_setup"] = "-1";
+    return opts;
+  }
+}; // class SolverOptions<LowRankUpdatedMatrix<...>>
+
+
+/**
+ * \brief Solves (A + U V^T) x = b by the Sherman-Morrison-Woodbury formula
+ *        x = y - Z (I + V^T Z)^{-1} V^T y, where y = A^{-1} b and Z = A^{-1} U.
+ *
+ * The solves with A are carried out by a Solver<MatrixImp> of the given type, which keeps its factorization,
+ * preconditioner or AMG hierarchy if it supports the option 'reuse_setup' (which defaults to -1 here, other types set
+ * up again for every solve). Z and the LU factorization of the k x k capacitance matrix I + V^T Z are computed once
+ * for each U and V and each set of options (i.e., k solves with A), so each call to apply() with the same options
+ * costs a single solve with A plus O(k n) operations. The options are
+ * passed to the solver for A, but post_check_solves_system is only applied to the final solution (in post_check_mode
+ * "full"). The reported iterations are those of all solves with A during the call, including the k solves for Z.
+ * \note Call clear_setup() if the entries of A change.
+ */
+template <class MatrixImp, class VectorImp, class CommunicatorType>
+class Solver<LowRankUpdatedMatrix<MatrixImp, VectorImp>, CommunicatorType> : protected internal::SolverUtils
+{
+public:
+  typedef LowRankUpdatedMatrix<MatrixImp, VectorImp> MatrixType;
+  typedef VectorImp VectorType;
+  typedef typename VectorType::ScalarType S;
+  typedef typename VectorType::RealType R;
+
+  Solver(const MatrixType& matrix)
+    : matrix_(matrix)
+    , inner_solver_(matrix.matrix())
+    , revision_(std::numeric_limits<size_t>::max())
+  {}
+
+  Solver(const MatrixType& matrix, const CommunicatorType& communicator)
+    : matrix_(matrix)
+    , inner_solver_(matrix.matrix(), communicator)
+    , revision_(std::numeric_limits<size_t>::max())
+  {}
+
+  static std::vector<std::string> types()
+  {
+    return SolverOptions<MatrixType, CommunicatorType>::types();
+  }
+
+  static Common::Configuration options(const std::string type = "")
+  {
+    return SolverOptions<MatrixType, CommunicatorType>::options(type);
+  }
+
+  void apply(const VectorType& rhs, VectorType& solution) const
+  {
+    apply(rhs, solution, types()[0]);
+  }
+
+  void apply(const VectorType& rhs, VectorType& solution, const std::string& type) const
+  {
+    apply(rhs, solution, options(type));
+  }
+
+  void apply(const VectorType& rhs, VectorType& solution, const Common::Configuration& opts) const
+  {
+    if (!opts.has_key("type"))
+      DUNE_THROW(Common::Exceptions::configuration_error,
+                 "Given options (see below) need to have at least the key 'type' set!\n\n"
+                     << opts);
+    const auto type = opts.get<std::string>("type");
+    internal::SolverUtils::check_given(type, types());
+    const Common::Configuration default_opts = options(type);
+    if (rhs.size() != matrix_.rows() || solution.size() != matrix_.cols())
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "matrix.rows() = " << matrix_.rows() << "\n   rhs.size() = " << rhs.size()
+                                    << "\n   solution.size() = " << solution.size());
+    Common::Configuration inner_opts = opts;
+    if (!inner_opts.has_key("reuse_setup") && default_opts.has_key("reuse_setup"))
+      inner_opts["reuse_setup"] = default_opts.get<std::string>("reuse_setup");
+    // the final solution is checked below
+    inner_opts["post_check_solves_system"] = "0";
+    statistics_.reset(type);
+    statistics_.initial_residual = rhs.l2_norm();
+    Dune::Timer timer;
+    try {
+      setup(inner_opts);
+      statistics_.setup_time = timer.elapsed();
+      timer.reset();
+      inner_solver_.apply(rhs, solution, inner_opts);
+      statistics_.iterations += inner_solver_.statistics().iterations;
+      const size_t rank = Z_.size();
+      if (rank > 0) {
+        std::vector<S> coefficients(rank);
+        for (size_t jj = 0; jj < rank; ++jj)
+          coefficients[jj] = matrix_.V()[jj].dot(solution);
+        capacitance_.apply(coefficients);
+        for (size_t jj = 0; jj < rank; ++jj)
+          solution.axpy(-coefficients[jj], Z_[jj]);
+      }
+      statistics_.solve_time = timer.elapsed();
+    } catch (FMatrixError&) {
+      DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
+                 "The capacitance matrix I + V^T A^{-1} U is singular, i.e. A + U V^T is not invertible!\n"
+                     << "Those were the given options:\n\n"
+                     << opts);
+    }
+
+    // check
+    const R post_check_solves_system_threshold =
+        opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
+    if (post_check_solves_system_threshold > 0) {
+      timer.reset();
+      auto tmp = rhs.copy();
+      matrix_.mv(solution, tmp);
+      tmp -= rhs;
+      const R sup_norm = tmp.sup_norm();
+      statistics_.final_residual = tmp.l2_norm();
+      statistics_.post_check_time = timer.elapsed();
+      if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
+        DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
+                   "The computed solution does not solve the system (although the solver for A reported no "
+                       << "error) and you requested checking (see options below)!\n"
+                       << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
+                       << "\n\n"
+                       << "  ((A + U V^T) * x - b).sup_norm() = " << sup_norm << "\n\n"
+                       << "Those were the given options:\n\n"
+                       << opts);
+    }
+  } // ... apply(...)
+
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+  /// \brief Drops the setup of the solver for A and A^{-1} U, e.g. if the entries of A changed.
+  void clear_setup() const
+  {
+    inner_solver_.clear_setup();
+    Z_.clear();
+    revision_ = std::numeric_limits<size_t>::max();
+  }
+
+private:
+  // computes Z = A^{-1} U and factorizes I + V^T Z, unless this was already done for the current U and V and the same
+  // options (which may change the accuracy of Z)
+  void setup(const Common::Configuration& inner_opts) const
+  {
+    std::stringstream options_key;
+    options_key << inner_opts;
+    if (revision_ == matrix_.revision() && options_key.str() == options_key_)
+      return;
+    const auto& U = matrix_.U();
+    const auto& V = matrix_.V();
+    const size_t rank = U.size();
+    Z_.clear();
+    for (size_t jj = 0; jj < rank; ++jj) {
+      Z_.emplace_back(matrix_.cols(), 0.);
+      inner_solver_.apply(U[jj], Z_[jj], inner_opts);
+      statistics_.iterations += inner_solver_.statistics().iterations;
+    }
+    DynamicMatrix<S> capacitance(rank, rank, S(0));
+    for (size_t ii = 0; ii < rank; ++ii) {
+      for (size_t jj = 0; jj < rank; ++jj)
+        capacitance[ii][jj] = V[ii].dot(Z_[jj]);
+      capacitance[ii][ii] += S(1);
+    }
+    if (rank > 0)
+      capacitance_.factorize(capacitance);
+    revision_ = matrix_.revision();
+    options_key_ = options_key.str();
+  } // ... setup(...)
+
+  const MatrixType& matrix_;
+  const Solver<MatrixImp, CommunicatorType> inner_solver_;
+  mutable std::vector<VectorType> Z_;
+  mutable DenseLuFactorization<S> capacitance_;
+  mutable size_t revision_;
+  mutable std::string options_key_;
+  mutable SolverStatistics statistics_;
+}; // class Solver<LowRankUpdatedMatrix<...>>
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_SOLVER_LOW_RANK_UPDATE_HH
@@ -0,0 +1,453 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_LA_SOLVER_MATRIX_FREE_HH
+#define DUNE_XT_LA_SOLVER_MATRIX_FREE_HH
+
+#include <cmath>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/timer.hh>
+
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioner.hh>
+#include <dune/istl/scalarproducts.hh>
+#include <dune/istl/solvers.hh>
+
+#include <dune/xt/common/exceptions.hh>
+#include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/math.hh>
+
+#include <dune/xt/la/exceptions.hh>
+
+#include "../solver.hh"
+
+namespace Dune {
+namespace XT {
+namespace LA {
+
+
+/**
+ * \brief Wraps an operator which provides apply(x, y), i.e. y = A x, on vectors of type VectorImp, such that the
+ *        Krylov methods of dune-istl can be used via Solver<MatrixFreeOperator<...>> without assembling A.
+ *
+ * Optionally, the diagonal of A (for Jacobi preconditioning) and/or a preconditioner, i.e. a function computing an
+ * approximation z of A^{-1} r, may be given (see the option 'preconditioner' of the solver).
+ * \note The operator is stored as a reference and has to outlive this object.
+ */
+template <class OperatorImp, class VectorImp>
+class MatrixFreeOperator
+{
+  using ThisType = MatrixFreeOperator;
+
+public:
+  using OperatorType = OperatorImp;
+  using VectorType = VectorImp;
+  using ScalarType = typename VectorType::ScalarType;
+  using RealType = typename VectorType::RealType;
+  using PreconditionerType = std::function<void(const VectorType& /*residual*/, VectorType& /*correction*/)>;
+
+  MatrixFreeOperator(const OperatorType& op, const size_t sz)
+    : op_(op)
+    , size_(sz)
+    , diagonal_(0)
+    , has_diagonal_(false)
+  {}
+
+  size_t rows() const
+  {
+    return size_;
+  }
+
+  size_t cols() const
+  {
+    return size_;
+  }
+
+  /// \brief Computes y = A x.
+  void mv(const VectorType& x, VectorType& y) const
+  {
+    op_.apply(x, y);
+  }
+
+  ThisType& set_diagonal(const VectorType& diagonal)
+  {
+    if (diagonal.size() != size_)
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "diagonal.size() = " << diagonal.size() << "\n   size() = " << size_);
+    diagonal_ = diagonal;
+    has_diagonal_ = true;
+    return *this;
+  }
+
+  bool has_diagonal() const
+  {
+    return has_diagonal_;
+  }
+
+  const VectorType& diagonal() const
+  {
+    if (!has_diagonal_)
+      DUNE_THROW(Common::Exceptions::you_are_using_this_wrong, "Call set_diagonal() first!");
+    return diagonal_;
+  }
+
+  ThisType& set_preconditioner(PreconditionerType preconditioner)
+  {
+    preconditioner_ = std::move(preconditioner);
+    return *this;
+  }
+
+  bool has_preconditioner() const
+  {
+    return static_cast<bool>(preconditioner_);
+  }
+
+  const PreconditionerType& preconditioner() const
+  {
+    if (!has_preconditioner())
+      DUNE_THROW(Common::Exceptions::you_are_using_this_wrong, "Call set_preconditioner() first!");
+    return preconditioner_;
+  }
+
+private:
+  const OperatorType& op_;
+  const size_t size_;
+  VectorType diagonal_;
+  bool has_diagonal_;
+  PreconditionerType preconditioner_;
+}; // class MatrixFreeOperator
+
+
+template <class VectorType, class OperatorType>
+MatrixFreeOperator<OperatorType, VectorType> make_matrix_free_operator(const OperatorType& op, const size_t size)
+{
+  return MatrixFreeOperator<OperatorType, VectorType>(op, size);
+}
+
+
+namespace internal {
+
+
+template <class OperatorType, class VectorType>
+class MatrixFreeLinearOperatorAdapter : public Dune::LinearOperator<VectorType, VectorType>
+{
+public:
+  using field_type = typename VectorType::ScalarType;
+
+  MatrixFreeLinearOperatorAdapter(const MatrixFreeOperator<OperatorType, VectorType>& op)
+    : op_(op)
+    , tmp_(op.rows(), 0.)
+  {}
+
+  virtual void apply(const VectorType& x, VectorType& y) const override final
+  {
+    op_.mv(x, y);
+  }
+
+  virtual void applyscaleadd(field_type alpha, const VectorType& x, VectorType& y) const override final
+  {
+    op_.mv(x, tmp_);
+    y.axpy(alpha, tmp_);
+  }
+
+  virtual SolverCategory::Category category() const override final
+  {
+    return SolverCategory::Category::sequential;
+  }
+
+private:
+  const MatrixFreeOperator<OperatorType, VectorType>& op_;
+  mutable VectorType tmp_;
+}; // class MatrixFreeLinearOperatorAdapter
+
+
+template <class VectorType>
+class FunctionPreconditioner : public Dune::Preconditioner<VectorType, VectorType>
+{
+public:
+  using domain_type = VectorType;
+  using range_type = VectorType;
+  using field_type = typename VectorType::ScalarType;
+  using FunctionType = std::function<void(const VectorType&, VectorType&)>;
+
+  FunctionPreconditioner(FunctionType function)
+    : function_(std::move(function))
+  {}
+
+  virtual void pre(domain_type&, range_type&) override final {}
+
+  virtual void apply(domain_type& v, const range_type& d) override final
+  {
+    function_(d, v);
+  }
+
+  virtual void post(domain_type&) override final {}
+
+  virtual SolverCategory::Category category() const override final
+  {
+    return SolverCategory::Category::sequential;
+  }
+
+private:
+  const FunctionType function_;
+}; // class FunctionPreconditioner
+
+
+// the options do not depend on the operator, so that they can also be used by other solvers dispatching to the
+// matrix-free ones (see Solver<MatrixView<...>>)
+class MatrixFreeSolverOptions
+{
+public:
+  static std::vector<std::string> types()
+  {
+    return {"bicgstab", "cg", "gmres", "minres"};
+  }
+
+  static Common::Configuration options(const std::string type = "")
+  {
+    const std::string tp = !type.empty() ? type : types()[0];
+    SolverUtils::check_given(tp, types());
+    // 'preconditioner' is one of "auto" (the given preconditioner, Jacobi if only the diagonal is given, none
+    // otherwise), "custom", "jacobi" or "identity"
+    Common::Configuration opts({"type",
+                                "post_check_solves_system",
+                                "post_check_mode",
+                                "verbose",
+                                "max_iter",
+                                "precision",
+                                "preconditioner"},
+                               {tp.c_str(), "1e-5", "auto", "0", "10000", "1e-10", "auto"});
+    if (tp == "gmres")
+      opts.set("restart", "50");
+    return opts;
+  } // ... options(...)
+}; // class MatrixFreeSolverOptions
+
+
+} // namespace internal
+
+
+template <class OperatorImp, class VectorImp, class CommunicatorType>
+class SolverOptions<MatrixFreeOperator<OperatorImp, VectorImp>, CommunicatorType> : protected internal::SolverUtils
+{
+public:
+  static std::vector<std::string> types()
+  {
+    return internal::MatrixFreeSolverOptions::types();
+  }
+
+  static Common::Configuration options(const std::string type = "")
+  {
+    return internal::MatrixFreeSolverOptions::options(type);
+  }
+}; // class SolverOptions<MatrixFreeOperator<...>>
+
+
+/**
+ * \brief Krylov methods of dune-istl for operators which are only given by their action, see MatrixFreeOperator.
+ * \note  post_check_mode "sampled" is treated as "full", since single rows of the operator are not available.
+ */
+template <class OperatorImp, class VectorImp, class CommunicatorType>
+class Solver<MatrixFreeOperator<OperatorImp, VectorImp>, CommunicatorType> : protected internal::SolverUtils
+{
+  static_assert(std::is_same<CommunicatorType, SequentialCommunication>::value,
+                "The matrix-free solvers are only implemented for sequential communication!");
+
+public:
+  typedef MatrixFreeOperator<OperatorImp, VectorImp> MatrixType;
+  typedef VectorImp VectorType;
+  typedef typename VectorType::ScalarType S;
+  typedef typename VectorType::RealType R;
+
+  Solver(const MatrixType& op)
+    : op_(op)
+  {}
+
+  Solver(const MatrixType& op, const CommunicatorType& /*communicator*/)
+    : Solver(op)
+  {}
+
+  static std::vector<std::string> types()
+  {
+    return SolverOptions<MatrixType, CommunicatorType>::types();
+  }
+
+  static Common::Configuration options(const std::string type = "")
+  {
+    return SolverOptions<MatrixType, CommunicatorType>::options(type);
+  }
+
+  void apply(const VectorType& rhs, VectorType& solution) const
+  {
+    apply(rhs, solution, types()[0]);
+  }
+
+  void apply(const VectorType& rhs, VectorType& solution, const std::string& type) const
+  {
+    apply(rhs, solution, options(type));
+  }
+
+  /**
+   *  \note does a copy of the rhs
+   *  \note For a nonzero initial guess, the initial and final residual in statistics() are only computed if
+   *        'verbose' is set, since this costs an additional application of the operator.
+   */
+  void apply(const VectorType& rhs, VectorType& solution, const Common::Configuration& opts) const
+  {
+    if (!opts.has_key("type"))
+      DUNE_THROW(Common::Exceptions::configuration_error,
+                 "Given options (see below) need to have at least the key 'type' set!\n\n"
+                     << opts);
+    const auto type = opts.get<std::string>("type");
+    internal::SolverUtils::check_given(type, types());
+    const Common::Configuration default_opts = options(type);
+    if (rhs.size() != op_.rows() || solution.size() != op_.cols())
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "op.rows() = " << op_.rows() << "\n   rhs.size() = " << rhs.size()
+                                << "\n   solution.size() = " << solution.size());
+    statistics_.reset(type);
+    Dune::Timer timer;
+    internal::MatrixFreeLinearOperatorAdapter<OperatorImp, VectorImp> linear_operator(op_);
+    SeqScalarProduct<VectorType> scalar_product;
+    internal::FunctionPreconditioner<VectorType> preconditioner(make_preconditioner(opts, default_opts));
+    VectorType writable_rhs = rhs;
+    const int verbose = opts.get("verbose", default_opts.get<int>("verbose"));
+    // the initial residual is for free for a zero initial guess, otherwise it costs an additional application of the
+    // operator and is thus only computed if requested by 'verbose'
+    if (!(solution.sup_norm() > 0)) {
+      statistics_.initial_residual = scalar_product.norm(writable_rhs);
+    } else if (verbose > 0) {
+      linear_operator.applyscaleadd(S(-1), solution, writable_rhs);
+      statistics_.initial_residual = scalar_product.norm(writable_rhs);
+      writable_rhs = rhs;
+    }
+    statistics_.setup_time = timer.elapsed();
+    timer.reset();
+
+    const R precision = opts.get("precision", default_opts.get<R>("precision"));
+    const int max_iter = opts.get("max_iter", default_opts.get<int>("max_iter"));
+    InverseOperatorResult solver_result;
+    try {
+      if (type == "bicgstab") {
+        BiCGSTABSolver<VectorType> solver(
+            linear_operator, scalar_product, preconditioner, precision, max_iter, verbose);
+        solver.apply(solution, writable_rhs, solver_result);
+      } else if (type == "cg") {
+        CGSolver<VectorType> solver(linear_operator, scalar_product, preconditioner, precision, max_iter, verbose);
+        solver.apply(solution, writable_rhs, solver_result);
+      } else if (type == "gmres") {
+        RestartedGMResSolver<VectorType> solver(linear_operator,
+                                                scalar_product,
+                                                preconditioner,
+                                                precision,
+                                                opts.get("restart", default_opts.get<int>("restart")),
+                                                max_iter,
+                                                verbose);
+        solver.apply(solution, writable_rhs, solver_result);
+      } else if (type == "minres") {
+        MINRESSolver<VectorType> solver(linear_operator, scalar_product, preconditioner, precision, max_iter, verbose);
+        solver.apply(solution, writable_rhs, solver_result);
+      } else
+        DUNE_THROW(Common::Exceptions::internal_error,
+                   "Given type '" << type << "' is not supported, although it was reported by types()!");
+    } catch (ISTLError& e) {
+      DUNE_THROW(Exceptions::linear_solver_failed,
+                 "The dune-istl backend reported: " << e.what() << "Those were the given options:\n\n"
+                                                    << opts);
+    }
+    statistics_.solve_time = timer.elapsed();
+    statistics_.iterations = solver_result.iterations;
+    statistics_.final_residual = solver_result.reduction * statistics_.initial_residual;
+    statistics_.convergence_rate = solver_result.conv_rate;
+    if (!solver_result.converged)
+      DUNE_THROW(Exceptions::linear_solver_failed_bc_it_did_not_converge,
+                 "The dune-istl backend reported 'InverseOperatorResult.converged == false'!\n"
+                     << "Those were the given options:\n\n"
+                     << opts);
+
+    // check
+    const R post_check_solves_system_threshold =
+        opts.get("post_check_solves_system", default_opts.get<R>("post_check_solves_system"));
+    if (post_check_solves_system_threshold > 0) {
+      timer.reset();
+      const auto post_check_mode =
+          internal::SolverUtils::post_check_mode(opts, default_opts, op_.rows(), statistics_.final_residual);
+      R sup_norm = 0;
+      if (post_check_mode == "reported" && statistics_.final_residual <= post_check_solves_system_threshold) {
+        sup_norm = statistics_.final_residual;
+      } else {
+        op_.mv(solution, writable_rhs);
+        writable_rhs -= rhs;
+        sup_norm = writable_rhs.sup_norm();
+      }
+      statistics_.post_check_time = timer.elapsed();
+      if (sup_norm > post_check_solves_system_threshold || Common::isnan(sup_norm) || Common::isinf(sup_norm))
+        DUNE_THROW(Exceptions::linear_solver_failed_bc_the_solution_does_not_solve_the_system,
+                   "The computed solution does not solve the system (although the dune-istl backend "
+                       << "reported no error) and you requested checking (see options below)!\n"
+                       << "If you want to disable this check, set 'post_check_solves_system = 0' in the options."
+                       << "\n\n"
+                       << "  (A * x - b).sup_norm() = " << sup_norm << " (post_check_mode '" << post_check_mode
+                       << "')\n\n"
+                       << "Those were the given options:\n\n"
+                       << opts);
+    }
+  } // ... apply(...)
+
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
+private:
+  typename internal::FunctionPreconditioner<VectorType>::FunctionType
+  make_preconditioner(const Common::Configuration& opts, const Common::Configuration& default_opts) const
+  {
+    auto preconditioner_type = opts.get("preconditioner", default_opts.get<std::string>("preconditioner"));
+    internal::SolverUtils::check_given(preconditioner_type, {"auto", "custom", "jacobi", "identity"});
+    if (preconditioner_type == "auto")
+      preconditioner_type = op_.has_preconditioner() ? "custom" : (op_.has_diagonal() ? "jacobi" : "identity");
+    if (preconditioner_type == "custom") {
+      if (!op_.has_preconditioner())
+        DUNE_THROW(Exceptions::linear_solver_failed_bc_it_was_not_set_up_correctly,
+                   "preconditioner 'custom' requested, but none was given (call set_preconditioner() first)!");
+      return op_.preconditioner();
+    } else if (preconditioner_type == "jacobi") {
+      if (!op_.has_diagonal())
+        DUNE_THROW(Exceptions::linear_solver_failed_bc_it_was_not_set_up_correctly,
+                   "preconditioner 'jacobi' requested, but no diagonal was given (call set_diagonal() first)!");
+      VectorType inverse_diagonal = op_.diagonal();
+      for (size_t ii = 0; ii < inverse_diagonal.size(); ++ii) {
+        const S diagonal_entry = inverse_diagonal.get_entry(ii);
+        if (!(std::abs(diagonal_entry) > 0))
+          DUNE_THROW(Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements,
+                     "preconditioner 'jacobi' requires a nonzero diagonal (entry " << ii << " is zero)!");
+        inverse_diagonal.set_entry(ii, S(1) / diagonal_entry);
+      }
+      return [inverse_diagonal](const VectorType& residual, VectorType& correction) {
+        for (size_t ii = 0; ii < residual.size(); ++ii)
+          correction.set_entry(ii, inverse_diagonal.get_entry(ii) * residual.get_entry(ii));
+      };
+    }
+    return [](const VectorType& residual, VectorType& correction) { correction = residual; };
+  } // ... make_preconditioner(...)
+
+  const MatrixType& op_;
+  mutable SolverStatistics statistics_;
+}; // class Solver<MatrixFreeOperator<...>>
+
+
+} // namespace LA
+} // namespace XT
+} // namespace Dune
+
+#endif // DUNE_XT_LA_SOLVER_MATRIX_FREE_HH
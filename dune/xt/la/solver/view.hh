@@ -13,20 +13,209 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <memory>
 #include <sstream>
 #include <cmath>
+#include <type_traits>
 
 #include <dune/xt/common/configuration.hh>
+#include <dune/xt/common/memory.hh>
 
 #include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/container/istl.hh>
 #include <dune/xt/la/container/matrix-view.hh>
 #include <dune/xt/la/container/vector-view.hh>
 
 #include "../solver.hh"
+#include "matrix-free.hh"
 
 namespace Dune {
 namespace XT {
 namespace LA {
+namespace internal {
+
+
+/**
+ * \brief Visits the entries of a row of a matrix view (in ascending column order), calling f(jj, value) with the
+ *        column index jj of the view.
+ *
+ * The generic version uses the pattern of the view and get_entry(), the specializations for ISTL, common sparse (CSR)
+ * and common dense matrices directly walk the rows of the viewed matrix.
+ */
+template <class MatrixImp>
+struct MatrixViewRowAccess
+{
+  template <class ViewType, class FunctorType>
+  static void for_each_entry(const ViewType& view, const size_t ii, FunctorType&& f)
+  {
+    for (auto&& jj : view.get_pattern().inner(ii))
+      f(jj, view.get_entry(ii, jj));
+  }
+
+  // target has to be created with the pattern of the view
+  template <class ViewType>
+  static void copy(const ViewType& view, MatrixImp& target)
+  {
+    for (size_t ii = 0; ii < view.rows(); ++ii)
+      for_each_entry(view, ii, [&](const size_t jj, const typename MatrixImp::ScalarType& value) {
+        target.set_entry(ii, jj, value);
+      });
+  }
+}; // struct MatrixViewRowAccess
+
+
+template <class S>
+struct MatrixViewRowAccess<IstlRowMajorSparseMatrix<S>>
+{
+  template <class ViewType, class FunctorType>
+  static void for_each_entry(const ViewType& view, const size_t ii, FunctorType&& f)
+  {
+    if (view.cols() == 0)
+      return;
+    const size_t first_col = view.col_index(0);
+    const size_t past_last_col = first_col + view.cols();
+    const auto& row = view.matrix().backend()[view.row_index(ii)];
+    for (auto it = row.begin(); it != row.end(); ++it)
+      if (it.index() >= first_col && it.index() < past_last_col)
+        f(it.index() - first_col, (*it)[0][0]);
+  }
+
+  // target has to be created with the pattern of the view, i.e. its rows hold the same entries in the same order
+  template <class ViewType>
+  static void copy(const ViewType& view, IstlRowMajorSparseMatrix<S>& target)
+  {
+    for (size_t ii = 0; ii < view.rows(); ++ii) {
+      auto& target_row = target.backend()[ii];
+      auto target_it = target_row.begin();
+      for_each_entry(view, ii, [&](const size_t DXTC_DEBUG_ONLY(jj), const S& value) {
+        assert(target_it != target_row.end() && target_it.index() == jj);
+        (*target_it)[0][0] = value;
+        ++target_it;
+      });
+    }
+  } // ... copy(...)
+}; // struct MatrixViewRowAccess<IstlRowMajorSparseMatrix<...>>
+
+
+template <class S>
+struct MatrixViewRowAccess<CommonSparseMatrix<S, Common::StorageLayout::csr>>
+{
+  using MatrixType = CommonSparseMatrix<S, Common::StorageLayout::csr>;
+
+  template <class ViewType, class FunctorType>
+  static void for_each_entry(const ViewType& view, const size_t ii, FunctorType&& f)
+  {
+    if (view.cols() == 0)
+      return;
+    const size_t first_col = view.col_index(0);
+    const size_t past_last_col = first_col + view.cols();
+    const auto& matrix = view.matrix();
+    const size_t row = view.row_index(ii);
+    const size_t* row_begin = matrix.inner_index_ptr() + matrix.outer_index_ptr()[row];
+    const size_t* row_end = matrix.inner_index_ptr() + matrix.outer_index_ptr()[row + 1];
+    // the column indices of each row are sorted
+    for (auto it = std::lower_bound(row_begin, row_end, first_col); it != row_end && *it < past_last_col; ++it)
+      f(*it - first_col, matrix.entries()[it - matrix.inner_index_ptr()]);
+  }
+
+  // target has to be created with the pattern of the view, i.e. its rows hold the same entries in the same order
+  template <class ViewType>
+  static void copy(const ViewType& view, MatrixType& target)
+  {
+    for (size_t ii = 0; ii < view.rows(); ++ii) {
+      S* target_entry = target.entries() + target.outer_index_ptr()[ii];
+      for_each_entry(view, ii, [&](const size_t DXTC_DEBUG_ONLY(jj), const S& value) {
+        assert(target_entry - target.entries() < static_cast<std::ptrdiff_t>(target.outer_index_ptr()[ii + 1])
+               && target.inner_index_ptr()[target_entry - target.entries()] == jj);
+        *target_entry++ = value;
+      });
+    }
+  } // ... copy(...)
+}; // struct MatrixViewRowAccess<CommonSparseMatrix<...>>
+
+
+template <class S, Common::StorageLayout layout>
+struct MatrixViewRowAccess<CommonDenseMatrix<S, layout>>
+{
+  using MatrixType = CommonDenseMatrix<S, layout>;
+
+  template <class ViewType, class FunctorType>
+  static void for_each_entry(const ViewType& view, const size_t ii, FunctorType&& f)
+  {
+    if (view.cols() == 0)
+      return;
+    const auto& backend = view.matrix().backend();
+    const size_t row = view.row_index(ii);
+    const size_t first_col = view.col_index(0);
+    for (size_t jj = 0; jj < view.cols(); ++jj)
+      f(jj, backend.get_entry_ref(row, first_col + jj));
+  }
+
+  // copies contiguous rows (or columns, for a column major layout) of the viewed matrix at once
+  template <class ViewType>
+  static void copy(const ViewType& view, MatrixType& target)
+  {
+    if (view.rows() == 0 || view.cols() == 0)
+      return;
+    const auto& source = view.matrix();
+    const size_t first_row = view.row_index(0);
+    const size_t first_col = view.col_index(0);
+    if (layout == Common::StorageLayout::dense_row_major) {
+      for (size_t ii = 0; ii < view.rows(); ++ii)
+        std::copy_n(source.data() + (first_row + ii) * source.cols() + first_col,
+                    view.cols(),
+                    target.data() + ii * view.cols());
+    } else {
+      for (size_t jj = 0; jj < view.cols(); ++jj)
+        std::copy_n(source.data() + (first_col + jj) * source.rows() + first_row,
+                    view.rows(),
+                    target.data() + jj * view.rows());
+    }
+  } // ... copy(...)
+}; // struct MatrixViewRowAccess<CommonDenseMatrix<...>>
+
+
+/**
+ * \brief Applies a (square) matrix view without copying it, see MatrixFreeOperator.
+ */
+template <class ViewType, class VectorType>
+class MatrixViewOperator
+{
+  using RowAccess = MatrixViewRowAccess<typename ViewType::Matrix>;
+  using S = typename ViewType::ScalarType;
+
+public:
+  MatrixViewOperator(const ViewType& view)
+    : view_(view)
+  {}
+
+  void apply(const VectorType& x, VectorType& y) const
+  {
+    for (size_t ii = 0; ii < view_.rows(); ++ii) {
+      S value(0);
+      RowAccess::for_each_entry(view_, ii, [&](const size_t jj, const S& entry) { value += entry * x[jj]; });
+      y[ii] = value;
+    }
+  }
+
+  VectorType diagonal() const
+  {
+    VectorType ret(view_.rows(), 0.);
+    for (size_t ii = 0; ii < view_.rows(); ++ii)
+      RowAccess::for_each_entry(view_, ii, [&](const size_t jj, const S& entry) {
+        if (jj == ii)
+          ret[ii] = entry;
+      });
+    return ret;
+  }
+
+private:
+  const ViewType& view_;
+}; // class MatrixViewOperator
+
+
+} // namespace internal
 
 
 template <class MatrixImp, class CommunicatorType>
@@ -37,37 +226,53 @@ public:
 
   static std::vector<std::string> types()
   {
-    return SolverOptions<MatrixImp, CommunicatorType>::types();
+    auto ret = SolverOptions<MatrixImp, CommunicatorType>::types();
+    if (std::is_same<CommunicatorType, SequentialCommunication>::value)
+      for (const auto& tp : internal::MatrixFreeSolverOptions::types())
+        ret.push_back("matrix_free." + tp);
+    return ret;
   }
 
   static Common::Configuration options(const std::string type = "")
   {
-    return SolverOptions<MatrixImp, CommunicatorType>::options(type);
-  }
+    const std::string tp = !type.empty() ? type : types()[0];
+    internal::SolverUtils::check_given(tp, types());
+    if (tp.substr(0, 12) == "matrix_free.") {
+      auto opts = internal::MatrixFreeSolverOptions::options(tp.substr(12));
+      opts["type"] = tp;
+      return opts;
+    }
+    return SolverOptions<MatrixImp, CommunicatorType>::options(tp);
+  } // ... options(...)
 }; // class SolverOptions<MatrixView<...>>
 
 
+/**
+ * \brief Solver for a (square) block of a matrix.
+ *
+ * The types of Solver<MatrixImp> are available, for those the block is copied (on the first call to apply() which
+ * needs it, row by row from the storage of the viewed matrix). The types 'matrix_free.*' (sequential only) instead run
+ * the respective Krylov method of Solver<MatrixFreeOperator<...>> directly on the viewed matrix, without copying any
+ * entries (the preconditioner is Jacobi, if the diagonal of the block is nonzero).
+ * \note The viewed matrix must not change during the lifetime of this solver, the copy is not updated.
+ */
 template <class MatrixImp, class CommunicatorType>
 class Solver<MatrixView<MatrixImp>, CommunicatorType> : protected internal::SolverUtils
 {
 public:
   typedef MatrixView<MatrixImp> MatrixType;
+  typedef typename MatrixType::ScalarType S;
   typedef typename MatrixType::RealType R;
   using ActualSolver = Solver<MatrixImp, CommunicatorType>;
 
   Solver(const MatrixType& matrix_view)
     : matrix_view_(matrix_view)
-    , matrix_(matrix_view_.rows(), matrix_view_.cols(), matrix_view_.pattern())
-    , actual_solver_(matrix_)
-  {
-    const auto pattern = matrix_view_.pattern();
-    for (size_t ii = 0; ii < matrix_view_.rows(); ++ii)
-      for (const auto& jj : pattern.inner(ii))
-        matrix_.set_entry(ii, jj, matrix_view_.get_entry(ii, jj));
-  }
+    , communicator_(new CommunicatorType())
+  {}
 
-  Solver(const MatrixType& matrix, const CommunicatorType& /*communicator*/)
-    : Solver(matrix)
+  Solver(const MatrixType& matrix_view, const CommunicatorType& communicator)
+    : matrix_view_(matrix_view)
+    , communicator_(communicator)
   {}
 
   static std::vector<std::string> types()
@@ -95,9 +300,18 @@ public:
   template <class VectorType>
   void apply(const VectorType& rhs, VectorType& solution, const Common::Configuration& opts) const
   {
-    std::cerr << "Warning: Currently, Solver for MatrixView just copies everything to a new matrix, may be slow!"
-              << std::endl;
-    actual_solver_.apply(rhs, solution, opts);
+    if (!opts.has_key("type"))
+      DUNE_THROW(Common::Exceptions::configuration_error,
+                 "Given options (see below) need to have at least the key 'type' set!\n\n"
+                     << opts);
+    const auto type = opts.get<std::string>("type");
+    internal::SolverUtils::check_given(type, types());
+    if (type.substr(0, 12) == "matrix_free.") {
+      apply_matrix_free(rhs, solution, opts, type);
+    } else {
+      actual_solver().apply(rhs, solution, opts);
+      statistics_ = actual_solver().statistics();
+    }
   } // ... apply(...)
 
   template <class VectorType>
@@ -116,20 +330,71 @@ public:
   void
   apply(const VectorView<VectorType>& rhs, VectorView<VectorType>& solution, const Common::Configuration& opts) const
   {
-    std::cerr << "Warning: Currently, Solver for MatrixView just copies everything to a new matrix, may be slow!"
-              << std::endl;
     VectorType actual_rhs(rhs.size()), actual_solution(solution.size());
     for (size_t ii = 0; ii < rhs.size(); ++ii)
       actual_rhs[ii] = rhs[ii];
-    apply(actual_rhs, actual_solution, opts);
     for (size_t ii = 0; ii < solution.size(); ++ii)
       actual_solution[ii] = solution[ii];
+    apply(actual_rhs, actual_solution, opts);
+    for (size_t ii = 0; ii < solution.size(); ++ii)
+      solution[ii] = actual_solution[ii];
   } // ... apply(...)
 
+  /// \brief Information about the last call to apply().
+  const SolverStatistics& statistics() const
+  {
+    return statistics_;
+  }
+
 private:
+  const ActualSolver& actual_solver() const
+  {
+    if (!actual_solver_) {
+      matrix_ = std::make_unique<MatrixImp>(matrix_view_.rows(), matrix_view_.cols(), matrix_view_.get_pattern());
+      internal::MatrixViewRowAccess<MatrixImp>::copy(matrix_view_, *matrix_);
+      actual_solver_ = std::make_unique<ActualSolver>(*matrix_, communicator_.access());
+    }
+    return *actual_solver_;
+  } // ... actual_solver(...)
+
+  template <class VectorType>
+  void apply_matrix_free(const VectorType& rhs,
+                         VectorType& solution,
+                         const Common::Configuration& opts,
+                         const std::string& type) const
+  {
+    if (matrix_view_.rows() != matrix_view_.cols())
+      DUNE_THROW(Common::Exceptions::shapes_do_not_match,
+                 "The matrix_free types require a square block!\n   matrix_view.rows() = "
+                     << matrix_view_.rows() << "\n   matrix_view.cols() = " << matrix_view_.cols());
+    using OperatorType = internal::MatrixViewOperator<MatrixType, VectorType>;
+    const OperatorType view_operator(matrix_view_);
+    auto matrix_free_operator = make_matrix_free_operator<VectorType>(view_operator, matrix_view_.rows());
+    Common::Configuration matrix_free_opts = opts;
+    matrix_free_opts["type"] = type.substr(12);
+    const auto default_opts = options(type);
+    const auto preconditioner = opts.get("preconditioner", default_opts.get<std::string>("preconditioner"));
+    if (preconditioner == "jacobi" || preconditioner == "auto") {
+      const auto diagonal = view_operator.diagonal();
+      bool nonzero_diagonal = true;
+      for (size_t ii = 0; ii < diagonal.size(); ++ii)
+        nonzero_diagonal = nonzero_diagonal && std::abs(diagonal[ii]) > 0;
+      // otherwise, the matrix-free solver reports the missing diagonal for 'jacobi' and uses no preconditioner for
+      // 'auto'
+      if (nonzero_diagonal)
+        matrix_free_operator.set_diagonal(diagonal);
+    }
+    Solver<MatrixFreeOperator<OperatorType, VectorType>> matrix_free_solver(matrix_free_operator);
+    matrix_free_solver.apply(rhs, solution, matrix_free_opts);
+    statistics_ = matrix_free_solver.statistics();
+    statistics_.type = type;
+  } // ... apply_matrix_free(...)
+
   const MatrixType& matrix_view_;
-  MatrixImp matrix_;
-  ActualSolver actual_solver_;
+  const Common::ConstStorageProvider<CommunicatorType> communicator_;
+  mutable std::unique_ptr<MatrixImp> matrix_;
+  mutable std::unique_ptr<ActualSolver> actual_solver_;
+  mutable SolverStatistics statistics_;
 }; // class Solver< MatrixView< ... > >
 
 
@@ -0,0 +1,109 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#ifndef DUNE_XT_TEST_LA_ALGORITHMS_HH
+#define DUNE_XT_TEST_LA_ALGORITHMS_HH
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <dune/xt/common/matrix.hh>
+#include <dune/xt/common/vector.hh>
+
+#include <dune/xt/la/container/pattern.hh>
+
+
+// sin(offset + 0.37 ii + 1.3 jj) + (ii == jj ? diagonal_shift : 0), not symmetric and (for a small diagonal_shift)
+// requires pivoting
+template <class MatrixType>
+void fill_test_matrix(MatrixType& matrix, const double offset, const double diagonal_shift = 0.)
+{
+  using M = Dune::XT::Common::MatrixAbstraction<MatrixType>;
+  for (size_t ii = 0; ii < M::rows(matrix); ++ii)
+    for (size_t jj = 0; jj < M::cols(matrix); ++jj)
+      M::set_entry(matrix, ii, jj, std::sin(offset + 0.37 * ii + 1.3 * jj) + (ii == jj ? diagonal_shift : 0.));
+} // ... fill_test_matrix(...)
+
+// a rows x cols matrix filled by fill_test_matrix
+template <class MatrixType>
+MatrixType test_matrix(const size_t rows, const size_t cols, const double offset, const double diagonal_shift = 0.)
+{
+  auto matrix = Dune::XT::Common::MatrixAbstraction<MatrixType>::create(rows, cols, 0.);
+  fill_test_matrix(matrix, offset, diagonal_shift);
+  return matrix;
+}
+
+// the columns of test_matrix(size, k, offset) as k vectors
+template <class VectorType>
+std::vector<VectorType> test_vectors(const size_t size, const size_t k, const double offset)
+{
+  using V = Dune::XT::Common::VectorAbstraction<VectorType>;
+  std::vector<VectorType> ret;
+  for (size_t jj = 0; jj < k; ++jj) {
+    ret.push_back(V::create(size, 0.));
+    for (size_t ii = 0; ii < size; ++ii)
+      V::set_entry(ret[jj], ii, std::sin(offset + 0.37 * ii + 1.3 * jj));
+  }
+  return ret;
+}
+
+template <class MatrixType>
+double frobenius_norm(const MatrixType& matrix)
+{
+  using M = Dune::XT::Common::MatrixAbstraction<MatrixType>;
+  double ret = 0.;
+  for (size_t rr = 0; rr < M::rows(matrix); ++rr)
+    for (size_t cc = 0; cc < M::cols(matrix); ++cc)
+      ret += std::pow(M::get_entry(matrix, rr, cc), 2);
+  return std::sqrt(ret);
+}
+
+// max |Q^T Q - I|
+template <class MatrixType>
+double orthogonality_error(const MatrixType& Q)
+{
+  using M = Dune::XT::Common::MatrixAbstraction<MatrixType>;
+  double ret = 0.;
+  for (size_t ii = 0; ii < M::cols(Q); ++ii)
+    for (size_t jj = 0; jj < M::cols(Q); ++jj) {
+      double product = 0.;
+      for (size_t rr = 0; rr < M::rows(Q); ++rr)
+        product += M::get_entry(Q, rr, ii) * M::get_entry(Q, rr, jj);
+      ret = std::max(ret, std::abs(product - (ii == jj ? 1. : 0.)));
+    }
+  return ret;
+}
+
+// 5-point stencil on a grid of num_points x num_points points with diagonal 4 + shift, the entry to the right is
+// scaled by right_factor (which makes the matrix nonsymmetric)
+template <class MatrixType>
+MatrixType laplace_2d(const size_t num_points, const double shift = 0., const double right_factor = 1.)
+{
+  const size_t size = num_points * num_points;
+  Dune::XT::LA::SparsityPatternDefault pattern(size);
+  for (size_t row = 0; row < size; ++row) {
+    pattern.insert(row, row);
+    if (row >= num_points)
+      pattern.insert(row, row - num_points);
+    if (row + num_points < size)
+      pattern.insert(row, row + num_points);
+    if (row % num_points > 0)
+      pattern.insert(row, row - 1);
+    if (row % num_points < num_points - 1)
+      pattern.insert(row, row + 1);
+  }
+  pattern.sort();
+  MatrixType matrix(size, size, pattern);
+  for (size_t row = 0; row < size; ++row)
+    for (const auto& col : pattern.inner(row))
+      matrix.set_entry(row, col, col == row ? 4. + shift : (col == row + 1 ? -right_factor : -1.));
+  return matrix;
+} // ... laplace_2d(...)
+
+
+#endif // DUNE_XT_TEST_LA_ALGORITHMS_HH
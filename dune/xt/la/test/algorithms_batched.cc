@@ -0,0 +1,77 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/batched.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+
+// the matrices are not symmetric and require pivoting for some members of the batch
+template <int N>
+std::vector<FieldMatrix<double, N, N>> test_matrices(const size_t num_matrices)
+{
+  std::vector<FieldMatrix<double, N, N>> matrices(num_matrices);
+  for (size_t mm = 0; mm < num_matrices; ++mm)
+    fill_test_matrix(matrices[mm], 0.1 * mm, mm % 3 ? 2. : 0.5);
+  return matrices;
+}
+
+// the number of matrices is chosen such that it is not a multiple of the number of lanes
+template <int N>
+void check_batched(const size_t num_matrices)
+{
+  const auto matrices = test_matrices<N>(num_matrices);
+  std::vector<FieldVector<double, N>> expected_solutions(num_matrices), rhs(num_matrices), solutions;
+  for (size_t mm = 0; mm < num_matrices; ++mm) {
+    for (size_t ii = 0; ii < N; ++ii)
+      expected_solutions[mm][ii] = 1. + std::cos(double(ii + mm));
+    matrices[mm].mv(expected_solutions[mm], rhs[mm]);
+  }
+  XT::LA::batched_solve(matrices, rhs, solutions);
+  ASSERT_EQ(num_matrices, solutions.size());
+  for (size_t mm = 0; mm < num_matrices; ++mm)
+    for (size_t ii = 0; ii < N; ++ii)
+      DXTC_EXPECT_FLOAT_EQ(expected_solutions[mm][ii], solutions[mm][ii], 1e-12, 1e-12);
+  const auto inverses = XT::LA::batched_invert(matrices);
+  ASSERT_EQ(num_matrices, inverses.size());
+  for (size_t mm = 0; mm < num_matrices; ++mm)
+    for (size_t ii = 0; ii < N; ++ii)
+      for (size_t jj = 0; jj < N; ++jj) {
+        double entry = 0.;
+        for (size_t kk = 0; kk < N; ++kk)
+          entry += matrices[mm][ii][kk] * inverses[mm][kk][jj];
+        DXTC_EXPECT_FLOAT_EQ(ii == jj ? 1. : 0., entry, 1e-12, 1e-12);
+      }
+} // ... check_batched(...)
+
+
+GTEST_TEST(batched, solve_and_invert)
+{
+  check_batched<1>(5);
+  check_batched<2>(XT::LA::batched_num_lanes);
+  check_batched<3>(37);
+  check_batched<5>(100);
+  check_batched<8>(70);
+}
+
+GTEST_TEST(batched, singular_matrix)
+{
+  std::vector<FieldMatrix<double, 2, 2>> matrices(40, FieldMatrix<double, 2, 2>{{1., 0.}, {0., 1.}});
+  matrices[35][1][1] = 0.;
+  std::vector<FieldVector<double, 2>> rhs(40, FieldVector<double, 2>(1.)), solutions;
+  EXPECT_THROW(XT::LA::batched_solve(matrices, rhs, solutions),
+               XT::LA::Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements);
+  EXPECT_THROW(XT::LA::batched_invert(matrices),
+               XT::LA::Exceptions::matrix_invert_failed_bc_data_did_not_fulfill_requirements);
+  rhs.resize(39);
+  EXPECT_THROW(XT::LA::batched_solve(matrices, rhs, solutions), XT::Common::Exceptions::shapes_do_not_match);
+}
@@ -0,0 +1,91 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/gemm.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using RowMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_row_major>;
+using ColMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_column_major>;
+
+
+template <class FirstMatrixType, class SecondMatrixType, class ResultMatrixType>
+void check_product(const FirstMatrixType& A, const SecondMatrixType& B, const ResultMatrixType& C)
+{
+  ASSERT_EQ(A.rows(), C.rows());
+  ASSERT_EQ(B.cols(), C.cols());
+  for (size_t ii = 0; ii < C.rows(); ++ii)
+    for (size_t jj = 0; jj < C.cols(); ++jj) {
+      double expected = 0.;
+      for (size_t kk = 0; kk < A.cols(); ++kk)
+        expected += A.get_entry(ii, kk) * B.get_entry(kk, jj);
+      DXTC_EXPECT_FLOAT_EQ(expected, C.get_entry(ii, jj), 1e-12, 1e-12);
+    }
+} // ... check_product(...)
+
+// the sizes are chosen such that none of the block sizes divides them
+template <class FirstMatrixType, class SecondMatrixType, class ResultMatrixType>
+void check_gemm()
+{
+  const auto A = test_matrix<FirstMatrixType>(101, 263, 0.);
+  const auto B = test_matrix<SecondMatrixType>(263, 19, 1.);
+  auto C = test_matrix<ResultMatrixType>(101, 19, 2.);
+  const auto C_copy = C;
+  XT::LA::gemm(A, B, C, 2., -1.);
+  for (size_t ii = 0; ii < C.rows(); ++ii)
+    for (size_t jj = 0; jj < C.cols(); ++jj) {
+      double expected = -C_copy.get_entry(ii, jj);
+      for (size_t kk = 0; kk < A.cols(); ++kk)
+        expected += 2. * A.get_entry(ii, kk) * B.get_entry(kk, jj);
+      DXTC_EXPECT_FLOAT_EQ(expected, C.get_entry(ii, jj), 1e-12, 1e-12);
+    }
+  ResultMatrixType D(100, 19);
+  EXPECT_THROW(XT::LA::gemm(A, B, D), XT::Common::Exceptions::shapes_do_not_match);
+} // ... check_gemm(...)
+
+
+GTEST_TEST(gemm, all_layouts)
+{
+  check_gemm<RowMajorMatrixType, RowMajorMatrixType, RowMajorMatrixType>();
+  check_gemm<RowMajorMatrixType, ColMajorMatrixType, RowMajorMatrixType>();
+  check_gemm<ColMajorMatrixType, RowMajorMatrixType, ColMajorMatrixType>();
+  check_gemm<ColMajorMatrixType, ColMajorMatrixType, RowMajorMatrixType>();
+  check_gemm<RowMajorMatrixType, RowMajorMatrixType, ColMajorMatrixType>();
+}
+
+GTEST_TEST(gemm, operator_times)
+{
+  const auto A = test_matrix<RowMajorMatrixType>(130, 70, 0.);
+  const auto B = test_matrix<RowMajorMatrixType>(70, 45, 1.);
+  check_product(A, B, A * B);
+  const auto A_col = test_matrix<ColMajorMatrixType>(130, 70, 0.);
+  const auto B_col = test_matrix<ColMajorMatrixType>(70, 45, 1.);
+  check_product(A_col, B_col, A_col * B_col);
+  EXPECT_THROW(B * B, XT::Common::Exceptions::shapes_do_not_match);
+}
+
+GTEST_TEST(gemm, rightmultiply)
+{
+  const auto A = test_matrix<RowMajorMatrixType>(30, 70, 0.);
+  const auto B = test_matrix<ColMajorMatrixType>(70, 45, 1.);
+  const XT::LA::CommonSparseMatrixCsr<double> C(test_matrix<RowMajorMatrixType>(70, 45, 1.));
+  // dense, uses gemm
+  auto AB = A;
+  AB.rightmultiply(B);
+  check_product(A, B, AB);
+  // sparse, uses the fallback
+  auto AC = A;
+  AC.rightmultiply(C);
+  check_product(A, C, AC);
+  EXPECT_THROW(AB.rightmultiply(B), XT::Common::Exceptions::shapes_do_not_match);
+}
@@ -0,0 +1,190 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/incomplete_factorization.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+#if HAVE_DUNE_ISTL
+#  include <dune/istl/solvers.hh>
+
+#  include <dune/xt/la/container/istl.hh>
+#  include <dune/xt/la/solver/istl/preconditioners.hh>
+#endif
+
+using namespace Dune;
+
+using MatrixType = XT::LA::CommonSparseMatrixCsr<double>;
+using VectorType = XT::LA::CommonDenseVector<double>;
+
+
+// returns the residual norm after num_iterations steps of the preconditioned Richardson iteration for A x = 1
+template <class FactorizationType>
+double richardson_residual(const MatrixType& matrix, const FactorizationType& factorization, const size_t iterations)
+{
+  const VectorType rhs(matrix.rows(), 1.);
+  VectorType solution(matrix.rows(), 0.), residual(matrix.rows(), 0.);
+  for (size_t kk = 0; kk < iterations; ++kk) {
+    matrix.mv(solution, residual);
+    residual = rhs - residual;
+    factorization.apply(residual);
+    solution += residual;
+  }
+  matrix.mv(solution, residual);
+  return (rhs - residual).l2_norm();
+} // ... richardson_residual(...)
+
+VectorType expected_solution(const size_t size)
+{
+  VectorType ret(size, 1.);
+  for (size_t ii = 0; ii < size; ++ii)
+    ret.set_entry(ii, 1. + 0.1 * ii);
+  return ret;
+}
+
+
+GTEST_TEST(IncompleteLUFactorization, ilu0_keeps_pattern)
+{
+  const auto matrix = laplace_2d<MatrixType>(6, 0., 1.5);
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  ilu.symbolic(matrix);
+  EXPECT_EQ(matrix.non_zeros(), ilu.non_zeros());
+  ilu.numeric(matrix);
+  for (size_t ii = 0; ii < ilu.rows(); ++ii)
+    EXPECT_EQ(ii, ilu.column_indices()[ilu.diagonal_indices()[ii]]);
+}
+
+GTEST_TEST(IncompleteLUFactorization, complete_fill_is_exact)
+{
+  const auto matrix = laplace_2d<MatrixType>(6, 0., 1.5);
+  const auto solution = expected_solution(matrix.rows());
+  VectorType rhs(matrix.rows());
+  matrix.mv(solution, rhs);
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  ilu.symbolic(matrix, matrix.rows());
+  ilu.numeric(matrix);
+  VectorType x(matrix.rows());
+  ilu.apply(rhs, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - solution).sup_norm(), 1e-12, 1e-12);
+  ilu.threshold(matrix, 0.);
+  ilu.apply(rhs, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - solution).sup_norm(), 1e-12, 1e-12);
+}
+
+GTEST_TEST(IncompleteLUFactorization, more_fill_is_better)
+{
+  const auto matrix = laplace_2d<MatrixType>(10);
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  std::vector<double> residuals;
+  for (size_t fill_level : {0, 1, 2}) {
+    ilu.symbolic(matrix, fill_level);
+    ilu.numeric(matrix);
+    residuals.push_back(richardson_residual(matrix, ilu, 10));
+  }
+  EXPECT_GT(residuals[0], residuals[1]);
+  EXPECT_GT(residuals[1], residuals[2]);
+  XT::LA::IncompleteLUFactorization<double> ilut;
+  ilut.threshold(matrix, 1e-3, 5);
+  EXPECT_LT(richardson_residual(matrix, ilut, 10), residuals[0]);
+}
+
+GTEST_TEST(IncompleteLUFactorization, numeric_phase_is_reusable)
+{
+  auto matrix = laplace_2d<MatrixType>(6);
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  ilu.symbolic(matrix, 1);
+  ilu.numeric(matrix);
+  const auto first_residual = richardson_residual(matrix, ilu, 5);
+  matrix.scal(2.);
+  ilu.numeric(matrix);
+  DXTC_EXPECT_FLOAT_EQ(first_residual, richardson_residual(matrix, ilu, 5), 1e-12, 1e-12);
+  EXPECT_THROW(ilu.numeric(laplace_2d<MatrixType>(5)), XT::Common::Exceptions::shapes_do_not_match);
+}
+
+GTEST_TEST(IncompleteCholeskyFactorization, tridiagonal_is_exact)
+{
+  const size_t size = 10;
+  XT::LA::SparsityPatternDefault pattern(size);
+  for (size_t ii = 0; ii < size; ++ii) {
+    if (ii > 0)
+      pattern.insert(ii, ii - 1);
+    pattern.insert(ii, ii);
+    if (ii < size - 1)
+      pattern.insert(ii, ii + 1);
+  }
+  MatrixType matrix(size, size, pattern);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (const auto& jj : pattern.inner(ii))
+      matrix.set_entry(ii, jj, ii == jj ? 2.5 : -1.);
+  const auto solution = expected_solution(size);
+  VectorType rhs(size), x(size);
+  matrix.mv(solution, rhs);
+  XT::LA::IncompleteCholeskyFactorization<double> ic;
+  ic.symbolic(matrix);
+  EXPECT_EQ(2 * size - 1, ic.non_zeros());
+  ic.numeric(matrix);
+  ic.apply(rhs, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - solution).sup_norm(), 1e-12, 1e-12);
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  ilu.symbolic(matrix);
+  ilu.numeric(matrix);
+  ilu.apply(rhs, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - solution).sup_norm(), 1e-12, 1e-12);
+}
+
+GTEST_TEST(IncompleteCholeskyFactorization, matches_ilu0_for_symmetric_matrices)
+{
+  const auto matrix = laplace_2d<MatrixType>(8);
+  XT::LA::IncompleteCholeskyFactorization<double> ic;
+  ic.symbolic(matrix);
+  ic.numeric(matrix);
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  ilu.symbolic(matrix);
+  ilu.numeric(matrix);
+  DXTC_EXPECT_FLOAT_EQ(richardson_residual(matrix, ilu, 10), richardson_residual(matrix, ic, 10), 1e-10, 1e-10);
+  auto indefinite_matrix = matrix;
+  indefinite_matrix.scal(-1.);
+  EXPECT_THROW(ic.numeric(indefinite_matrix), MathError);
+}
+
+#if HAVE_DUNE_ISTL
+
+GTEST_TEST(IncompleteFactorizationPreconditioner, bicgstab)
+{
+  const auto matrix = laplace_2d<MatrixType>(10, 0., 1.5);
+  const auto solution = expected_solution(matrix.rows());
+  VectorType rhs(matrix.rows());
+  matrix.mv(solution, rhs);
+  const auto pattern = matrix.pattern();
+  XT::LA::IstlRowMajorSparseMatrix<double> istl_matrix(matrix.rows(), matrix.cols(), pattern);
+  for (size_t ii = 0; ii < matrix.rows(); ++ii)
+    for (const auto& jj : pattern.inner(ii))
+      istl_matrix.set_entry(ii, jj, matrix.get_entry(ii, jj));
+  XT::LA::IstlDenseVector<double> istl_rhs(rhs.size()), istl_solution(rhs.size(), 0.);
+  for (size_t ii = 0; ii < rhs.size(); ++ii)
+    istl_rhs.set_entry(ii, rhs.get_entry(ii));
+  XT::LA::IncompleteLUFactorization<double> ilu;
+  ilu.symbolic(matrix, 1);
+  ilu.numeric(matrix);
+  using IstlVectorType = XT::LA::IstlDenseVector<double>::BackendType;
+  using IstlMatrixType = XT::LA::IstlRowMajorSparseMatrix<double>::BackendType;
+  MatrixAdapter<IstlMatrixType, IstlVectorType, IstlVectorType> op(istl_matrix.backend());
+  XT::LA::IncompleteFactorizationPreconditioner<IstlVectorType, XT::LA::IncompleteLUFactorization<double>> prec(ilu);
+  BiCGSTABSolver<IstlVectorType> solver(op, prec, 1e-12, 100, 0);
+  InverseOperatorResult result;
+  auto istl_rhs_copy = istl_rhs.backend();
+  solver.apply(istl_solution.backend(), istl_rhs_copy, result);
+  EXPECT_TRUE(result.converged);
+  for (size_t ii = 0; ii < rhs.size(); ++ii)
+    DXTC_EXPECT_FLOAT_EQ(solution.get_entry(ii), istl_solution.get_entry(ii), 1e-8, 1e-8);
+}
+
+#endif // HAVE_DUNE_ISTL
@@ -0,0 +1,143 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/cholesky.hh>
+#include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using RowMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_row_major>;
+using ColMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_column_major>;
+
+
+// A + sign * U U^T
+template <class MatrixType>
+MatrixType symmetric_product(const MatrixType& A, const MatrixType& U, const double sign)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  auto ret = A;
+  for (size_t ii = 0; ii < M::rows(A); ++ii)
+    for (size_t jj = 0; jj < M::cols(A); ++jj)
+      for (size_t kk = 0; kk < M::cols(U); ++kk)
+        M::add_to_entry(ret, ii, jj, sign * M::get_entry(U, ii, kk) * M::get_entry(U, jj, kk));
+  return ret;
+}
+
+// checks that the lower triangular part of L is the Cholesky factor of A
+template <class MatrixType>
+void check_cholesky_factor(const MatrixType& L, const MatrixType& A)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  for (size_t ii = 0; ii < M::rows(A); ++ii)
+    for (size_t jj = 0; jj <= ii; ++jj) {
+      double entry = 0.;
+      for (size_t kk = 0; kk <= jj; ++kk)
+        entry += M::get_entry(L, ii, kk) * M::get_entry(L, jj, kk);
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(A, ii, jj), entry, 1e-12, 1e-12);
+    }
+}
+
+template <class MatrixType>
+void check_cholesky_updates(const size_t size)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  // A = B B^T + size I is symmetric positive definite
+  auto A = symmetric_product(M::create(size, size, 0.), test_matrix<MatrixType>(size, size, 0.), 1.);
+  for (size_t ii = 0; ii < size; ++ii)
+    M::add_to_entry(A, ii, ii, double(size));
+  const auto U = test_matrix<MatrixType>(size, 3, 1.);
+  auto L = A;
+  XT::LA::cholesky(L);
+  XT::LA::cholesky_update(L, U);
+  check_cholesky_factor(L, symmetric_product(A, U, 1.));
+  XT::LA::cholesky_downdate(L, U);
+  check_cholesky_factor(L, A);
+  std::vector<double> x(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    x[ii] = M::get_entry(U, ii, 0);
+  XT::LA::cholesky_update(L, x);
+  XT::LA::cholesky_downdate(L, x);
+  check_cholesky_factor(L, A);
+  // A - 100 * size * e_0 e_0^T is indefinite
+  std::fill(x.begin(), x.end(), 0.);
+  x[0] = 10. * size;
+  EXPECT_THROW(XT::LA::cholesky_downdate(L, x), MathError);
+  EXPECT_THROW(XT::LA::cholesky_update(L, std::vector<double>(size + 1)), XT::Common::Exceptions::shapes_do_not_match);
+} // ... check_cholesky_updates(...)
+
+template <class MatrixType>
+void check_qr_update(const size_t num_rows, const size_t num_cols)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const auto A = test_matrix<MatrixType>(num_rows, num_cols, 0.);
+  auto QR = A;
+  std::vector<double> tau(num_cols);
+  std::vector<int> permutations(num_cols);
+  XT::LA::qr(QR, tau, permutations);
+  auto Q = XT::LA::calculate_q_from_qr(QR, tau);
+  auto R = QR;
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    for (size_t jj = 0; jj < std::min(ii, num_cols); ++jj)
+      M::set_entry(R, ii, jj, 0.);
+  const auto U = test_matrix<MatrixType>(num_rows, 2, 1.);
+  const auto V = test_matrix<MatrixType>(num_cols, 2, 2.);
+  XT::LA::qr_update(Q, R, permutations, U, V);
+  // Q R = (A + U V^T) P, R is upper triangular and Q is orthogonal
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    for (size_t jj = 0; jj < num_cols; ++jj) {
+      const size_t col = static_cast<size_t>(permutations[jj]);
+      double expected = M::get_entry(A, ii, col);
+      for (size_t kk = 0; kk < 2; ++kk)
+        expected += M::get_entry(U, ii, kk) * M::get_entry(V, col, kk);
+      double entry = 0.;
+      for (size_t kk = 0; kk < num_rows; ++kk)
+        entry += Q.get_entry(ii, kk) * M::get_entry(R, kk, jj);
+      DXTC_EXPECT_FLOAT_EQ(expected, entry, 1e-12, 1e-12);
+      if (ii > jj)
+        EXPECT_EQ(0., M::get_entry(R, ii, jj));
+    }
+  EXPECT_LT(orthogonality_error(Q), 1e-12);
+  // downdating restores A P = Q R
+  std::vector<double> u(num_rows), v(num_cols);
+  for (size_t kk = 0; kk < 2; ++kk) {
+    for (size_t ii = 0; ii < num_rows; ++ii)
+      u[ii] = -M::get_entry(U, ii, kk);
+    for (size_t jj = 0; jj < num_cols; ++jj)
+      v[jj] = M::get_entry(V, jj, kk);
+    XT::LA::qr_update(Q, R, permutations, u, v);
+  }
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    for (size_t jj = 0; jj < num_cols; ++jj) {
+      double entry = 0.;
+      for (size_t kk = 0; kk < num_rows; ++kk)
+        entry += Q.get_entry(ii, kk) * M::get_entry(R, kk, jj);
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(A, ii, static_cast<size_t>(permutations[jj])), entry, 1e-12, 1e-12);
+    }
+} // ... check_qr_update(...)
+
+
+GTEST_TEST(low_rank_updates, cholesky)
+{
+  for (const size_t size : {1, 7, 30}) {
+    check_cholesky_updates<RowMajorMatrixType>(size);
+    check_cholesky_updates<ColMajorMatrixType>(size);
+  }
+}
+
+GTEST_TEST(low_rank_updates, qr)
+{
+  check_qr_update<RowMajorMatrixType>(5, 5);
+  check_qr_update<RowMajorMatrixType>(20, 20);
+  check_qr_update<ColMajorMatrixType>(20, 12);
+  check_qr_update<ColMajorMatrixType>(20, 20);
+}
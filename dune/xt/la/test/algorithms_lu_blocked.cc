@@ -0,0 +1,113 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/common/dynmatrix.hh>
+
+#include <dune/xt/la/algorithms/lu.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/solver/common.hh>
+#include <dune/xt/la/solver/dense.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using MatrixType = XT::LA::CommonDenseMatrix<double>;
+using VectorType = XT::LA::CommonDenseVector<double>;
+
+
+// the 1-norm of A and of its inverse (computed column by column)
+double condition_number(const MatrixType& A, const XT::LA::DenseLuFactorization<double>& lu)
+{
+  const size_t size = A.rows();
+  double norm = 0., inverse_norm = 0.;
+  VectorType column(size);
+  for (size_t jj = 0; jj < size; ++jj) {
+    column.set_all(0.);
+    column[jj] = 1.;
+    lu.apply(column);
+    inverse_norm = std::max(inverse_norm, column.l1_norm());
+    double sum = 0.;
+    for (size_t ii = 0; ii < size; ++ii)
+      sum += std::abs(A.get_entry(ii, jj));
+    norm = std::max(norm, sum);
+  }
+  return norm * inverse_norm;
+} // ... condition_number(...)
+
+
+GTEST_TEST(DenseLuFactorization, block_sizes_and_multiple_rhs)
+{
+  for (const size_t size : {1, 5, 63, 64, 65, 150}) {
+    const auto A = test_matrix<MatrixType>(size, size, 0., 0.1);
+    const auto X = test_matrix<MatrixType>(size, 13, 1., 0.1);
+    MatrixType B(size, 13, 0.);
+    XT::LA::gemm(A, X, B);
+    VectorType expected_solution(size), rhs(size), solution(size);
+    for (size_t ii = 0; ii < size; ++ii)
+      expected_solution[ii] = 1. + std::cos(double(ii));
+    A.mv(expected_solution, rhs);
+    for (const size_t block_size : {1, 7, 64}) {
+      const XT::LA::DenseLuFactorization<double> lu(A, block_size);
+      lu.apply(rhs, solution);
+      DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-10, 1e-10);
+      MatrixType solutions(size, 13, 0.);
+      lu.apply(B, solutions);
+      for (size_t ii = 0; ii < size; ++ii)
+        for (size_t jj = 0; jj < 13; ++jj)
+          DXTC_EXPECT_FLOAT_EQ(X.get_entry(ii, jj), solutions.get_entry(ii, jj), 1e-10, 1e-10);
+      // the estimate is a lower bound and usually exact for small matrices
+      const double condition = condition_number(A, lu);
+      EXPECT_LE(lu.condition_estimate(), condition * (1. + 1e-10));
+      EXPECT_GE(lu.condition_estimate(), condition / 3.);
+    }
+  }
+}
+
+GTEST_TEST(DenseLuFactorization, errors)
+{
+  MatrixType singular(3, 3, 1.);
+  EXPECT_THROW(XT::LA::DenseLuFactorization<double>{singular}, FMatrixError);
+  const auto non_square = test_matrix<MatrixType>(3, 4, 0., 0.1);
+  EXPECT_THROW(XT::LA::DenseLuFactorization<double>{non_square}, XT::Common::Exceptions::shapes_do_not_match);
+  const XT::LA::DenseLuFactorization<double> lu(test_matrix<MatrixType>(3, 3, 0., 0.1));
+  VectorType too_long(4);
+  EXPECT_THROW(lu.apply(too_long), XT::Common::Exceptions::shapes_do_not_match);
+}
+
+GTEST_TEST(DenseLuFactorization, solver)
+{
+  const size_t size = 80;
+  const auto A = test_matrix<MatrixType>(size, size, 0., 0.1);
+  const auto X = test_matrix<MatrixType>(size, 5, 1., 0.1);
+  MatrixType B(size, 5, 0.), solutions(size, 5, 0.);
+  XT::LA::gemm(A, X, B);
+  const XT::LA::Solver<MatrixType> solver(A);
+  auto options = solver.options("lu.partialpiv");
+  options["reuse_setup"] = "-1";
+  options["block_size"] = "16";
+  solver.apply(B, solutions, options);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < 5; ++jj)
+      DXTC_EXPECT_FLOAT_EQ(X.get_entry(ii, jj), solutions.get_entry(ii, jj), 1e-10, 1e-10);
+  EXPECT_GT(solver.statistics().condition_estimate, 1.);
+  VectorType rhs(size, 1.), solution(size);
+  solver.apply(rhs, solution, options);
+  EXPECT_EQ("lu.partialpiv", solver.statistics().type);
+  EXPECT_LE(solver.statistics().final_residual, 1e-10);
+  EXPECT_THROW(solver.apply(B, solutions, "qr.householder"), XT::Common::Exceptions::wrong_input_given);
+  // the generic dense solver
+  const auto A_dynamic = test_matrix<DynamicMatrix<double>>(size, size, 0., 0.1);
+  const XT::LA::Solver<DynamicMatrix<double>> dynamic_solver(A_dynamic);
+  DynamicVector<double> dynamic_rhs(size, 1.), dynamic_solution(size, 0.);
+  dynamic_solver.apply(dynamic_rhs, dynamic_solution, "lu.partialpiv");
+  for (size_t ii = 0; ii < size; ++ii)
+    DXTC_EXPECT_FLOAT_EQ(solution[ii], dynamic_solution[ii], 1e-10, 1e-10);
+}
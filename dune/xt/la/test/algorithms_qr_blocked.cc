@@ -0,0 +1,118 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/common/dynmatrix.hh>
+
+#include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using RowMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_row_major>;
+using ColMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_column_major>;
+
+
+// the block size is chosen such that it does not divide the number of columns
+template <class MatrixType>
+void check_blocked_qr(const size_t num_rows, const size_t num_cols)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const auto A = test_matrix<MatrixType>(num_rows, num_cols, 0., 2.);
+  auto QR = A;
+  std::vector<double> tau(num_cols);
+  std::vector<int> permutations(num_cols);
+  XT::LA::blocked_qr(QR, tau, permutations, 7);
+  for (size_t jj = 0; jj < num_cols; ++jj)
+    EXPECT_EQ(int(jj), permutations[jj]);
+  // Q R = A
+  auto R = QR;
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    for (size_t jj = 0; jj < std::min(ii, num_cols); ++jj)
+      M::set_entry(R, ii, jj, 0.);
+  auto QtimesR = M::create(num_rows, num_cols, 0.);
+  XT::LA::apply_q_from_qr<XT::Common::Transpose::no>(QR, tau, R, QtimesR, 5);
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    for (size_t jj = 0; jj < num_cols; ++jj)
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(A, ii, jj), M::get_entry(QtimesR, ii, jj), 1e-12, 1e-12);
+  // the blocked and the column-wise application of Q^T coincide (the latter requires cols <= rows)
+  if (num_cols > num_rows)
+    return;
+  auto QtA = M::create(num_rows, num_cols, 0.);
+  XT::LA::apply_q_from_qr<XT::Common::Transpose::yes>(QR, tau, A, QtA);
+  std::vector<double> column(num_rows), result(num_rows);
+  for (size_t jj = 0; jj < num_cols; ++jj) {
+    for (size_t ii = 0; ii < num_rows; ++ii)
+      column[ii] = M::get_entry(A, ii, jj);
+    XT::LA::apply_q_from_qr<XT::Common::Transpose::yes>(QR, tau, column, result);
+    for (size_t ii = 0; ii < num_rows; ++ii) {
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(R, ii, jj), result[ii], 1e-12, 1e-12);
+      DXTC_EXPECT_FLOAT_EQ(result[ii], M::get_entry(QtA, ii, jj), 1e-12, 1e-12);
+    }
+  }
+} // ... check_blocked_qr(...)
+
+template <class MatrixType>
+void check_solve_qr_factorized(const bool blocked)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const size_t size = 45;
+  const size_t num_rhs = 11;
+  auto QR = test_matrix<MatrixType>(size, size, 0., 2.);
+  const auto X = test_matrix<MatrixType>(size, num_rhs, 1., 2.);
+  auto B = M::create(size, num_rhs, 0.);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < num_rhs; ++jj)
+      for (size_t kk = 0; kk < size; ++kk)
+        M::add_to_entry(B, ii, jj, M::get_entry(QR, ii, kk) * M::get_entry(X, kk, jj));
+  std::vector<double> tau(size);
+  std::vector<int> permutations(size);
+  if (blocked)
+    XT::LA::blocked_qr(QR, tau, permutations);
+  else
+    XT::LA::qr(QR, tau, permutations);
+  auto solution = M::create(size, num_rhs, 0.);
+  XT::LA::solve_qr_factorized(QR, tau, permutations, solution, B, 4);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < num_rhs; ++jj)
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(X, ii, jj), M::get_entry(solution, ii, jj), 1e-10, 1e-10);
+  auto too_small = M::create(size - 1, num_rhs, 0.);
+  EXPECT_THROW(XT::LA::solve_qr_factorized(QR, tau, permutations, too_small, B),
+               XT::Common::Exceptions::shapes_do_not_match);
+} // ... check_solve_qr_factorized(...)
+
+
+GTEST_TEST(blocked_qr, common_dense_row_major)
+{
+  check_blocked_qr<RowMajorMatrixType>(60, 40);
+  check_blocked_qr<RowMajorMatrixType>(30, 45);
+}
+
+GTEST_TEST(blocked_qr, common_dense_col_major)
+{
+  check_blocked_qr<ColMajorMatrixType>(60, 40);
+  check_blocked_qr<ColMajorMatrixType>(30, 45);
+}
+
+GTEST_TEST(blocked_qr, dynamic_matrix)
+{
+  check_blocked_qr<DynamicMatrix<double>>(60, 40);
+  check_blocked_qr<DynamicMatrix<double>>(30, 45);
+}
+
+GTEST_TEST(solve_qr_factorized, multiple_rhs)
+{
+  for (const bool blocked : {true, false}) {
+    check_solve_qr_factorized<RowMajorMatrixType>(blocked);
+    check_solve_qr_factorized<ColMajorMatrixType>(blocked);
+    check_solve_qr_factorized<DynamicMatrix<double>>(blocked);
+  }
+}
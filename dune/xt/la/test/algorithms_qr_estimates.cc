@@ -0,0 +1,159 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/common/dynmatrix.hh>
+
+#include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using RowMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_row_major>;
+using ColMajorMatrixType = XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_column_major>;
+
+
+// columns are scaled by 10^{-jj/2}, so the condition grows quickly with the number of columns
+template <class MatrixType>
+MatrixType graded_matrix(const size_t rows, const size_t cols)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  auto matrix = test_matrix<MatrixType>(rows, cols, 0., 2.);
+  for (size_t ii = 0; ii < rows; ++ii)
+    for (size_t jj = 0; jj < cols; ++jj)
+      M::set_entry(matrix, ii, jj, M::get_entry(matrix, ii, jj) * std::pow(10., -0.5 * jj));
+  return matrix;
+}
+
+// ||R||_1 ||R^{-1}||_1, computing R^{-1} column by column
+template <class MatrixType>
+double exact_condition(const MatrixType& QR)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const size_t size = M::cols(QR);
+  double norm = 0., inverse_norm = 0.;
+  std::vector<double> column(size);
+  for (size_t jj = 0; jj < size; ++jj) {
+    double column_sum = 0.;
+    for (size_t ii = 0; ii <= jj; ++ii)
+      column_sum += std::abs(M::get_entry(QR, ii, jj));
+    norm = std::max(norm, column_sum);
+    std::fill(column.begin(), column.end(), 0.);
+    column[jj] = 1.;
+    for (size_t ii = jj + 1; ii-- > 0;) {
+      for (size_t kk = ii + 1; kk <= jj; ++kk)
+        column[ii] -= M::get_entry(QR, ii, kk) * column[kk];
+      column[ii] /= M::get_entry(QR, ii, ii);
+    }
+    double inverse_column_sum = 0.;
+    for (const auto& entry : column)
+      inverse_column_sum += std::abs(entry);
+    inverse_norm = std::max(inverse_norm, inverse_column_sum);
+  }
+  return norm * inverse_norm;
+} // ... exact_condition(...)
+
+template <class MatrixType>
+void check_condition_and_rank()
+{
+  for (const size_t size : {1, 5, 20}) {
+    auto QR = graded_matrix<MatrixType>(size, size);
+    std::vector<double> tau(size);
+    std::vector<int> permutations(size);
+    XT::LA::qr(QR, tau, permutations);
+    EXPECT_EQ(size, XT::LA::qr_rank(QR));
+    const double exact = exact_condition(QR);
+    const double estimate = XT::LA::qr_condition_estimate(QR);
+    // the estimate is a lower bound, usually within a factor of 3
+    EXPECT_LE(estimate, exact * (1. + 1e-10));
+    EXPECT_GE(estimate, exact / 3.);
+  }
+  // rank 4 matrix
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const auto U = graded_matrix<MatrixType>(20, 4);
+  auto QR = M::create(20, 10, 0.);
+  for (size_t ii = 0; ii < 20; ++ii)
+    for (size_t jj = 0; jj < 10; ++jj)
+      for (size_t kk = 0; kk < 4; ++kk)
+        M::add_to_entry(QR, ii, jj, M::get_entry(U, ii, kk) * std::cos(1. + kk * jj));
+  std::vector<double> tau(10);
+  std::vector<int> permutations(10);
+  XT::LA::qr(QR, tau, permutations);
+  EXPECT_EQ(size_t(4), XT::LA::qr_rank(QR, 1e-10));
+  EXPECT_GT(XT::LA::qr_condition_estimate(QR), 1e10);
+} // ... check_condition_and_rank(...)
+
+template <class MatrixType>
+void check_least_squares_residual()
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const size_t num_rows = 30;
+  const size_t num_cols = 12;
+  const auto A = graded_matrix<MatrixType>(num_rows, num_cols);
+  std::vector<double> b(num_rows);
+  for (size_t ii = 0; ii < num_rows; ++ii)
+    b[ii] = std::cos(0.1 * ii * ii);
+  auto QR = A;
+  std::vector<double> tau(num_cols);
+  std::vector<int> permutations(num_cols);
+  XT::LA::qr(QR, tau, permutations);
+  // least squares solution x = P R^{-1} (Q^T b)[0:num_cols]
+  std::vector<double> c(num_rows), y(num_cols), x(num_cols);
+  XT::LA::apply_q_from_qr<XT::Common::Transpose::yes>(QR, tau, b, c);
+  for (size_t ii = num_cols; ii-- > 0;) {
+    y[ii] = c[ii];
+    for (size_t jj = ii + 1; jj < num_cols; ++jj)
+      y[ii] -= M::get_entry(QR, ii, jj) * y[jj];
+    y[ii] /= M::get_entry(QR, ii, ii);
+  }
+  for (size_t ii = 0; ii < num_cols; ++ii)
+    x[permutations[ii]] = y[ii];
+  double residual = 0.;
+  for (size_t ii = 0; ii < num_rows; ++ii) {
+    double entry = -b[ii];
+    for (size_t jj = 0; jj < num_cols; ++jj)
+      entry += M::get_entry(A, ii, jj) * x[jj];
+    residual += entry * entry;
+  }
+  DXTC_EXPECT_FLOAT_EQ(std::sqrt(residual), XT::LA::qr_least_squares_residual(QR, tau, b), 1e-10, 1e-12);
+  // using fewer columns increases the residual
+  EXPECT_GT(XT::LA::qr_least_squares_residual(QR, tau, b, 3), std::sqrt(residual));
+  std::vector<double> too_short(num_rows - 1);
+  EXPECT_THROW(XT::LA::qr_least_squares_residual(QR, tau, too_short), XT::Common::Exceptions::shapes_do_not_match);
+} // ... check_least_squares_residual(...)
+
+
+GTEST_TEST(qr_estimates, condition_and_rank)
+{
+  check_condition_and_rank<RowMajorMatrixType>();
+  check_condition_and_rank<ColMajorMatrixType>();
+  check_condition_and_rank<DynamicMatrix<double>>();
+}
+
+GTEST_TEST(qr_estimates, least_squares_residual)
+{
+  check_least_squares_residual<RowMajorMatrixType>();
+  check_least_squares_residual<ColMajorMatrixType>();
+  check_least_squares_residual<DynamicMatrix<double>>();
+}
+
+GTEST_TEST(qr_estimates, singular)
+{
+  auto QR = graded_matrix<RowMajorMatrixType>(4, 4);
+  for (size_t jj = 0; jj < 4; ++jj)
+    QR.set_entry(3, jj, 0.);
+  std::vector<double> tau(4);
+  std::vector<int> permutations(4);
+  XT::LA::qr(QR, tau, permutations);
+  QR.set_entry(3, 3, 0.);
+  EXPECT_EQ(size_t(3), XT::LA::qr_rank(QR));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), XT::LA::qr_condition_estimate(QR));
+}
@@ -0,0 +1,152 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/randomized_svd.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using MatrixType = XT::LA::CommonDenseMatrix<double>;
+using VectorType = XT::LA::CommonDenseVector<double>;
+using M = XT::Common::MatrixAbstraction<MatrixType>;
+
+
+// sum_jj 2^{-jj} x_jj y_jj^T, i.e. the singular values decay exponentially
+MatrixType decaying_matrix(const size_t rows, const size_t cols)
+{
+  auto matrix = M::create(rows, cols, 0.);
+  for (size_t jj = 0; jj < std::min(rows, cols); ++jj)
+    for (size_t rr = 0; rr < rows; ++rr)
+      for (size_t cc = 0; cc < cols; ++cc)
+        M::add_to_entry(matrix,
+                        rr,
+                        cc,
+                        std::pow(0.5, jj) * std::sin(0.37 * rr * (jj + 1) + 1.3 * jj)
+                            * std::cos(0.71 * cc * (jj + 1) + 0.4 * jj) / std::sqrt(rows * cols));
+  return matrix;
+}
+
+
+GTEST_TEST(RandomizedSvd, matrix)
+{
+  for (const auto& size : std::vector<std::pair<size_t, size_t>>{{300, 80}, {50, 200}, {1000, 40}, {7, 3}}) {
+    const size_t rows = size.first;
+    const size_t cols = size.second;
+    const auto A = decaying_matrix(rows, cols);
+    const double norm = frobenius_norm(A);
+    for (const double tolerance : {1e-2, 1e-4, 1e-6, 0.}) {
+      const auto svd = XT::LA::randomized_svd(A, tolerance);
+      const size_t rank = svd.singular_values.size();
+      ASSERT_EQ(rank, M::cols(svd.U));
+      ASSERT_EQ(rank, M::cols(svd.V));
+      EXPECT_TRUE(std::is_sorted(svd.singular_values.rbegin(), svd.singular_values.rend()));
+      EXPECT_LT(orthogonality_error(svd.U), 1e-12);
+      EXPECT_LT(orthogonality_error(svd.V), 1e-12);
+      // A - U S V^T
+      auto difference = A;
+      for (size_t rr = 0; rr < rows; ++rr)
+        for (size_t cc = 0; cc < cols; ++cc)
+          for (size_t kk = 0; kk < rank; ++kk)
+            M::add_to_entry(difference,
+                            rr,
+                            cc,
+                            -M::get_entry(svd.U, rr, kk) * svd.singular_values[kk] * M::get_entry(svd.V, cc, kk));
+      const double error = frobenius_norm(difference);
+      EXPECT_LE(error, tolerance * norm + 1e-12 * norm);
+      EXPECT_NEAR(error, svd.error_estimate, 1e-6 * norm);
+    }
+    // fixed rank
+    const auto svd = XT::LA::randomized_svd(A, 0., 3);
+    EXPECT_EQ(size_t(3), svd.singular_values.size());
+  }
+  EXPECT_THROW(XT::LA::randomized_svd(decaying_matrix(5, 5), -1.), XT::Common::Exceptions::wrong_input_given);
+  EXPECT_THROW(XT::LA::randomized_svd(decaying_matrix(5, 5), 0., 5, 0), XT::Common::Exceptions::wrong_input_given);
+} // GTEST_TEST(RandomizedSvd, matrix)
+
+GTEST_TEST(RandomizedSvd, range_finder)
+{
+  const auto A = decaying_matrix(300, 80);
+  const double norm = frobenius_norm(A);
+  const auto range = XT::LA::randomized_range_finder(A, 1e-3);
+  EXPECT_LT(orthogonality_error(range.basis), 1e-12);
+  // A - Q Q^T A
+  const size_t rank = M::cols(range.basis);
+  auto difference = A;
+  for (size_t cc = 0; cc < 80; ++cc)
+    for (size_t kk = 0; kk < rank; ++kk) {
+      double product = 0.;
+      for (size_t rr = 0; rr < 300; ++rr)
+        product += M::get_entry(range.basis, rr, kk) * M::get_entry(A, rr, cc);
+      for (size_t rr = 0; rr < 300; ++rr)
+        M::add_to_entry(difference, rr, cc, -product * M::get_entry(range.basis, rr, kk));
+    }
+  EXPECT_LE(frobenius_norm(difference), 1e-3 * norm);
+  EXPECT_NEAR(frobenius_norm(difference), range.error_estimate, 1e-6 * norm);
+} // GTEST_TEST(RandomizedSvd, range_finder)
+
+GTEST_TEST(RandomizedSvd, list_vector_array)
+{
+  const auto A = decaying_matrix(500, 60);
+  XT::LA::ListVectorArray<VectorType> snapshots(500);
+  for (size_t cc = 0; cc < 60; ++cc) {
+    VectorType snapshot(500, 0.);
+    for (size_t rr = 0; rr < 500; ++rr)
+      snapshot.set_entry(rr, M::get_entry(A, rr, cc));
+    snapshots.append(std::move(snapshot));
+  }
+  const auto expected = XT::LA::randomized_svd(A, 1e-6);
+  const auto pod = XT::LA::randomized_svd(snapshots, 1e-6);
+  ASSERT_EQ(expected.singular_values.size(), pod.singular_values.size());
+  ASSERT_EQ(expected.singular_values.size(), pod.U.length());
+  ASSERT_EQ(expected.singular_values.size(), pod.V.length());
+  EXPECT_EQ(size_t(500), pod.U.dim());
+  EXPECT_EQ(size_t(60), pod.V.dim());
+  for (size_t kk = 0; kk < pod.singular_values.size(); ++kk) {
+    DXTC_EXPECT_FLOAT_EQ(expected.singular_values[kk], pod.singular_values[kk], 1e-12, 1e-12);
+    for (size_t rr = 0; rr < 500; ++rr)
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(expected.U, rr, kk), pod.U[kk].vector().get_entry(rr), 1e-12, 1e-12);
+  }
+} // GTEST_TEST(RandomizedSvd, list_vector_array)
+
+GTEST_TEST(RandomizedSvd, sparse_matrix)
+{
+  using SparseMatrixType = XT::LA::CommonSparseMatrix<double>;
+  // the columns have disjoint patterns and decaying norms
+  const size_t rows = 200;
+  const size_t cols = 60;
+  XT::LA::SparsityPatternDefault pattern(rows);
+  for (size_t rr = 0; rr < rows; ++rr)
+    pattern.insert(rr, rr % cols);
+  SparseMatrixType A(rows, cols, pattern);
+  auto dense_A = M::create(rows, cols, 0.);
+  for (size_t rr = 0; rr < rows; ++rr) {
+    const double value = std::pow(0.5, rr % cols) * (rr < cols ? 1. : 0.1 * std::sin(0.37 * rr));
+    A.set_entry(rr, rr % cols, value);
+    M::set_entry(dense_A, rr, rr % cols, value);
+  }
+  const auto svd = XT::LA::randomized_svd(A, 1e-6);
+  static_assert(std::is_same<std::decay_t<decltype(svd.U)>, MatrixType>::value, "U has to be dense!");
+  static_assert(std::is_same<std::decay_t<decltype(svd.V)>, MatrixType>::value, "V has to be dense!");
+  EXPECT_LT(orthogonality_error(svd.U), 1e-12);
+  EXPECT_LT(orthogonality_error(svd.V), 1e-12);
+  // the same entries are read, so the result coincides with the one for the dense copy
+  const auto expected = XT::LA::randomized_svd(dense_A, 1e-6);
+  ASSERT_EQ(expected.singular_values.size(), svd.singular_values.size());
+  for (size_t kk = 0; kk < svd.singular_values.size(); ++kk) {
+    DXTC_EXPECT_FLOAT_EQ(expected.singular_values[kk], svd.singular_values[kk], 1e-12, 1e-12);
+    for (size_t rr = 0; rr < rows; ++rr)
+      DXTC_EXPECT_FLOAT_EQ(M::get_entry(expected.U, rr, kk), M::get_entry(svd.U, rr, kk), 1e-12, 1e-12);
+  }
+  const auto range = XT::LA::randomized_range_finder(A, 1e-3);
+  EXPECT_LT(orthogonality_error(range.basis), 1e-12);
+  EXPECT_LE(range.error_estimate, 1e-3 * frobenius_norm(dense_A));
+} // GTEST_TEST(RandomizedSvd, sparse_matrix)
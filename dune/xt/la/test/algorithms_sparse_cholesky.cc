@@ -0,0 +1,138 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/sparse_cholesky.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using VectorType = XT::LA::CommonDenseVector<double>;
+
+
+template <class MatrixType>
+void check_sparse_cholesky(const double shift, const bool ldlt)
+{
+  const auto matrix = laplace_2d<MatrixType>(15, shift);
+  const size_t size = matrix.rows();
+  VectorType expected_solution(size), rhs(size), x(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    expected_solution.set_entry(ii, 1. + std::sin(double(ii)));
+  matrix.mv(expected_solution, rhs);
+  XT::LA::SparseCholeskyFactorization<double> natural, reordered;
+  natural.symbolic(matrix);
+  natural.numeric(matrix, ldlt);
+  natural.apply(rhs, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-10, 1e-10);
+  reordered.symbolic(matrix, XT::LA::minimum_degree_ordering(matrix));
+  reordered.numeric(matrix, ldlt);
+  reordered.apply(rhs, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-10, 1e-10);
+  // the fill of the banded factor is (approximately) size * num_points
+  EXPECT_LT(reordered.factor_non_zeros(), natural.factor_non_zeros());
+  EXPECT_GE(natural.factor_non_zeros(), (size - 15) * 15);
+} // ... check_sparse_cholesky(...)
+
+
+GTEST_TEST(SparseCholeskyFactorization, csr_llt)
+{
+  check_sparse_cholesky<XT::LA::CommonSparseMatrixCsr<double>>(0., false);
+}
+
+GTEST_TEST(SparseCholeskyFactorization, csc_llt)
+{
+  check_sparse_cholesky<XT::LA::CommonSparseMatrixCsc<double>>(0., false);
+}
+
+GTEST_TEST(SparseCholeskyFactorization, csr_ldlt)
+{
+  check_sparse_cholesky<XT::LA::CommonSparseMatrixCsr<double>>(0., true);
+}
+
+GTEST_TEST(SparseCholeskyFactorization, indefinite_ldlt)
+{
+  check_sparse_cholesky<XT::LA::CommonSparseMatrixCsr<double>>(-1.5, true);
+  const auto matrix = laplace_2d<XT::LA::CommonSparseMatrixCsr<double>>(15, -1.5);
+  XT::LA::SparseCholeskyFactorization<double> factorization;
+  factorization.symbolic(matrix);
+  EXPECT_THROW(factorization.numeric(matrix), MathError);
+}
+
+GTEST_TEST(SparseCholeskyFactorization, refactorization)
+{
+  auto matrix = laplace_2d<XT::LA::CommonSparseMatrixCsr<double>>(10);
+  XT::LA::SparseCholeskyFactorization<double> factorization;
+  factorization.symbolic(matrix, XT::LA::minimum_degree_ordering(matrix));
+  factorization.numeric(matrix);
+  matrix.scal(2.);
+  factorization.numeric(matrix);
+  const VectorType expected_solution(matrix.rows(), 1.);
+  VectorType x(matrix.rows());
+  matrix.mv(expected_solution, x);
+  factorization.apply(x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-12, 1e-12);
+  // a matrix of the same size with another pattern
+  const XT::LA::CommonSparseMatrixCsr<double> other_matrix(
+      matrix.rows(), matrix.cols(), XT::LA::dense_pattern(matrix.rows(), matrix.cols()));
+  EXPECT_THROW(factorization.numeric(other_matrix), XT::Common::Exceptions::shapes_do_not_match);
+}
+
+GTEST_TEST(SparseCholeskyFactorization, dense_pattern_is_one_supernode)
+{
+  const size_t size = 8;
+  XT::LA::CommonSparseMatrixCsr<double> matrix(size, size, XT::LA::dense_pattern(size, size));
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < size; ++jj)
+      matrix.set_entry(ii, jj, ii == jj ? double(size) : 1. / (1. + ii + jj));
+  XT::LA::SparseCholeskyFactorization<double> factorization;
+  factorization.symbolic(matrix);
+  EXPECT_EQ(size_t(1), factorization.num_supernodes());
+  EXPECT_EQ(size * (size + 1) / 2, factorization.factor_non_zeros());
+  for (size_t jj = 0; jj + 1 < size; ++jj)
+    EXPECT_EQ(jj + 1, factorization.elimination_tree()[jj]);
+  factorization.numeric(matrix);
+  const VectorType expected_solution(size, 1.);
+  VectorType x(size);
+  matrix.mv(expected_solution, x);
+  factorization.apply(x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-12, 1e-12);
+  std::vector<size_t> not_a_permutation(size, 0);
+  EXPECT_THROW(factorization.symbolic(matrix, not_a_permutation), XT::Common::Exceptions::wrong_input_given);
+}
+
+GTEST_TEST(SparseCholeskyFactorization, supernodes_are_fundamental)
+{
+  // columns 0 and 1 are both children of column 2, so column 2 starts a new supernode although the pattern of column 1
+  // below the diagonal is {2}
+  XT::LA::SparsityPatternDefault pattern(3);
+  for (size_t ii = 0; ii < 3; ++ii)
+    pattern.insert(ii, ii);
+  for (size_t ii = 0; ii < 2; ++ii) {
+    pattern.insert(ii, 2);
+    pattern.insert(2, ii);
+  }
+  pattern.sort();
+  XT::LA::CommonSparseMatrixCsr<double> matrix(3, 3, pattern);
+  for (size_t ii = 0; ii < 3; ++ii)
+    for (const auto& jj : pattern.inner(ii))
+      matrix.set_entry(ii, jj, ii == jj ? 4. : 1.);
+  XT::LA::SparseCholeskyFactorization<double> factorization;
+  factorization.symbolic(matrix);
+  EXPECT_EQ(size_t(2), factorization.elimination_tree()[0]);
+  EXPECT_EQ(size_t(2), factorization.elimination_tree()[1]);
+  EXPECT_EQ(size_t(3), factorization.num_supernodes());
+  factorization.numeric(matrix);
+  const VectorType expected_solution(3, 1.);
+  VectorType x(3);
+  matrix.mv(expected_solution, x);
+  factorization.apply(x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-12, 1e-12);
+}
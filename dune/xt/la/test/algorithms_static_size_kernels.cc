@@ -0,0 +1,125 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <limits>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/xt/la/algorithms/cholesky.hh>
+#include <dune/xt/la/algorithms/qr.hh>
+#include <dune/xt/la/matrix-inverter.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+
+// symmetric and strictly diagonally dominant, thus positive definite
+template <int size>
+FieldMatrix<double, size, size> spd_matrix()
+{
+  FieldMatrix<double, size, size> matrix(0.);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < size; ++jj)
+      matrix[ii][jj] = ii == jj ? 2. * size : 1. / (1. + ii + jj);
+  return matrix;
+}
+
+// not symmetric, with a zero in the upper left corner to enforce pivoting
+template <int size>
+FieldMatrix<double, size, size> general_matrix()
+{
+  FieldMatrix<double, size, size> matrix(0.);
+  fill_test_matrix(matrix, 0., 2.);
+  if (size > 1)
+    matrix[0][0] = 0.;
+  return matrix;
+}
+
+template <int size>
+FieldVector<double, size> expected_solution()
+{
+  FieldVector<double, size> solution;
+  for (size_t ii = 0; ii < size; ++ii)
+    solution[ii] = 1. + std::cos(double(ii));
+  return solution;
+}
+
+template <int size>
+void check_static_size_kernels()
+{
+  static_assert(XT::LA::internal::is_small_field_matrix<FieldMatrix<double, size, size>>::value, "");
+  const auto x = expected_solution<size>();
+  FieldVector<double, size> b, solution;
+  // cholesky
+  const auto A_spd = spd_matrix<size>();
+  A_spd.mv(x, b);
+  auto L = A_spd;
+  XT::LA::cholesky(L);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < size; ++jj) {
+      double LLt = 0.;
+      for (size_t kk = 0; kk <= std::min(ii, jj); ++kk)
+        LLt += L[ii][kk] * L[jj][kk];
+      DXTC_EXPECT_FLOAT_EQ(A_spd[ii][jj], LLt, 1e-13, 1e-13);
+    }
+  XT::LA::solve_cholesky_factorized(L, solution, b);
+  for (size_t ii = 0; ii < size; ++ii)
+    DXTC_EXPECT_FLOAT_EQ(x[ii], solution[ii], 1e-13, 1e-13);
+  // qr
+  const auto A = general_matrix<size>();
+  A.mv(x, b);
+  auto QR = A;
+  XT::LA::solve_by_qr_decomposition(QR, solution, b);
+  for (size_t ii = 0; ii < size; ++ii)
+    DXTC_EXPECT_FLOAT_EQ(x[ii], solution[ii], 1e-12, 1e-12);
+  // inversion
+  const auto A_inv = XT::LA::invert_matrix(A);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < size; ++jj) {
+      double AAinv = 0.;
+      for (size_t kk = 0; kk < size; ++kk)
+        AAinv += A[ii][kk] * A_inv[kk][jj];
+      DXTC_EXPECT_FLOAT_EQ(ii == jj ? 1. : 0., AAinv, 1e-12, 1e-12);
+    }
+} // ... check_static_size_kernels(...)
+
+
+GTEST_TEST(static_size_kernels, field_matrices_up_to_8x8)
+{
+  check_static_size_kernels<1>();
+  check_static_size_kernels<2>();
+  check_static_size_kernels<3>();
+  check_static_size_kernels<4>();
+  check_static_size_kernels<5>();
+  check_static_size_kernels<6>();
+  check_static_size_kernels<7>();
+  check_static_size_kernels<8>();
+}
+
+GTEST_TEST(static_size_kernels, large_and_non_square_matrices_use_generic_code)
+{
+  static_assert(!XT::LA::internal::is_small_field_matrix<FieldMatrix<double, 9, 9>>::value, "");
+  static_assert(!XT::LA::internal::is_small_field_matrix<FieldMatrix<double, 3, 4>>::value, "");
+  static_assert(!XT::LA::internal::is_small_field_matrix<FieldMatrix<int, 3, 3>>::value, "");
+}
+
+GTEST_TEST(static_size_kernels, singular_matrices)
+{
+  FieldMatrix<double, 3, 3> singular{{1., 2., 3.}, {2., 4., 6.}, {0., 1., 1.}};
+  EXPECT_THROW(XT::LA::invert_matrix(singular), XT::LA::Exceptions::matrix_invert_failed);
+  auto not_spd = singular;
+  EXPECT_THROW(XT::LA::cholesky(not_spd), MathError);
+  // NaN pivots have to be rejected as well
+  FieldMatrix<double, 3, 3> nan_matrix{{1., 2., 3.}, {2., 1., 6.}, {0., 1., 1.}};
+  nan_matrix[0][0] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(XT::LA::invert_matrix(nan_matrix), XT::LA::Exceptions::matrix_invert_failed);
+}
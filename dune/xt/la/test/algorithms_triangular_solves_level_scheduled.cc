@@ -0,0 +1,103 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/algorithms/triangular_solves.hh>
+#include <dune/xt/la/container/common.hh>
+
+using namespace Dune;
+
+using VectorType = XT::LA::CommonDenseVector<double>;
+
+
+// Triangular part of the 5-point stencil on a grid of num_points x num_points points, with an additional (far away)
+// entry in every 7th row. The levels of the rows are thus the anti-diagonals of the grid.
+template <class MatrixType>
+MatrixType triangular_laplace_2d(const size_t num_points, const XT::Common::MatrixPattern triangular_type)
+{
+  const bool lower = (triangular_type == XT::Common::MatrixPattern::lower_triangular);
+  const size_t size = num_points * num_points;
+  XT::LA::SparsityPatternDefault pattern(size);
+  for (size_t row = 0; row < size; ++row) {
+    pattern.insert(row, row);
+    for (const auto& offset : {size_t(1), num_points, size_t(3) * num_points}) {
+      if (offset == 3 * num_points && row % 7 != 0)
+        continue;
+      if (lower && row >= offset && (offset != 1 || row % num_points > 0))
+        pattern.insert(row, row - offset);
+      if (!lower && row + offset < size && (offset != 1 || row % num_points < num_points - 1))
+        pattern.insert(row, row + offset);
+    }
+  }
+  pattern.sort();
+  MatrixType matrix(size, size, pattern);
+  for (size_t row = 0; row < size; ++row)
+    for (const auto& col : pattern.inner(row))
+      matrix.set_entry(row, col, col == row ? 4. + 0.01 * row : -1.);
+  return matrix;
+} // ... triangular_laplace_2d(...)
+
+template <class MatrixType>
+void check_level_scheduled_solve(const XT::Common::MatrixPattern triangular_type)
+{
+  const size_t num_points = 12;
+  auto matrix = triangular_laplace_2d<MatrixType>(num_points, triangular_type);
+  const size_t size = matrix.rows();
+  VectorType expected_solution(size), rhs(size), x(size, 0.);
+  for (size_t ii = 0; ii < size; ++ii)
+    expected_solution.set_entry(ii, 1. + 0.1 * ii);
+  matrix.mv(expected_solution, rhs);
+  XT::LA::LevelScheduledTriangularSolver<MatrixType> solver(matrix, triangular_type);
+  EXPECT_EQ(2 * num_points - 1, solver.schedule().num_levels());
+  EXPECT_EQ(size, solver.schedule().rows().size());
+  solver.apply(x, rhs);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-12, 1e-12);
+  // in place
+  x = rhs;
+  solver.apply(x, x);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-12, 1e-12);
+  // the analysis is reused for changed values
+  matrix.scal(2.);
+  solver.apply(x, rhs);
+  expected_solution.scal(0.5);
+  DXTC_EXPECT_FLOAT_EQ(0., (x - expected_solution).sup_norm(), 1e-12, 1e-12);
+} // ... check_level_scheduled_solve(...)
+
+
+GTEST_TEST(LevelScheduledTriangularSolver, csr_lower)
+{
+  check_level_scheduled_solve<XT::LA::CommonSparseMatrixCsr<double>>(XT::Common::MatrixPattern::lower_triangular);
+}
+
+GTEST_TEST(LevelScheduledTriangularSolver, csr_upper)
+{
+  check_level_scheduled_solve<XT::LA::CommonSparseMatrixCsr<double>>(XT::Common::MatrixPattern::upper_triangular);
+}
+
+GTEST_TEST(LevelScheduledTriangularSolver, csc_lower)
+{
+  check_level_scheduled_solve<XT::LA::CommonSparseMatrixCsc<double>>(XT::Common::MatrixPattern::lower_triangular);
+}
+
+GTEST_TEST(LevelScheduledTriangularSolver, csc_upper)
+{
+  check_level_scheduled_solve<XT::LA::CommonSparseMatrixCsc<double>>(XT::Common::MatrixPattern::upper_triangular);
+}
+
+GTEST_TEST(LevelScheduledTriangularSolver, missing_diagonal)
+{
+  XT::LA::SparsityPatternDefault pattern(2);
+  pattern.insert(0, 0);
+  pattern.insert(1, 0);
+  const XT::LA::CommonSparseMatrixCsr<double> matrix(2, 2, pattern);
+  EXPECT_THROW(XT::LA::LevelScheduledTriangularSolver<XT::LA::CommonSparseMatrixCsr<double>>(
+                   matrix, XT::Common::MatrixPattern::lower_triangular),
+               MathError);
+}
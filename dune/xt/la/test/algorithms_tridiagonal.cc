@@ -0,0 +1,160 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <limits>
+
+#include <dune/xt/la/algorithms/tridiagonal.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+
+// diagonally dominant, not symmetric
+struct TridiagonalSystem
+{
+  TridiagonalSystem(const size_t size, const double offset)
+    : lower(size)
+    , diag(size)
+    , upper(size)
+    , solution(size)
+    , rhs(size)
+  {
+    for (size_t ii = 0; ii < size; ++ii) {
+      lower[ii] = std::sin(offset + ii);
+      upper[ii] = std::cos(offset + 2. * ii);
+      diag[ii] = 3. + 0.1 * offset;
+      solution[ii] = 1. + std::cos(offset + 0.1 * ii);
+    }
+    for (size_t ii = 0; ii < size; ++ii) {
+      rhs[ii] = diag[ii] * solution[ii];
+      if (ii > 0)
+        rhs[ii] += lower[ii] * solution[ii - 1];
+      if (ii + 1 < size)
+        rhs[ii] += upper[ii] * solution[ii + 1];
+    }
+  }
+
+  std::vector<double> lower, diag, upper, solution, rhs;
+}; // struct TridiagonalSystem
+
+
+GTEST_TEST(tridiagonal, batched)
+{
+  const size_t num_systems = 13;
+  for (const size_t size : {1, 2, 7, 50}) {
+    // interleave the systems
+    std::vector<double> lower(size * num_systems), diag(size * num_systems), upper(size * num_systems),
+        rhs(size * num_systems), solution(size * num_systems);
+    for (size_t ss = 0; ss < num_systems; ++ss) {
+      const TridiagonalSystem system(size, double(ss));
+      for (size_t ii = 0; ii < size; ++ii) {
+        lower[ii * num_systems + ss] = system.lower[ii];
+        diag[ii * num_systems + ss] = system.diag[ii];
+        upper[ii * num_systems + ss] = system.upper[ii];
+        rhs[ii * num_systems + ss] = system.rhs[ii];
+        solution[ii * num_systems + ss] = system.solution[ii];
+      }
+    }
+    XT::LA::batched_tridiagonal_solve(size, num_systems, lower.data(), diag.data(), upper.data(), rhs.data());
+    for (size_t kk = 0; kk < size * num_systems; ++kk)
+      DXTC_EXPECT_FLOAT_EQ(solution[kk], rhs[kk], 1e-13, 1e-13);
+  }
+  std::vector<double> zeros(3 * num_systems, 0.), rhs(3 * num_systems, 1.);
+  EXPECT_THROW(XT::LA::batched_tridiagonal_solve(3, num_systems, zeros.data(), zeros.data(), zeros.data(), rhs.data()),
+               MathError);
+  // a NaN pivot in a single system
+  std::vector<double> ones(3 * num_systems, 1.), nan_diag(3 * num_systems, 3.);
+  nan_diag[num_systems + 5] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(XT::LA::batched_tridiagonal_solve(3, num_systems, ones.data(), nan_diag.data(), ones.data(), rhs.data()),
+               MathError);
+}
+
+GTEST_TEST(tridiagonal, batched_sym_posdef)
+{
+  const size_t size = 20;
+  const size_t num_systems = 9;
+  std::vector<double> diag(size * num_systems), subdiag(size * num_systems), rhs(size * num_systems, 0.),
+      solution(size * num_systems);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t ss = 0; ss < num_systems; ++ss) {
+      diag[ii * num_systems + ss] = 2. + 0.1 * ss;
+      subdiag[ii * num_systems + ss] = -1. + 0.01 * ii;
+      solution[ii * num_systems + ss] = std::sin(0.3 * ii + ss);
+    }
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t ss = 0; ss < num_systems; ++ss) {
+      const size_t kk = ii * num_systems + ss;
+      rhs[kk] = diag[kk] * solution[kk];
+      if (ii > 0)
+        rhs[kk] += subdiag[kk - num_systems] * solution[kk - num_systems];
+      if (ii + 1 < size)
+        rhs[kk] += subdiag[kk] * solution[kk + num_systems];
+    }
+  auto indefinite_diag = diag;
+  indefinite_diag[5 * num_systems + 3] = -1.;
+  auto subdiag_copy = subdiag;
+  auto rhs_copy = rhs;
+  XT::LA::batched_solve_sym_tridiag_posdef(size, num_systems, diag.data(), subdiag.data(), rhs.data());
+  for (size_t kk = 0; kk < size * num_systems; ++kk)
+    DXTC_EXPECT_FLOAT_EQ(solution[kk], rhs[kk], 1e-12, 1e-12);
+  EXPECT_THROW(XT::LA::batched_solve_sym_tridiag_posdef(
+                   size, num_systems, indefinite_diag.data(), subdiag_copy.data(), rhs_copy.data()),
+               MathError);
+}
+
+GTEST_TEST(tridiagonal, cyclic_reduction)
+{
+  // sizes that are powers of two, one less and one more and a size large enough to be run in parallel
+  for (const size_t size : {1, 2, 3, 7, 8, 9, 100, 12345}) {
+    TridiagonalSystem system(size, 0.);
+    XT::LA::cyclic_reduction_tridiagonal_solve(system.lower, system.diag, system.upper, system.rhs);
+    for (size_t ii = 0; ii < size; ++ii)
+      DXTC_EXPECT_FLOAT_EQ(system.solution[ii], system.rhs[ii], 1e-13, 1e-13);
+  }
+  std::vector<double> lower(5, 1.), diag(5, 1.), upper(5, 1.), rhs(4, 1.);
+  EXPECT_THROW(XT::LA::cyclic_reduction_tridiagonal_solve(lower, diag, upper, rhs),
+               XT::Common::Exceptions::shapes_do_not_match);
+  // NaN pivots in the first reduction step and for the last remaining unknown
+  for (const size_t nan_index : {0, 3}) {
+    std::vector<double> nan_lower(4, 1.), nan_diag(4, 3.), nan_upper(4, 1.), nan_rhs(4, 1.);
+    nan_diag[nan_index] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW(XT::LA::cyclic_reduction_tridiagonal_solve(nan_lower, nan_diag, nan_upper, nan_rhs), MathError);
+  }
+}
+
+GTEST_TEST(tridiagonal, block_thomas)
+{
+  static constexpr int b = 3;
+  for (const size_t size : {1, 2, 10}) {
+    std::vector<FieldMatrix<double, b, b>> lower(size - 1), diag(size), upper(size - 1);
+    std::vector<FieldVector<double, b>> solution(size), rhs(size, FieldVector<double, b>(0.));
+    for (size_t ii = 0; ii < size; ++ii) {
+      for (size_t pp = 0; pp < b; ++pp)
+        solution[ii][pp] = std::sin(double(ii + pp));
+      fill_test_matrix(diag[ii], double(ii), 6.);
+      if (ii + 1 < size) {
+        fill_test_matrix(lower[ii], 1. + ii);
+        fill_test_matrix(upper[ii], 2. + ii);
+      }
+    }
+    for (size_t ii = 0; ii < size; ++ii) {
+      diag[ii].umv(solution[ii], rhs[ii]);
+      if (ii > 0)
+        lower[ii - 1].umv(solution[ii - 1], rhs[ii]);
+      if (ii + 1 < size)
+        upper[ii].umv(solution[ii + 1], rhs[ii]);
+    }
+    XT::LA::solve_block_tridiagonal(lower, diag, upper, rhs);
+    for (size_t ii = 0; ii < size; ++ii)
+      for (size_t pp = 0; pp < b; ++pp)
+        DXTC_EXPECT_FLOAT_EQ(solution[ii][pp], rhs[ii][pp], 1e-13, 1e-13);
+  }
+}
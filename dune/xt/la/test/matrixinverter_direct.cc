@@ -0,0 +1,111 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <vector>
+
+#include <dune/common/dynmatrix.hh>
+
+#include <dune/xt/la/algorithms/lu.hh>
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/matrix-inverter.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+
+template <class MatrixType>
+void check_is_inverse(const MatrixType& matrix, const MatrixType& inverse)
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  for (size_t ii = 0; ii < M::rows(matrix); ++ii)
+    for (size_t jj = 0; jj < M::cols(matrix); ++jj) {
+      typename M::ScalarType entry = 0.;
+      for (size_t kk = 0; kk < M::cols(matrix); ++kk)
+        entry += M::get_entry(matrix, ii, kk) * M::get_entry(inverse, kk, jj);
+      DXTC_EXPECT_FLOAT_EQ(ii == jj ? 1. : 0., entry, 1e-12, 1e-12);
+    }
+}
+
+template <class MatrixType>
+void check_direct_inversion()
+{
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  // not symmetric, with a zero in the upper left corner to enforce pivoting
+  auto matrix = M::create(12, 12, 0.);
+  fill_test_matrix(matrix, 0., 2.);
+  M::set_entry(matrix, 0, 0, 0.);
+  XT::LA::MatrixInverter<MatrixType> inverter(matrix, "direct");
+  check_is_inverse(matrix, inverter.inverse());
+  // recompute in place after a change of the matrix
+  fill_test_matrix(matrix, 1., 2.);
+  M::set_entry(matrix, 0, 0, 0.);
+  inverter.compute();
+  check_is_inverse(matrix, inverter.inverse());
+  auto singular = M::create(3, 3, 1.);
+  EXPECT_THROW(XT::LA::invert_matrix(singular), XT::LA::Exceptions::matrix_invert_failed);
+  // singular up to rounding errors, the second row is 0.7 / 3 times the first one
+  auto numerically_singular = M::create(3, 3, 0.);
+  const double first_row[3] = {3., 1. / 3., 1.};
+  for (size_t jj = 0; jj < 3; ++jj) {
+    M::set_entry(numerically_singular, 0, jj, first_row[jj]);
+    M::set_entry(numerically_singular, 1, jj, 0.7 * first_row[jj] / 3.);
+    M::set_entry(numerically_singular, 2, jj, 1. + jj * jj);
+  }
+  EXPECT_THROW(XT::LA::invert_matrix(numerically_singular), XT::LA::Exceptions::matrix_invert_failed);
+}
+
+
+GTEST_TEST(MatrixInverter, direct_common_dense)
+{
+  check_direct_inversion<XT::LA::CommonDenseMatrix<double>>();
+  check_direct_inversion<XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_column_major>>();
+}
+
+GTEST_TEST(MatrixInverter, direct_dynamic_matrix)
+{
+  check_direct_inversion<DynamicMatrix<double>>();
+}
+
+// invert_in_place and DenseLuFactorization share the singularity threshold, so they have to agree on nearly singular
+// matrices, independently of the scaling
+GTEST_TEST(MatrixInverter, direct_same_singularity_verdict_as_lu)
+{
+  using MatrixType = XT::LA::CommonDenseMatrix<double>;
+  using M = XT::Common::MatrixAbstraction<MatrixType>;
+  const double first_row[3] = {3., 1. / 3., 1.};
+  for (const double perturbation : {0., 1e-8}) {
+    for (const double scaling : {1e-20, 1., 1e20}) {
+      // the second row is 0.7 / 3 times the first one, up to rounding errors and the perturbation
+      auto matrix = M::create(3, 3, 0.);
+      for (size_t jj = 0; jj < 3; ++jj) {
+        M::set_entry(matrix, 0, jj, scaling * first_row[jj]);
+        M::set_entry(matrix, 1, jj, scaling * (0.7 * first_row[jj] / 3. + (jj == 1 ? perturbation : 0.)));
+        M::set_entry(matrix, 2, jj, scaling * (1. + jj * jj));
+      }
+      bool inverted = true;
+      try {
+        auto inverse = matrix;
+        std::vector<size_t> pivots;
+        XT::LA::invert_in_place(inverse, pivots);
+      } catch (FMatrixError&) {
+        inverted = false;
+      }
+      bool factorized = true;
+      try {
+        XT::LA::DenseLuFactorization<double> lu(matrix);
+      } catch (FMatrixError&) {
+        factorized = false;
+      }
+      EXPECT_EQ(perturbation > 0., inverted) << "scaling: " << scaling;
+      EXPECT_EQ(inverted, factorized) << "perturbation: " << perturbation << ", scaling: " << scaling;
+    }
+  }
+}
@@ -0,0 +1,70 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <memory>
+
+#include <dune/xt/la/solver/istl/saddlepoint.hh>
+#include <dune/xt/la/test/saddlepoint.hh>
+
+#if HAVE_DUNE_ISTL && HAVE_MPI
+
+#  include <dune/istl/owneroverlapcopy.hh>
+
+using namespace Dune;
+
+using Communication = OwnerOverlapCopyCommunication<size_t, int>;
+
+
+// Every rank stores the whole system and owns a contiguous block of the DoFs, all other DoFs are copies. This is an
+// overlapping decomposition in the sense of SchurComplementOperator, since all local rows are complete.
+std::unique_ptr<Communication> make_communication(const size_t size)
+{
+  auto communication = std::make_unique<Communication>(MPI_COMM_WORLD);
+  const auto num_ranks = static_cast<size_t>(communication->communicator().size());
+  const auto rank = static_cast<size_t>(communication->communicator().rank());
+  auto& index_set = communication->indexSet();
+  index_set.beginResize();
+  for (size_t ii = 0; ii < size; ++ii) {
+    const auto attribute =
+        ((ii * num_ranks) / size == rank) ? OwnerOverlapCopyAttributeSet::owner : OwnerOverlapCopyAttributeSet::copy;
+    index_set.add(ii, ParallelLocalIndex<OwnerOverlapCopyAttributeSet::AttributeSet>(ii, attribute, true));
+  }
+  index_set.endResize();
+  communication->remoteIndices().rebuild<false>();
+  return communication;
+} // ... make_communication(...)
+
+
+GTEST_TEST(SaddlePointSolver, test_cg_cg_schurcomplement_owner_overlap_copy_communication)
+{
+  using Matrix = XT::LA::IstlRowMajorSparseMatrix<double>;
+  using Vector = XT::LA::IstlDenseVector<double>;
+  SaddlePointTestData<Matrix, Vector> data;
+  const auto velocity_communicator = make_communication(data.f_.size());
+  const auto pressure_communicator = make_communication(data.g_.size());
+  XT::LA::SaddlePointSolver<Vector, Matrix, Communication> solver(
+      data.A_, data.B_, data.B_, data.C_, *velocity_communicator, *pressure_communicator);
+  EXPECT_EQ(std::vector<std::string>{"cg_cg_schurcomplement"}, solver.types());
+  Vector u(data.f_.size()), p(data.g_.size());
+  auto opts = solver.options("cg_cg_schurcomplement");
+  opts["precision"] = "1e-12";
+  solver.apply(data.f_, data.g_, u, p, opts);
+  // the solution is consistent, i.e. the copies hold the values of their owners
+  DXTC_EXPECT_FLOAT_EQ(0., (u - data.expected_u_).l2_norm(), 1e-12, 1e-12);
+  DXTC_EXPECT_FLOAT_EQ(0., (p - data.expected_p_).l2_norm(), 1e-12, 1e-12);
+  EXPECT_GT(solver.statistics().iterations, 0);
+  // the outer iteration count is a global quantity
+  const auto iterations = solver.statistics().iterations;
+  EXPECT_EQ(iterations, velocity_communicator->communicator().max(iterations));
+}
+
+
+#endif // HAVE_DUNE_ISTL && HAVE_MPI
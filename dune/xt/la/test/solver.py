@@ -18,6 +18,8 @@ types = [
     f.split('_') for f in [
         'CommonDenseMatrix_CommonDenseVector_CommonDenseVector_complex',
         'CommonDenseMatrix_CommonDenseVector_CommonDenseVector_double',
+        'CommonSparseMatrixCsr_CommonDenseVector_CommonDenseVector_double',
+        'CommonSparseMatrixCsc_CommonDenseVector_CommonDenseVector_double',
         'EigenDenseMatrix_EigenDenseVector_EigenDenseVector_complex',
         'EigenDenseMatrix_EigenDenseVector_EigenDenseVector_double',
         'EigenDenseMatrix_EigenDenseVector_EigenMappedDenseVector_double',
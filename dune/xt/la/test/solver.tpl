@@ -70,6 +70,47 @@ struct SolverTest_{{T_NAME}} : public ::testing::Test
 
       solver.apply(rhs, solution, options);
       EXPECT_TRUE(solution.almost_equal(rhs));
+      const auto& statistics = solver.statistics();
+      if (type != "auto") // otherwise, the chosen type is reported
+        EXPECT_EQ(type, statistics.type);
+      EXPECT_LE(statistics.final_residual, 1e-4);
+      EXPECT_GE(statistics.setup_time, 0.);
+      EXPECT_GE(statistics.solve_time, 0.);
+
+      // cheaper post checks
+      for (std::string post_check_mode : {"reported", "sampled"}) {
+        options["post_check_mode"] = post_check_mode;
+        solution.scal(0);
+        solver.apply(rhs, solution, options);
+        EXPECT_TRUE(solution.almost_equal(rhs));
+      }
+
+      // all smoothers (and coarsening criteria) of the AMG types which allow to choose them, the kept AMG hierarchy must
+      // not be reused for another smoother or criterion
+      if (options.has_key("smoother.type")) {
+        for (std::string smoother : {"jacobi", "gs", "sor", "ssor", "ilu0"}) {
+          for (std::string criterion : {"symmetric", "unsymmetric"}) {
+            auto amg_options = options;
+            amg_options["smoother.type"] = smoother;
+            amg_options["preconditioner.criterion"] = criterion;
+            amg_options["reuse_setup"] = "-1";
+            solution.scal(0);
+            solver.apply(rhs, solution, amg_options);
+            EXPECT_TRUE(solution.almost_equal(rhs));
+          }
+        }
+      }
+
+      // reuse of the factorization/preconditioner (ignored by solvers which do not support it), unlimited and with a
+      // new setup every second solve
+      for (const std::string reuse_setup : {"-1", "1"}) {
+        options["reuse_setup"] = reuse_setup;
+        for (size_t ii = 0; ii < 3; ++ii) {
+          solution.scal(0);
+          solver.apply(rhs, solution, options);
+          EXPECT_TRUE(solution.almost_equal(rhs));
+        }
+      }
     }
   } // ... produces_correct_results(...)
 }; // struct SolverTest
@@ -0,0 +1,127 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/container/istl.hh>
+#include <dune/xt/la/solver/low-rank-update.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using MatrixType = XT::LA::CommonDenseMatrix<double>;
+using VectorType = XT::LA::CommonDenseVector<double>;
+using UpdatedMatrixType = XT::LA::LowRankUpdatedMatrix<MatrixType, VectorType>;
+
+
+GTEST_TEST(LowRankUpdateSolver, woodbury)
+{
+  const size_t size = 30;
+  MatrixType A(size, size, 0.);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < size; ++jj)
+      A.set_entry(ii, jj, std::cos(0.3 * ii + 0.7 * jj) + (ii == jj ? 4. : 0.));
+  UpdatedMatrixType op(A, test_vectors<VectorType>(size, 3, 0.), test_vectors<VectorType>(size, 3, 1.));
+  XT::LA::Solver<UpdatedMatrixType> solver(op);
+  // the types reusing the factorization come first
+  EXPECT_EQ("lu.partialpiv", XT::LA::Solver<UpdatedMatrixType>::types()[0]);
+  VectorType expected_solution(size, 1.);
+  expected_solution.set_entry(0, 2.);
+  VectorType rhs(size, 0.);
+  for (const auto& type : XT::LA::Solver<UpdatedMatrixType>::types()) {
+    // several continuation steps with a changing update
+    for (size_t step = 0; step < 3; ++step) {
+      op.set_update(test_vectors<VectorType>(size, step + 1, 0.5 * step),
+                    test_vectors<VectorType>(size, step + 1, 1. + step));
+      op.mv(expected_solution, rhs);
+      VectorType solution(size, 0.);
+      solver.apply(rhs, solution, type);
+      DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-10, 1e-10);
+      EXPECT_EQ(type, solver.statistics().type);
+      // a second solve with the same update
+      solution.set_all(0.);
+      solver.apply(rhs, solution, type);
+      DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-10, 1e-10);
+    }
+  }
+  // no update
+  op.clear_update();
+  A.mv(expected_solution, rhs);
+  VectorType solution(size, 0.);
+  solver.apply(rhs, solution);
+  DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-10, 1e-10);
+  EXPECT_THROW(op.set_update(test_vectors<VectorType>(size, 2, 0.), test_vectors<VectorType>(size, 1, 0.)),
+               XT::Common::Exceptions::shapes_do_not_match);
+}
+
+GTEST_TEST(LowRankUpdateSolver, singular)
+{
+  // I - e_0 e_0^T is singular
+  const size_t size = 5;
+  MatrixType A(size, size, 0.);
+  for (size_t ii = 0; ii < size; ++ii)
+    A.set_entry(ii, ii, 1.);
+  std::vector<VectorType> U(1, VectorType(size, 0.)), V(1, VectorType(size, 0.));
+  U[0].set_entry(0, -1.);
+  V[0].set_entry(0, 1.);
+  const UpdatedMatrixType op(A, U, V);
+  XT::LA::Solver<UpdatedMatrixType> solver(op);
+  VectorType rhs(size, 1.), solution(size, 0.);
+  EXPECT_THROW(solver.apply(rhs, solution),
+               XT::LA::Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements);
+}
+
+#if HAVE_DUNE_ISTL
+
+GTEST_TEST(LowRankUpdateSolver, woodbury_istl_iterative)
+{
+  using IstlMatrixType = XT::LA::IstlRowMajorSparseMatrix<double>;
+  using IstlVectorType = XT::LA::IstlDenseVector<double>;
+  using IstlUpdatedMatrixType = XT::LA::LowRankUpdatedMatrix<IstlMatrixType, IstlVectorType>;
+  // nonsymmetric, diagonally dominant tridiagonal matrix
+  const size_t size = 50;
+  XT::LA::SparsityPatternDefault pattern(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = (ii > 0 ? ii - 1 : 0); jj < std::min(ii + 2, size); ++jj)
+      pattern.insert(ii, jj);
+  pattern.sort();
+  IstlMatrixType A(size, size, pattern);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (const auto& jj : pattern.inner(ii))
+      A.set_entry(ii, jj, jj == ii ? 4. : (jj < ii ? -1. : -0.5));
+  IstlUpdatedMatrixType op(A);
+  XT::LA::Solver<IstlUpdatedMatrixType> solver(op);
+  const std::string type = "bicgstab.ilut";
+  auto opts = XT::LA::Solver<IstlUpdatedMatrixType>::options(type);
+  EXPECT_EQ("-1", opts.get<std::string>("reuse_setup"));
+  opts["precision"] = "1e-13";
+  IstlVectorType expected_solution(size, 1.);
+  expected_solution.set_entry(0, 2.);
+  IstlVectorType rhs(size, 0.);
+  for (size_t step = 0; step < 3; ++step) {
+    op.set_update(test_vectors<IstlVectorType>(size, step + 1, 0.5 * step),
+                  test_vectors<IstlVectorType>(size, step + 1, 1. + step));
+    op.mv(expected_solution, rhs);
+    IstlVectorType solution(size, 0.);
+    solver.apply(rhs, solution, opts);
+    DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-8, 1e-8);
+    // the iterations of the step + 1 solves for A^{-1} U are included
+    const auto iterations_with_setup = solver.statistics().iterations;
+    EXPECT_GT(iterations_with_setup, 0);
+    // a second solve with the same update and options reuses A^{-1} U
+    solution.set_all(0.);
+    solver.apply(rhs, solution, opts);
+    DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-8, 1e-8);
+    EXPECT_GT(solver.statistics().iterations, 0);
+    EXPECT_LT(solver.statistics().iterations, iterations_with_setup);
+  }
+}
+
+#endif // HAVE_DUNE_ISTL
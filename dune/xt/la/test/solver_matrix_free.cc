@@ -0,0 +1,89 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/container/istl.hh>
+#include <dune/xt/la/solver/matrix-free.hh>
+
+using namespace Dune;
+
+#if HAVE_DUNE_ISTL
+
+// y = A x for the (symmetric positive definite) tridiagonal matrix with diagonal 2 + shift and off-diagonals -1
+template <class Vector>
+struct ShiftedLaplaceOperator
+{
+  void apply(const Vector& x, Vector& y) const
+  {
+    const size_t size = x.size();
+    for (size_t ii = 0; ii < size; ++ii) {
+      double value = (2. + shift) * x.get_entry(ii);
+      if (ii > 0)
+        value -= x.get_entry(ii - 1);
+      if (ii < size - 1)
+        value -= x.get_entry(ii + 1);
+      y.set_entry(ii, value);
+    }
+  }
+
+  double shift;
+}; // struct ShiftedLaplaceOperator
+
+template <class Vector>
+void solve_all_types()
+{
+  const size_t size = 50;
+  const ShiftedLaplaceOperator<Vector> laplace{1.};
+  auto op = XT::LA::make_matrix_free_operator<Vector>(laplace, size);
+  using OperatorType = decltype(op);
+  XT::LA::Solver<OperatorType> solver(op);
+  Vector expected_solution(size, 1.);
+  expected_solution.set_entry(0, 2.);
+  Vector rhs(size);
+  laplace.apply(expected_solution, rhs);
+  for (const std::string preconditioner : {"identity", "jacobi", "custom"}) {
+    if (preconditioner == "jacobi")
+      op.set_diagonal(Vector(size, 3.));
+    if (preconditioner == "custom")
+      op.set_preconditioner([](const Vector& residual, Vector& correction) {
+        correction = residual;
+        correction *= 1. / 3.;
+      });
+    for (const auto& type : XT::LA::Solver<OperatorType>::types()) {
+      auto opts = XT::LA::Solver<OperatorType>::options(type);
+      opts["preconditioner"] = preconditioner;
+      Vector solution(size, 0.);
+      solver.apply(rhs, solution, opts);
+      DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-8, 1e-8);
+      EXPECT_EQ(type, solver.statistics().type);
+      EXPECT_GT(solver.statistics().iterations, 0);
+    }
+  }
+  // requesting a preconditioner which was not given
+  const auto other_op = XT::LA::make_matrix_free_operator<Vector>(laplace, size);
+  XT::LA::Solver<OperatorType> other_solver(other_op);
+  auto opts = XT::LA::Solver<OperatorType>::options("cg");
+  opts["preconditioner"] = "jacobi";
+  Vector solution(size, 0.);
+  EXPECT_THROW(other_solver.apply(rhs, solution, opts), XT::LA::Exceptions::linear_solver_failed);
+} // ... solve_all_types(...)
+
+GTEST_TEST(MatrixFreeSolver, istl_dense_vector)
+{
+  solve_all_types<XT::LA::IstlDenseVector<double>>();
+}
+
+GTEST_TEST(MatrixFreeSolver, common_dense_vector)
+{
+  solve_all_types<XT::LA::CommonDenseVector<double>>();
+}
+
+#endif // HAVE_DUNE_ISTL
@@ -0,0 +1,82 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/container/pattern.hh>
+#include <dune/xt/la/solver.hh>
+
+using namespace Dune;
+
+#if HAVE_DUNE_ISTL
+
+using Matrix = XT::LA::IstlRowMajorSparseMatrix<double>;
+using Vector = XT::LA::IstlDenseVector<double>;
+
+// tridiagonal matrix with diagonal 2 and off-diagonals -1 - convection and -1 + convection
+Matrix tridiagonal_matrix(const size_t size, const double convection)
+{
+  XT::LA::SparsityPatternDefault pattern(size);
+  for (size_t ii = 0; ii < size; ++ii) {
+    if (ii > 0)
+      pattern.insert(ii, ii - 1);
+    pattern.insert(ii, ii);
+    if (ii < size - 1)
+      pattern.insert(ii, ii + 1);
+  }
+  pattern.sort();
+  Matrix matrix(size, size, pattern);
+  for (size_t ii = 0; ii < size; ++ii) {
+    if (ii > 0)
+      matrix.set_entry(ii, ii - 1, -1. - convection);
+    matrix.set_entry(ii, ii, 2.);
+    if (ii < size - 1)
+      matrix.set_entry(ii, ii + 1, -1. + convection);
+  }
+  return matrix;
+} // ... tridiagonal_matrix(...)
+
+void solve_sequence(const Matrix& matrix, const std::string& type)
+{
+  const size_t size = matrix.rows();
+  XT::LA::Solver<Matrix> solver(matrix);
+  Vector rhs(size, 1.);
+  Vector first_solution(size, 0.);
+  solver.apply(rhs, first_solution, type);
+  EXPECT_EQ(1, solver.recycled_subspace_size());
+  EXPECT_EQ(0, solver.statistics().recycled_subspace_size);
+  DXTC_EXPECT_FLOAT_EQ(1., solver.statistics().recycled_residual_reduction);
+  // the solution of a scaled rhs lies in the recycled subspace, nothing should be added
+  rhs *= 1.5;
+  Vector second_solution(size, 0.);
+  solver.apply(rhs, second_solution, type);
+  EXPECT_EQ(1, solver.recycled_subspace_size());
+  DXTC_EXPECT_FLOAT_EQ(0., (second_solution - first_solution * 1.5).sup_norm(), 1e-8, 1e-8);
+  // the projection alone solves the system
+  EXPECT_EQ(1, solver.statistics().recycled_subspace_size);
+  EXPECT_LT(solver.statistics().recycled_residual_reduction, 1e-8);
+  // a new direction is added
+  rhs.set_entry(0, 2.);
+  solver.apply(rhs, second_solution, type);
+  EXPECT_EQ(2, solver.recycled_subspace_size());
+  solver.clear_recycled_subspace();
+  EXPECT_EQ(0, solver.recycled_subspace_size());
+} // ... solve_sequence(...)
+
+GTEST_TEST(RecyclingSolver, cg_recycled)
+{
+  solve_sequence(tridiagonal_matrix(100, 0.), "cg.recycled");
+}
+
+GTEST_TEST(RecyclingSolver, gmres_recycled)
+{
+  solve_sequence(tridiagonal_matrix(100, 0.3), "gmres.recycled");
+}
+
+#endif // HAVE_DUNE_ISTL
@@ -0,0 +1,84 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/solver/common.hh>
+#include <dune/xt/la/test/algorithms.hh>
+
+using namespace Dune;
+
+using VectorType = XT::LA::CommonDenseVector<double>;
+
+
+template <class MatrixType>
+void solve_supernodal(const double shift, const std::string& type)
+{
+  const auto matrix = laplace_2d<MatrixType>(12, shift);
+  const size_t size = matrix.rows();
+  VectorType expected_solution(size), rhs(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    expected_solution.set_entry(ii, 1. + std::sin(double(ii)));
+  matrix.mv(expected_solution, rhs);
+  const XT::LA::Solver<MatrixType> solver(matrix);
+  for (const std::string ordering : {"minimum_degree", "natural"}) {
+    auto opts = solver.options(type);
+    opts["ordering"] = ordering;
+    VectorType solution(size, 0.);
+    solver.apply(rhs, solution, opts);
+    DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-10, 1e-10);
+    EXPECT_EQ(type, solver.statistics().type);
+    EXPECT_LE(solver.statistics().final_residual, 1e-10);
+  }
+} // ... solve_supernodal(...)
+
+
+GTEST_TEST(SupernodalSolver, positive_definite)
+{
+  solve_supernodal<XT::LA::CommonSparseMatrixCsr<double>>(0., "llt.supernodal");
+  solve_supernodal<XT::LA::CommonSparseMatrixCsc<double>>(0., "llt.supernodal");
+  solve_supernodal<XT::LA::CommonSparseMatrixCsr<double>>(0., "ldlt.supernodal");
+}
+
+GTEST_TEST(SupernodalSolver, indefinite)
+{
+  solve_supernodal<XT::LA::CommonSparseMatrixCsr<double>>(-1.5, "ldlt.supernodal");
+  const auto matrix = laplace_2d<XT::LA::CommonSparseMatrixCsr<double>>(12, -1.5);
+  const XT::LA::Solver<XT::LA::CommonSparseMatrixCsr<double>> solver(matrix);
+  VectorType rhs(matrix.rows(), 1.), solution(matrix.rows(), 0.);
+  EXPECT_THROW(solver.apply(rhs, solution, "llt.supernodal"),
+               XT::LA::Exceptions::linear_solver_failed_bc_data_did_not_fulfill_requirements);
+  auto opts = solver.options("llt.supernodal");
+  opts["ordering"] = "metis";
+  EXPECT_THROW(solver.apply(rhs, solution, opts), XT::Common::Exceptions::configuration_error);
+}
+
+GTEST_TEST(SupernodalSolver, reuse_setup)
+{
+  auto matrix = laplace_2d<XT::LA::CommonSparseMatrixCsr<double>>(10);
+  const XT::LA::Solver<XT::LA::CommonSparseMatrixCsr<double>> solver(matrix);
+  auto opts = solver.options("llt.supernodal");
+  opts["reuse_setup"] = "-1";
+  opts["post_check_solves_system"] = "0";
+  const VectorType expected_solution(matrix.rows(), 1.);
+  VectorType rhs(matrix.rows()), solution(matrix.rows(), 0.);
+  matrix.mv(expected_solution, rhs);
+  solver.apply(rhs, solution, opts);
+  DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-12, 1e-12);
+  // changes of the entries are not detected, the kept factorization of the old matrix is used
+  matrix.scal(2.);
+  solver.apply(rhs, solution, opts);
+  DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-12, 1e-12);
+  solver.clear_setup();
+  solver.apply(rhs, solution, opts);
+  auto halved_solution = expected_solution;
+  halved_solution.scal(0.5);
+  DXTC_EXPECT_FLOAT_EQ(0., (solution - halved_solution).sup_norm(), 1e-12, 1e-12);
+}
@@ -0,0 +1,112 @@
+// This file is part of the dune-xt-la project:
+//   https://github.com/dune-community/dune-xt-la
+// Copyright 2009-2018 dune-xt-la developers and contributors. All rights reserved.
+// License: Dual licensed as BSD 2-Clause License (http://opensource.org/licenses/BSD-2-Clause)
+//      or  GPL-2.0+ (http://opensource.org/licenses/gpl-license)
+//          with "runtime exception" (http://www.dune-project.org/license.html)
+
+#include <dune/xt/common/test/main.hxx> // <- This one has to come first, includes config.h!
+#include <dune/xt/common/test/float_cmp.hh>
+#include <dune/xt/common/test/gtest/gtest.h>
+
+#include <dune/xt/la/container/common.hh>
+#include <dune/xt/la/container/istl.hh>
+#include <dune/xt/la/solver/view.hh>
+
+using namespace Dune;
+
+#if HAVE_DUNE_ISTL
+
+// Solves with the lower right (size x size) block of a matrix, which has (symmetric positive definite) tridiagonal
+// blocks on the diagonal and some coupling entries in the off-diagonal blocks.
+template <class Matrix, class Vector>
+void solve_with_view()
+{
+  const size_t size = 20;
+  XT::LA::SparsityPatternDefault pattern(2 * size);
+  for (size_t ii = 0; ii < 2 * size; ++ii) {
+    pattern.insert(ii, (ii + size) % (2 * size));
+    pattern.insert(ii, ii);
+    if (ii % size > 0)
+      pattern.insert(ii, ii - 1);
+    if (ii % size < size - 1)
+      pattern.insert(ii, ii + 1);
+  }
+  pattern.sort();
+  Matrix matrix(2 * size, 2 * size, pattern);
+  for (size_t ii = 0; ii < 2 * size; ++ii) {
+    matrix.set_entry(ii, (ii + size) % (2 * size), 100.);
+    matrix.set_entry(ii, ii, 3.);
+    if (ii % size > 0)
+      matrix.set_entry(ii, ii - 1, -1.);
+    if (ii % size < size - 1)
+      matrix.set_entry(ii, ii + 1, -1.);
+  }
+  XT::LA::MatrixView<Matrix> view(matrix, size, 2 * size, size, 2 * size);
+  using SolverType = XT::LA::Solver<XT::LA::MatrixView<Matrix>>;
+  SolverType solver(view);
+  Vector expected_solution(size, 1.);
+  expected_solution.set_entry(0, 2.);
+  Vector rhs(size);
+  view.mv(expected_solution, rhs);
+  for (const auto& type : SolverType::types()) {
+    Vector solution(size, 0.);
+    solver.apply(rhs, solution, type);
+    DXTC_EXPECT_FLOAT_EQ(0., (solution - expected_solution).sup_norm(), 1e-8, 1e-8);
+    EXPECT_EQ(type, solver.statistics().type);
+  }
+  // solve for the lower part of a vector
+  Vector full_rhs(2 * size, 0.), full_solution(2 * size, 0.);
+  for (size_t ii = 0; ii < size; ++ii)
+    full_rhs.set_entry(size + ii, rhs.get_entry(ii));
+  const XT::LA::VectorView<Vector> rhs_view(full_rhs, size, 2 * size);
+  XT::LA::VectorView<Vector> solution_view(full_solution, size, 2 * size);
+  solver.apply(rhs_view, solution_view, "matrix_free.cg");
+  for (size_t ii = 0; ii < size; ++ii) {
+    DXTC_EXPECT_FLOAT_EQ(0., full_solution.get_entry(ii), 1e-15, 1e-15);
+    DXTC_EXPECT_FLOAT_EQ(expected_solution.get_entry(ii), full_solution.get_entry(size + ii), 1e-8, 1e-8);
+  }
+} // ... solve_with_view(...)
+
+// Copies the block [2, 7) x [3, 9) of a sparse (10 x 10) matrix with the row access used by the MatrixView solver.
+template <class Matrix>
+void copy_view()
+{
+  const size_t size = 10;
+  XT::LA::SparsityPatternDefault pattern(size);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (size_t jj = 0; jj < size; ++jj)
+      if ((ii + 2 * jj) % 3 != 0)
+        pattern.insert(ii, jj);
+  pattern.sort();
+  Matrix matrix(size, size, pattern);
+  for (size_t ii = 0; ii < size; ++ii)
+    for (const auto& jj : pattern.inner(ii))
+      matrix.set_entry(ii, jj, 1. + ii + 0.1 * jj);
+  const XT::LA::MatrixView<Matrix> view(matrix, 2, 7, 3, 9);
+  Matrix copy(view.rows(), view.cols(), view.get_pattern());
+  XT::LA::internal::MatrixViewRowAccess<Matrix>::copy(view, copy);
+  for (size_t ii = 0; ii < view.rows(); ++ii)
+    for (size_t jj = 0; jj < view.cols(); ++jj)
+      EXPECT_EQ(matrix.get_entry(2 + ii, 3 + jj), copy.get_entry(ii, jj));
+} // ... copy_view(...)
+
+GTEST_TEST(MatrixViewRowAccess, copy)
+{
+  copy_view<XT::LA::IstlRowMajorSparseMatrix<double>>();
+  copy_view<XT::LA::CommonSparseMatrix<double>>();
+  copy_view<XT::LA::CommonDenseMatrix<double>>();
+  copy_view<XT::LA::CommonDenseMatrix<double, XT::Common::StorageLayout::dense_column_major>>();
+}
+
+GTEST_TEST(MatrixViewSolver, istl_row_major_sparse_matrix)
+{
+  solve_with_view<XT::LA::IstlRowMajorSparseMatrix<double>, XT::LA::IstlDenseVector<double>>();
+}
+
+GTEST_TEST(MatrixViewSolver, common_dense_matrix)
+{
+  solve_with_view<XT::LA::CommonDenseMatrix<double>, XT::LA::CommonDenseVector<double>>();
+}
+
+#endif // HAVE_DUNE_ISTL
@@ -77,6 +77,7 @@ PYBIND11_MODULE(_la, m)
   LA::addbind_Matrix_Vector_interaction(eigen_row_major_sparse_matrix_double, eigen_dense_vector_double);
 #endif
 
+  LA::bind_SolverStatistics(m);
   LA::bind_Solver<LA::CommonDenseMatrix<double>>(m);
 //  LA::bind_Solver<LA::CommonSparseMatrix<double>>(m);
 #if HAVE_DUNE_ISTL
@@ -11,6 +11,8 @@
 #ifndef DUNE_XT_LA_SOLVER_PBH
 #define DUNE_XT_LA_SOLVER_PBH
 
+#include <sstream>
+
 #include <dune/pybindxi/pybind11.h>
 #include <dune/pybindxi/operators.h>
 
@@ -26,6 +28,36 @@ namespace XT {
 namespace LA {
 
 
+inline pybind11::class_<SolverStatistics> bind_SolverStatistics(pybind11::module& m)
+{
+  typedef SolverStatistics C;
+
+  namespace py = pybind11;
+
+  py::class_<C> c(m, "SolverStatistics", "SolverStatistics");
+
+  c.def_readonly("type", &C::type);
+  c.def_readonly("iterations", &C::iterations);
+  c.def_readonly("initial_residual", &C::initial_residual);
+  c.def_readonly("final_residual", &C::final_residual);
+  c.def_readonly("convergence_rate", &C::convergence_rate);
+  c.def_readonly("setup_time", &C::setup_time);
+  c.def_readonly("solve_time", &C::solve_time);
+  c.def_readonly("post_check_time", &C::post_check_time);
+  c.def_readonly("condition_estimate", &C::condition_estimate);
+  c.def_readonly("recycled_subspace_size", &C::recycled_subspace_size);
+  c.def_readonly("recycled_residual_reduction", &C::recycled_residual_reduction);
+  c.def_readonly("recycled_iterations_saved", &C::recycled_iterations_saved);
+  c.def("__repr__", [](const C& self) {
+    std::stringstream ss;
+    ss << self;
+    return ss.str();
+  });
+
+  return c;
+} // ... bind_SolverStatistics(...)
+
+
 template <class M, class V = typename Container<typename M::ScalarType, M::vector_type>::VectorType>
 typename std::enable_if<is_matrix<M>::value, pybind11::class_<Solver<M>>>::type bind_Solver(pybind11::module& m)
 {
@@ -56,6 +88,7 @@ typename std::enable_if<is_matrix<M>::value, pybind11::class_<Solver<M>>>::type
         "rhs"_a,
         "solution"_a,
         "options"_a);
+  c.def_property_readonly("statistics", [](const C& self) { return self.statistics(); });
 
   m.def("make_solver", [](const M& matrix) { return C(matrix); }, pybind11::keep_alive<0, 1>());
 